@@ -0,0 +1,917 @@
+/*
+ * Standalone benchmark of the MEX interface.
+ *
+ * Links the interface sources in src against the MEX shim (mexshim.c) and the
+ * stub COPT library (coptstub.c), then drives the coptmex dispatcher with
+ * synthetic models, exactly as the MATLAB wrappers in lib would. Before timing,
+ * each operation is checked once for a sane result, so the binary doubles as
+ * a quick self-check of the interface outside MATLAB.
+ *
+ * For every case and model scale, the median and 95th percentile of the wall
+ * time and of each phase reported by the Timing parameter are printed, along
+ * with the peak memory held in MATLAB arrays during a call. The same figures
+ * can be written to a JSON file with one record per line for diffing.
+ */
+
+/* Expose clock_gettime and strdup declarations under -std=c99 */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "mex.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_MAXCASE  16
+#define BENCH_MAXSCALE 16
+#define BENCH_MAXPHASE 16
+
+typedef struct bench_opt_s
+{
+  int nCol;
+  int nRow;
+  int nColElem;
+  int nRepeat;
+  int isQuiet;
+  int nScale;
+  int scales[BENCH_MAXSCALE];
+  const char* outfile;
+} bench_opt;
+
+typedef struct bench_case_s
+{
+  const char* name;
+  const char* cmd;
+  int nOut;
+  int nArg;
+  const mxArray* args[4];
+} bench_case;
+
+typedef struct bench_stat_s
+{
+  double median;
+  double p95;
+} bench_stat;
+
+static unsigned int BENCH_seed = 12345;
+
+static double BENCH_getWallTime(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double BENCH_rand(void)
+{
+  BENCH_seed = BENCH_seed * 1103515245u + 12345u;
+  return ((BENCH_seed >> 8) & 0xFFFF) / 65536.0;
+}
+
+/* Sparse nRow x nCol matrix with nColElem non-zeros in every column */
+static mxArray* BENCH_genMatrix(const bench_opt* opt)
+{
+  int nColElem = opt->nColElem < opt->nRow ? opt->nColElem : opt->nRow;
+  int nStride = opt->nRow / (nColElem > 0 ? nColElem : 1);
+  mxArray* A = mxCreateSparse(opt->nRow, opt->nCol, (mwSize) opt->nCol * nColElem, mxREAL);
+  mwIndex* jc = mxGetJc(A);
+  mwIndex* ir = mxGetIr(A);
+  double* pr = mxGetDoubles(A);
+  mwIndex nElem = 0;
+
+  for (int j = 0; j < opt->nCol; ++j)
+  {
+    jc[j] = nElem;
+    for (int k = 0; k < nColElem; ++k)
+    {
+      ir[nElem] = (j % nStride) + k * nStride;
+      pr[nElem] = 2.0 * BENCH_rand() - 1.0;
+      nElem++;
+    }
+  }
+  jc[opt->nCol] = nElem;
+
+  return A;
+}
+
+static mxArray* BENCH_genVector(int n, double lb, double ub)
+{
+  mxArray* vec = mxCreateDoubleMatrix(n, 1, mxREAL);
+  double* pr = mxGetDoubles(vec);
+
+  for (int i = 0; i < n; ++i)
+  {
+    pr[i] = lb == ub ? lb : lb + (ub - lb) * BENCH_rand();
+  }
+  return vec;
+}
+
+/* Model struct as accepted by copt_solve, with every second column integral if requested */
+static mxArray* BENCH_genModel(const bench_opt* opt, int isMIP)
+{
+  const char* fields[] = {"A", "obj", "lb", "ub", "lhs", "rhs"};
+  mxArray* model = mxCreateStructMatrix(1, 1, 6, fields);
+
+  mxSetField(model, 0, "A", BENCH_genMatrix(opt));
+  mxSetField(model, 0, "obj", BENCH_genVector(opt->nCol, -1.0, 1.0));
+  mxSetField(model, 0, "lb", BENCH_genVector(opt->nCol, 0.0, 0.0));
+  mxSetField(model, 0, "ub", BENCH_genVector(opt->nCol, 10.0, 10.0));
+  mxSetField(model, 0, "lhs", BENCH_genVector(opt->nRow, -mxGetInf(), -mxGetInf()));
+  mxSetField(model, 0, "rhs", BENCH_genVector(opt->nRow, 1.0, 100.0));
+
+  if (isMIP)
+  {
+    char* vtype = (char*) calloc(opt->nCol + 1, sizeof(char));
+    for (int j = 0; j < opt->nCol; ++j)
+    {
+      vtype[j] = j % 2 == 0 ? 'I' : 'C';
+    }
+    mxAddField(model, "vtype");
+    mxSetField(model, 0, "vtype", mxCreateString(vtype));
+    free(vtype);
+  }
+
+  return model;
+}
+
+/* Problem struct as accepted by the copt_linprog family */
+static mxArray* BENCH_genProg(const bench_opt* opt)
+{
+  const char* fields[] = {"f", "Aineq", "bineq", "lb", "ub"};
+  mxArray* prog = mxCreateStructMatrix(1, 1, 5, fields);
+
+  mxSetField(prog, 0, "f", BENCH_genVector(opt->nCol, -1.0, 1.0));
+  mxSetField(prog, 0, "Aineq", BENCH_genMatrix(opt));
+  mxSetField(prog, 0, "bineq", BENCH_genVector(opt->nRow, 1.0, 100.0));
+  mxSetField(prog, 0, "lb", BENCH_genVector(opt->nCol, 0.0, 0.0));
+  mxSetField(prog, 0, "ub", BENCH_genVector(opt->nCol, 10.0, 10.0));
+
+  return prog;
+}
+
+static mxArray* BENCH_genParam(void)
+{
+  const char* fields[] = {"Logging"};
+  mxArray* param = mxCreateStructMatrix(1, 1, 1, fields);
+
+  mxSetField(param, 0, "Logging", mxCreateDoubleScalar(0.0));
+  return param;
+}
+
+/* Progress info received by the function handle passed as ProgressFcn */
+static int BENCH_nProgress = 0;
+static int BENCH_nProgressSol = 0;
+
+static int BENCH_onProgress(int nlhs, mxArray* plhs[], int nrhs, mxArray* prhs[])
+{
+  const char* fields[] = {"time", "objval", "bestbnd", "nodecnt", "x"};
+
+  if (nrhs != 1 || !mxIsStruct(prhs[0]))
+  {
+    return 1;
+  }
+  for (int i = 0; i < 5; ++i)
+  {
+    if (mxGetField(prhs[0], 0, fields[i]) == NULL)
+    {
+      return 1;
+    }
+  }
+
+  BENCH_nProgress++;
+  BENCH_nProgressSol += !mxIsEmpty(mxGetField(prhs[0], 0, "x"));
+  return 0;
+}
+
+/* Solutions received by the function handles passed as LazyConstraintFcn and UserCutFcn */
+static int BENCH_nLazy = 0;
+static int BENCH_nCut = 0;
+
+/* Return one row, sum of x <= n */
+static int BENCH_onLazy(int nlhs, mxArray* plhs[], int nrhs, mxArray* prhs[])
+{
+  const char* fields[] = {"A", "sense", "rhs"};
+  size_t nCol = mxGetM(prhs[0]);
+  mxArray* rows = mxCreateStructMatrix(1, 1, 3, fields);
+  mxArray* mat = mxCreateSparse(1, nCol, nCol, mxREAL);
+
+  for (size_t j = 0; j < nCol; ++j)
+  {
+    mxGetJc(mat)[j] = j;
+    mxGetIr(mat)[j] = 0;
+    mxGetPr(mat)[j] = 1.0;
+  }
+  mxGetJc(mat)[nCol] = nCol;
+
+  mxSetField(rows, 0, "A", mat);
+  mxSetField(rows, 0, "sense", mxCreateString("L"));
+  mxSetField(rows, 0, "rhs", mxCreateDoubleScalar((double) nCol));
+  plhs[0] = rows;
+
+  BENCH_nLazy++;
+  return 0;
+}
+
+/* Return no cuts */
+static int BENCH_onCut(int nlhs, mxArray* plhs[], int nrhs, mxArray* prhs[])
+{
+  plhs[0] = mxCreateDoubleMatrix(0, 0, mxREAL);
+  BENCH_nCut++;
+  return 0;
+}
+
+/* Call dispatcher with command and arguments, return nonzero on error */
+static int BENCH_callMex(const char* cmd, int nOut, int nArg, const mxArray* const* args, mxArray** out)
+{
+  int failed = 0;
+  mxArray* plhs[2] = {NULL, NULL};
+  const mxArray* prhs[5];
+
+  prhs[0] = mxCreateString(cmd);
+  for (int i = 0; i < nArg; ++i)
+  {
+    prhs[i + 1] = args[i];
+  }
+
+  failed = MEXSHIM_call(nOut, plhs, nArg + 1, prhs);
+  if (failed)
+  {
+    fprintf(stderr, "coptmex('%s') failed: %s\n", cmd, MEXSHIM_getError());
+  }
+
+  mxDestroyArray((mxArray*) prhs[0]);
+  for (int i = 0; out != NULL && i < (nOut > 1 ? nOut : 1); ++i)
+  {
+    out[i] = failed ? NULL : plhs[i];
+  }
+  return failed;
+}
+
+static int BENCH_sameArray(const mxArray* a, const mxArray* b)
+{
+  size_t n = 0;
+
+  if (a == NULL || b == NULL || mxGetM(a) != mxGetM(b) || mxGetN(a) != mxGetN(b))
+  {
+    return 0;
+  }
+
+  if (mxIsSparse(a) != mxIsSparse(b))
+  {
+    return 0;
+  }
+
+  if (mxIsSparse(a))
+  {
+    n = mxGetJc(a)[mxGetN(a)];
+    if (n != mxGetJc(b)[mxGetN(b)] || memcmp(mxGetJc(a), mxGetJc(b), (mxGetN(a) + 1) * sizeof(mwIndex)) != 0 ||
+        memcmp(mxGetIr(a), mxGetIr(b), n * sizeof(mwIndex)) != 0)
+    {
+      return 0;
+    }
+  }
+  else
+  {
+    n = mxGetNumberOfElements(a);
+  }
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    double va = mxGetDoubles(a)[i];
+    double vb = mxGetDoubles(b)[i];
+    if (va != vb && !(fabs(va) >= 1e30 && fabs(vb) >= 1e30 && va * vb > 0))
+    {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static int BENCH_isStatus(const mxArray* result, const char* status)
+{
+  char buff[64];
+  const mxArray* field = result != NULL ? mxGetField(result, 0, "status") : NULL;
+
+  if (field == NULL || !mxIsChar(field))
+  {
+    return 0;
+  }
+  mxGetString(field, buff, sizeof(buff));
+  return strcmp(buff, status) == 0;
+}
+
+/* Sanity checks of results before timing */
+static int BENCH_check(const bench_opt* opt, const mxArray* model, const mxArray* mipModel, const mxArray* buffer,
+                       const mxArray* param, const mxArray* progressParam, const mxArray* userParam,
+                       const mxArray* colObj, const mxArray* cols, const mxArray* rows, const mxArray* rowSense,
+                       const mxArray* rowRhs)
+{
+  int nFail = 0;
+  const char* fields[] = {"A", "obj", "lb", "ub", "lhs", "rhs"};
+  const mxArray* args[2] = {buffer, NULL};
+  mxArray* readback = NULL;
+  mxArray* result = NULL;
+  mxArray* iis = NULL;
+
+  // Model written to buffer reads back unchanged
+  args[1] = mxCreateString("bin");
+  BENCH_callMex("read", 1, 2, args, &readback);
+  for (int i = 0; i < 6; ++i)
+  {
+    if (readback == NULL || !BENCH_sameArray(mxGetField(model, 0, fields[i]), mxGetField(readback, 0, fields[i])))
+    {
+      fprintf(stderr, "check failed: field '%s' changed in write/read round trip\n", fields[i]);
+      nFail++;
+    }
+  }
+  mxDestroyArray((mxArray*) args[1]);
+
+  // Solve returns an optimal result with solution and timing attached
+  args[0] = model;
+  args[1] = param;
+  BENCH_callMex("solve", 1, 2, args, &result);
+  if (!BENCH_isStatus(result, "optimal"))
+  {
+    fprintf(stderr, "check failed: solve did not report optimal status\n");
+    nFail++;
+  }
+  else
+  {
+    const mxArray* x = mxGetField(result, 0, "x");
+    if (x == NULL || mxGetNumberOfElements(x) != (size_t) opt->nCol)
+    {
+      fprintf(stderr, "check failed: solution has wrong size\n");
+      nFail++;
+    }
+    if (mxGetField(result, 0, "timing") == NULL)
+    {
+      fprintf(stderr, "check failed: timing missing from result\n");
+      nFail++;
+    }
+  }
+
+  // IIS computation returns timing as well
+  BENCH_callMex("computeiis", 1, 2, args, &iis);
+  if (iis == NULL || mxGetField(iis, 0, "timing") == NULL)
+  {
+    fprintf(stderr, "check failed: timing missing from IIS result\n");
+    nFail++;
+  }
+
+  // Columns added to kept problem are re-solved, and only objective and duals come back
+  {
+    mxArray* kept[2] = {NULL, NULL};
+    mxArray* added = NULL;
+    const mxArray* addArgs[3] = {NULL, colObj, cols};
+
+    BENCH_callMex("solve", 2, 2, args, kept);
+    addArgs[0] = kept[1];
+    if (kept[1] != NULL)
+    {
+      BENCH_callMex("addcols", 1, 3, addArgs, &added);
+    }
+    if (!BENCH_isStatus(added, "optimal") || mxGetField(added, 0, "objval") == NULL ||
+        mxGetField(added, 0, "pi") == NULL || mxGetNumberOfElements(mxGetField(added, 0, "pi")) != (size_t) opt->nRow ||
+        mxGetField(added, 0, "x") != NULL)
+    {
+      fprintf(stderr, "check failed: addcols did not return objective and duals only\n");
+      nFail++;
+    }
+    if (kept[1] != NULL)
+    {
+      BENCH_callMex("free", 0, 1, addArgs, NULL);
+    }
+
+    mxDestroyArray(kept[0]);
+    mxDestroyArray(kept[1]);
+    mxDestroyArray(added);
+  }
+
+  // Rows added to kept problem return primal values and slacks, and can be deleted again
+  {
+    int nAddRow = (int) mxGetM(rows);
+    mxArray* kept[2] = {NULL, NULL};
+    mxArray* added = NULL;
+    mxArray* delList = BENCH_genVector(nAddRow, 0.0, 0.0);
+    const mxArray* addArgs[4] = {NULL, rows, rowSense, rowRhs};
+    const mxArray* delArgs[2] = {NULL, delList};
+
+    for (int i = 0; i < nAddRow; ++i)
+    {
+      mxGetDoubles(delList)[i] = opt->nRow + i + 1;
+    }
+
+    BENCH_callMex("solve", 2, 2, args, kept);
+    addArgs[0] = kept[1];
+    delArgs[0] = kept[1];
+    for (int k = 0; k < 2 && kept[1] != NULL; ++k)
+    {
+      mxDestroyArray(added);
+      added = NULL;
+      BENCH_callMex("addrows", 1, 4, addArgs, &added);
+      if (!BENCH_isStatus(added, "optimal") || mxGetField(added, 0, "x") == NULL ||
+          mxGetField(added, 0, "slack") == NULL ||
+          mxGetNumberOfElements(mxGetField(added, 0, "slack")) != (size_t) (opt->nRow + nAddRow) ||
+          mxGetField(added, 0, "pi") != NULL)
+      {
+        fprintf(stderr, "check failed: addrows did not return primal values and slacks only\n");
+        nFail++;
+        break;
+      }
+
+      // The same rows can be added again once deleted
+      BENCH_callMex("delrows", 0, 2, delArgs, NULL);
+    }
+    if (kept[1] != NULL)
+    {
+      BENCH_callMex("free", 0, 1, addArgs, NULL);
+    }
+
+    mxDestroyArray(kept[0]);
+    mxDestroyArray(kept[1]);
+    mxDestroyArray(added);
+    mxDestroyArray(delList);
+  }
+
+  // Progress of MIP solving reaches the function handle with the incumbent
+  args[0] = mipModel;
+  args[1] = progressParam;
+  BENCH_nProgress = 0;
+  BENCH_nProgressSol = 0;
+  mxDestroyArray(result);
+  result = NULL;
+  BENCH_callMex("solve", 1, 2, args, &result);
+  if (BENCH_nProgress == 0 || BENCH_nProgressSol == 0)
+  {
+    fprintf(stderr, "check failed: ProgressFcn not called with incumbent\n");
+    nFail++;
+  }
+  if (result == NULL || mxGetField(result, 0, "timeline") == NULL || mxGetN(mxGetField(result, 0, "timeline")) != 4 ||
+      mxGetField(result, 0, "primalintegral") == NULL)
+  {
+    fprintf(stderr, "check failed: timeline missing from MIP result\n");
+    nFail++;
+  }
+
+  // User callbacks receive the relaxation and candidate solutions
+  args[1] = userParam;
+  BENCH_nLazy = 0;
+  BENCH_nCut = 0;
+  mxDestroyArray(result);
+  result = NULL;
+  BENCH_callMex("solve", 1, 2, args, &result);
+  if (result == NULL || BENCH_nLazy == 0 || BENCH_nCut == 0)
+  {
+    fprintf(stderr, "check failed: LazyConstraintFcn or UserCutFcn not called\n");
+    nFail++;
+  }
+
+  mxDestroyArray(readback);
+  mxDestroyArray(result);
+  mxDestroyArray(iis);
+
+  return nFail;
+}
+
+static int BENCH_compare(const void* a, const void* b)
+{
+  double da = *(const double*) a;
+  double db = *(const double*) b;
+  return (da > db) - (da < db);
+}
+
+/* Median and 95th percentile, values are sorted in place */
+static bench_stat BENCH_getStat(double* values, int num)
+{
+  bench_stat stat;
+  int iP95 = (int) ceil(0.95 * num) - 1;
+
+  qsort(values, num, sizeof(double), BENCH_compare);
+  stat.median = num % 2 == 1 ? values[num / 2] : 0.5 * (values[num / 2 - 1] + values[num / 2]);
+  stat.p95 = values[iP95 > 0 ? iP95 : 0];
+
+  return stat;
+}
+
+/* Time repeated calls of a case, print summary and append a JSON record to output */
+static int BENCH_run(const bench_opt* opt, int scale, const bench_case* bcase, FILE* fp, int* p_nRecord)
+{
+  int failed = 0;
+  int nPhase = 0;
+  char phaseNames[BENCH_MAXPHASE][32];
+  double* times = (double*) calloc((size_t) opt->nRepeat * (BENCH_MAXPHASE + 1), sizeof(double));
+  double* phaseTimes = times + opt->nRepeat;
+  double peakBytes = 0.0;
+  bench_stat total;
+
+  if (!times)
+  {
+    return 1;
+  }
+
+  for (int r = 0; r < opt->nRepeat && !failed; ++r)
+  {
+    mxArray* out = NULL;
+    const mxArray* timing = NULL;
+    size_t nBaseBytes = MEXSHIM_resetPeakBytes();
+    double dStart = BENCH_getWallTime();
+
+    failed = BENCH_callMex(bcase->cmd, bcase->nOut, bcase->nArg, bcase->args, &out);
+    times[r] = BENCH_getWallTime() - dStart;
+    if ((double) (MEXSHIM_getPeakBytes() - nBaseBytes) > peakBytes)
+    {
+      peakBytes = (double) (MEXSHIM_getPeakBytes() - nBaseBytes);
+    }
+
+    // Collect per-phase times reported by the Timing parameter
+    timing = out != NULL ? mxGetField(out, 0, "timing") : NULL;
+    for (int j = 0; timing != NULL && j < mxGetNumberOfFields(timing); ++j)
+    {
+      const char* name = mxGetFieldNameByNumber(timing, j);
+      int k = 0;
+
+      if (strcmp(name, "total") == 0 || strcmp(name, "bytes") == 0)
+      {
+        continue;
+      }
+
+      while (k < nPhase && strcmp(phaseNames[k], name) != 0)
+      {
+        k++;
+      }
+      if (k == nPhase && nPhase < BENCH_MAXPHASE)
+      {
+        snprintf(phaseNames[nPhase++], sizeof(phaseNames[0]), "%s", name);
+      }
+      if (k < nPhase)
+      {
+        phaseTimes[k * opt->nRepeat + r] = mxGetScalar(mxGetFieldByNumber(timing, 0, j));
+      }
+    }
+
+    mxDestroyArray(out);
+  }
+
+  if (failed)
+  {
+    free(times);
+    return 1;
+  }
+
+  total = BENCH_getStat(times, opt->nRepeat);
+  printf("%-14s %6d %8d %12.3f %12.3f %12.1f\n", bcase->name, scale, opt->nRepeat, 1e3 * total.median,
+         1e3 * total.p95, peakBytes / 1024.0);
+
+  if (fp != NULL)
+  {
+    fprintf(fp, "%s    {\"case\": \"%s\", \"scale\": %d, \"cols\": %d, \"rows\": %d, \"elems\": %d, \"repeats\": %d, ",
+            *p_nRecord > 0 ? ",\n" : "", bcase->name, scale, opt->nCol, opt->nRow, opt->nCol * opt->nColElem,
+            opt->nRepeat);
+    fprintf(fp, "\"time\": {\"median\": %.9g, \"p95\": %.9g}, \"phases\": {", total.median, total.p95);
+  }
+
+  for (int k = 0; k < nPhase; ++k)
+  {
+    bench_stat stat = BENCH_getStat(phaseTimes + k * opt->nRepeat, opt->nRepeat);
+
+    printf("  %-12s %15s %12.3f %12.3f\n", phaseNames[k], "", 1e3 * stat.median, 1e3 * stat.p95);
+    if (fp != NULL)
+    {
+      fprintf(fp, "%s\"%s\": {\"median\": %.9g, \"p95\": %.9g}", k > 0 ? ", " : "", phaseNames[k], stat.median,
+              stat.p95);
+    }
+  }
+
+  if (fp != NULL)
+  {
+    fprintf(fp, "}, \"peakbytes\": %.0f}", peakBytes);
+    (*p_nRecord)++;
+  }
+
+  free(times);
+  return 0;
+}
+
+/* Peak resident set size of the process in bytes */
+static double BENCH_getMaxRSS(void)
+{
+  struct rusage usage;
+
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0.0;
+  }
+#ifdef __APPLE__
+  return (double) usage.ru_maxrss;
+#else
+  return 1024.0 * usage.ru_maxrss;
+#endif
+}
+
+/* Run all cases on synthetic models of one scale */
+static int BENCH_runScale(const bench_opt* baseopt, int scale, FILE* fp, int* p_nRecord)
+{
+  int nFail = 0;
+  int nCase = 0;
+  bench_opt opt = *baseopt;
+  bench_case cases[BENCH_MAXCASE];
+  char filename[256];
+  char solname[256];
+  char basname[256];
+  const char* tmpdir = getenv("TMPDIR");
+  mxArray* lpModel = NULL;
+  mxArray* mipModel = NULL;
+  mxArray* prog = NULL;
+  mxArray* timedParam = NULL;
+  mxArray* progressParam = NULL;
+  mxArray* userParam = NULL;
+  mxArray* leanParam = NULL;
+  mxArray* format = NULL;
+  mxArray* file = NULL;
+  mxArray* buffer = NULL;
+  mxArray* colObj = NULL;
+  mxArray* cols = NULL;
+  mxArray* rows = NULL;
+  mxArray* rowSense = NULL;
+  mxArray* rowRhs = NULL;
+  mxArray* kept[2] = {NULL, NULL};
+  mxArray* cutKept[2] = {NULL, NULL};
+
+  opt.nCol = baseopt->nCol * scale;
+  opt.nRow = baseopt->nRow * scale;
+
+  lpModel = BENCH_genModel(&opt, 0);
+  mipModel = BENCH_genModel(&opt, 1);
+  prog = BENCH_genProg(&opt);
+  timedParam = BENCH_genParam();
+  mxAddField(timedParam, "Timing");
+  mxSetField(timedParam, 0, "Timing", mxCreateDoubleScalar(1.0));
+  progressParam = mxDuplicateArray(timedParam);
+  mxAddField(progressParam, "ProgressFcn");
+  mxSetField(progressParam, 0, "ProgressFcn", MEXSHIM_createFunction(BENCH_onProgress));
+  mxAddField(progressParam, "ProgressInterval");
+  mxSetField(progressParam, 0, "ProgressInterval", mxCreateDoubleScalar(0.0));
+  userParam = mxDuplicateArray(timedParam);
+  mxAddField(userParam, "LazyConstraintFcn");
+  mxSetField(userParam, 0, "LazyConstraintFcn", MEXSHIM_createFunction(BENCH_onLazy));
+  mxAddField(userParam, "UserCutFcn");
+  mxSetField(userParam, 0, "UserCutFcn", MEXSHIM_createFunction(BENCH_onCut));
+  format = mxCreateString("bin");
+
+  // A batch of columns as priced by one iteration of column generation
+  {
+    bench_opt colopt = opt;
+    colopt.nCol = 10;
+    colObj = BENCH_genVector(colopt.nCol, -1.0, 1.0);
+    cols = BENCH_genMatrix(&colopt);
+  }
+
+  // A batch of cuts as separated by one iteration of a cutting plane loop
+  {
+    bench_opt rowopt = opt;
+    rowopt.nRow = 5;
+    rowopt.nColElem = 1;
+    rows = BENCH_genMatrix(&rowopt);
+    rowSense = mxCreateString("LLLLL");
+    rowRhs = BENCH_genVector(rowopt.nRow, 1.0, 100.0);
+  }
+
+  snprintf(filename, sizeof(filename), "%s/coptmex_bench_%d.bin", tmpdir != NULL ? tmpdir : "/tmp", (int) getpid());
+  file = mxCreateString(filename);
+
+  // Solution and basis go to files only, leaving solution vectors out of result
+  snprintf(solname, sizeof(solname), "%s/coptmex_bench_%d.sol", tmpdir != NULL ? tmpdir : "/tmp", (int) getpid());
+  snprintf(basname, sizeof(basname), "%s/coptmex_bench_%d.bas", tmpdir != NULL ? tmpdir : "/tmp", (int) getpid());
+  leanParam = mxDuplicateArray(timedParam);
+  mxAddField(leanParam, "WriteSolution");
+  mxSetField(leanParam, 0, "WriteSolution", mxCreateString(solname));
+  mxAddField(leanParam, "WriteBasis");
+  mxSetField(leanParam, 0, "WriteBasis", mxCreateString(basname));
+  mxAddField(leanParam, "ResultFields");
+  mxSetField(leanParam, 0, "ResultFields", mxCreateCellMatrix(0, 1));
+
+  {
+    const mxArray* args[2] = {lpModel, format};
+    nFail += BENCH_callMex("write", 1, 2, args, &buffer);
+    args[1] = file;
+    nFail += BENCH_callMex("write", 0, 2, args, NULL);
+  }
+
+  if (nFail == 0)
+  {
+    nFail = BENCH_check(&opt, lpModel, mipModel, buffer, timedParam, progressParam, userParam, colObj, cols, rows,
+                        rowSense, rowRhs);
+  }
+
+  // Solution written to file is left out of result
+  if (nFail == 0)
+  {
+    const mxArray* args[2] = {lpModel, leanParam};
+    mxArray* lean = NULL;
+    BENCH_callMex("solve", 1, 2, args, &lean);
+    if (!BENCH_isStatus(lean, "optimal") || mxGetField(lean, 0, "objval") == NULL ||
+        mxGetField(lean, 0, "x") != NULL || mxGetField(lean, 0, "varbasis") != NULL ||
+        access(solname, R_OK) != 0 || access(basname, R_OK) != 0)
+    {
+      fprintf(stderr, "check failed: solve with files written did not return lean result\n");
+      nFail++;
+    }
+    mxDestroyArray(lean);
+  }
+
+  // Problems kept for addcols and addrows grow by one batch per repetition
+  if (nFail == 0)
+  {
+    const mxArray* args[2] = {lpModel, timedParam};
+    nFail += BENCH_callMex("solve", 2, 2, args, kept);
+    nFail += BENCH_callMex("solve", 2, 2, args, cutKept);
+  }
+
+  cases[nCase++] = (bench_case){"solve-lp", "solve", 1, 2, {lpModel, timedParam}};
+  cases[nCase++] = (bench_case){"solve-mip", "solve", 1, 2, {mipModel, timedParam}};
+  cases[nCase++] = (bench_case){"solve-progress", "solve", 1, 2, {mipModel, progressParam}};
+  cases[nCase++] = (bench_case){"solve-usercb", "solve", 1, 2, {mipModel, userParam}};
+  cases[nCase++] = (bench_case){"solve-lean", "solve", 1, 2, {lpModel, leanParam}};
+  cases[nCase++] = (bench_case){"solve-prog", "solveprog", 1, 2, {prog, timedParam}};
+  cases[nCase++] = (bench_case){"solve-buffer", "solve", 1, 3, {buffer, format, timedParam}};
+  cases[nCase++] = (bench_case){"solve-file", "solve", 1, 2, {file, timedParam}};
+  cases[nCase++] = (bench_case){"addcols", "addcols", 1, 3, {kept[1], colObj, cols}};
+  cases[nCase++] = (bench_case){"addrows", "addrows", 1, 4, {cutKept[1], rows, rowSense, rowRhs}};
+  cases[nCase++] = (bench_case){"computeiis", "computeiis", 1, 2, {lpModel, timedParam}};
+  cases[nCase++] = (bench_case){"write-buffer", "write", 1, 2, {lpModel, format}};
+  cases[nCase++] = (bench_case){"write-file", "write", 0, 2, {lpModel, file}};
+  cases[nCase++] = (bench_case){"read-buffer", "read", 1, 2, {buffer, format}};
+  cases[nCase++] = (bench_case){"read-file", "read", 1, 1, {file}};
+
+  if (nFail == 0)
+  {
+    printf("\nModel: %d columns, %d rows, %d non-zeros per column\n", opt.nCol, opt.nRow, opt.nColElem);
+    printf("%-14s %6s %8s %12s %12s %12s\n", "case", "scale", "repeats", "median(ms)", "p95(ms)", "peak(KB)");
+  }
+  for (int i = 0; i < nCase && nFail == 0; ++i)
+  {
+    nFail += BENCH_run(&opt, scale, &cases[i], fp, p_nRecord);
+  }
+
+  if (kept[1] != NULL)
+  {
+    BENCH_callMex("free", 0, 1, (const mxArray**) &kept[1], NULL);
+  }
+  if (cutKept[1] != NULL)
+  {
+    BENCH_callMex("free", 0, 1, (const mxArray**) &cutKept[1], NULL);
+  }
+
+  remove(filename);
+  remove(solname);
+  remove(basname);
+  mxDestroyArray(lpModel);
+  mxDestroyArray(mipModel);
+  mxDestroyArray(prog);
+  mxDestroyArray(timedParam);
+  mxDestroyArray(progressParam);
+  mxDestroyArray(userParam);
+  mxDestroyArray(leanParam);
+  mxDestroyArray(format);
+  mxDestroyArray(file);
+  mxDestroyArray(buffer);
+  mxDestroyArray(colObj);
+  mxDestroyArray(cols);
+  mxDestroyArray(rows);
+  mxDestroyArray(rowSense);
+  mxDestroyArray(rowRhs);
+  mxDestroyArray(kept[0]);
+  mxDestroyArray(kept[1]);
+  mxDestroyArray(cutKept[0]);
+  mxDestroyArray(cutKept[1]);
+
+  return nFail;
+}
+
+/* Parse comma separated list of scales */
+static int BENCH_parseScales(bench_opt* opt, const char* list)
+{
+  const char* p = list;
+
+  opt->nScale = 0;
+  while (*p != '\0' && opt->nScale < BENCH_MAXSCALE)
+  {
+    char* end = NULL;
+    long scale = strtol(p, &end, 10);
+
+    if (end == p || scale <= 0 || (*end != ',' && *end != '\0'))
+    {
+      return 1;
+    }
+    opt->scales[opt->nScale++] = (int) scale;
+    p = *end == ',' ? end + 1 : end;
+  }
+
+  return opt->nScale > 0 ? 0 : 1;
+}
+
+static void BENCH_usage(const char* prog)
+{
+  printf("Usage: %s [-n cols] [-m rows] [-k nonzeros per column] [-r repeats] [-s scale,...] [-o file.json] [-v]\n",
+         prog);
+}
+
+int main(int argc, char* argv[])
+{
+  int nFail = 0;
+  int nRecord = 0;
+  bench_opt opt = {10000, 5000, 5, 20, 1, 1, {1}, NULL};
+  FILE* fp = NULL;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strcmp(argv[i], "-v") == 0)
+    {
+      opt.isQuiet = 0;
+    }
+    else if (i + 1 < argc && strcmp(argv[i], "-o") == 0)
+    {
+      opt.outfile = argv[++i];
+    }
+    else if (i + 1 < argc && strcmp(argv[i], "-s") == 0)
+    {
+      if (BENCH_parseScales(&opt, argv[++i]))
+      {
+        BENCH_usage(argv[0]);
+        return 1;
+      }
+    }
+    else if (i + 1 < argc && strlen(argv[i]) == 2 && argv[i][0] == '-' && strchr("nmkr", argv[i][1]))
+    {
+      int value = atoi(argv[++i]);
+      switch (argv[i - 1][1])
+      {
+      case 'n':
+        opt.nCol = value;
+        break;
+      case 'm':
+        opt.nRow = value;
+        break;
+      case 'k':
+        opt.nColElem = value;
+        break;
+      default:
+        opt.nRepeat = value;
+        break;
+      }
+    }
+    else
+    {
+      BENCH_usage(argv[0]);
+      return 1;
+    }
+  }
+
+  if (opt.nCol <= 0 || opt.nRow <= 0 || opt.nColElem <= 0 || opt.nRepeat <= 0)
+  {
+    BENCH_usage(argv[0]);
+    return 1;
+  }
+
+  if (opt.outfile != NULL)
+  {
+    fp = fopen(opt.outfile, "w");
+    if (fp == NULL)
+    {
+      fprintf(stderr, "Failed to open '%s' for writing\n", opt.outfile);
+      return 1;
+    }
+    fprintf(fp, "{\n  \"bench\": \"coptmex\",\n  \"results\": [\n");
+  }
+
+  MEXSHIM_setQuiet(opt.isQuiet);
+
+  for (int i = 0; i < opt.nScale && nFail == 0; ++i)
+  {
+    nFail += BENCH_runScale(&opt, opt.scales[i], fp, &nRecord);
+  }
+
+  if (fp != NULL)
+  {
+    fprintf(fp, "\n  ],\n  \"maxrss\": %.0f\n}\n", BENCH_getMaxRSS());
+    fclose(fp);
+  }
+
+  printf("\nPeak resident set size: %.1f MB\n", BENCH_getMaxRSS() / (1024.0 * 1024.0));
+  MEXSHIM_exit();
+
+  if (nFail > 0)
+  {
+    fprintf(stderr, "Benchmark failed\n");
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,260 @@
+function results = coptmex_bench(outfile, repeats, scales)
+% coptmex_bench
+%
+% results = coptmex_bench()
+% results = coptmex_bench(outfile)
+% results = coptmex_bench(outfile, repeats)
+% results = coptmex_bench(outfile, repeats, scales)
+%
+% This function benchmarks the COPT MATLAB interface end to end, over the
+% example models shipped in examples and over synthetic LP and MIP models of
+% increasing size. Every operation is repeated and the median and 95th
+% percentile of the wall time and of each phase reported by the Timing
+% parameter are collected, together with the bytes allocated by the
+% interface for model and result data (field 'allocbytes') and the peak
+% memory of the MATLAB process (field 'peakbytes'). On Linux the peak is the
+% resident high-water mark, reset before each operation where the kernel
+% allows it. On Windows it is the largest memory used by MATLAB after a run,
+% and on other platforms it is not recorded.
+%
+% Input arguments:
+% -----------------
+% outfile (optional):
+%   Name of JSON file to write results to (default: 'bench_results.json').
+%
+% repeats (optional):
+%   Number of timed repetitions of every operation (default: 10).
+%
+% scales (optional):
+%   Vector of scale factors of the synthetic models (default: [1, 2, 4]).
+%
+% Output arguments:
+% ------------------
+% results:
+%   A MATLAB struct array with one element per benchmarked operation.
+%
+% Examples usages:
+% -----------------
+% addpath('../lib');
+% results = coptmex_bench('bench_results.json', 20, [1, 4, 16]);
+
+if nargin < 1 || isempty(outfile)
+  outfile = 'bench_results.json';
+end
+if nargin < 2 || isempty(repeats)
+  repeats = 10;
+end
+if nargin < 3 || isempty(scales)
+  scales = [1, 2, 4];
+end
+
+param.Logging = 0;
+param.Timing = 1;
+
+results = struct([]);
+
+% Example models shipped with the interface
+exdir = fullfile(fileparts(mfilename('fullpath')), '..', 'examples');
+exfiles = {'misc07.mps.gz', 'itest6.mps.gz', 'mra01.cbf.gz', 'conic.cbf', 'sdp.dat-s'};
+
+for i = 1:numel(exfiles)
+  probfile = fullfile(exdir, exfiles{i});
+  if ~exist(probfile, 'file')
+    continue;
+  end
+
+  results = bench_case(results, exfiles{i}, 'solve-file', repeats, ...
+                       @() copt_solve(probfile, param));
+
+  % Not every model can be converted to a MATLAB struct, e.g. SDP
+  try
+    problem = copt_read(probfile);
+  catch
+    continue;
+  end
+  isconic = isfield(problem, 'cone') || isfield(problem, 'expcone') || ...
+            isfield(problem, 'affcone');
+
+  results = bench_case(results, exfiles{i}, 'read', repeats, ...
+                       @() copt_read(probfile));
+  results = bench_case(results, exfiles{i}, 'solve-struct', repeats, ...
+                       @() copt_solve(problem, param));
+  results = bench_case(results, exfiles{i}, 'write-buffer', repeats, ...
+                       @() copt_write(problem, 'bin'));
+
+  % IIS is only available for linear and mixed integer problems
+  if ~isconic
+    results = bench_case(results, exfiles{i}, 'computeiis', repeats, ...
+                         @() copt_computeiis(problem, param));
+  end
+end
+
+% Synthetic models of increasing size
+for s = scales
+  n = 2000 * s;
+  m = 1000 * s;
+  lp = bench_genmodel(n, m, false);
+  mip = bench_genmodel(n, m, true);
+  buffer = copt_write(lp, 'bin');
+  name = sprintf('synthetic-%gx', s);
+
+  results = bench_case(results, name, 'solve-lp', repeats, ...
+                       @() copt_solve(lp, param));
+  results = bench_case(results, name, 'solve-mip', repeats, ...
+                       @() copt_solve(mip, param));
+  results = bench_case(results, name, 'solve-buffer', repeats, ...
+                       @() copt_solve(buffer, 'bin', param));
+  results = bench_case(results, name, 'write-buffer', repeats, ...
+                       @() copt_write(lp, 'bin'));
+  results = bench_case(results, name, 'read-buffer', repeats, ...
+                       @() copt_read(buffer, 'bin'));
+
+  % The kept problem grows by one batch of 10 columns per call
+  [~, handle] = copt_solve(lp, param);
+  cols = bench_genmodel(10, m, false);
+  results = bench_case(results, name, 'addcols', repeats, ...
+                       @() copt_addcols(handle, cols.obj, cols.A, cols.lb, cols.ub));
+  copt_free(handle);
+
+  % The kept problem grows by one batch of 5 cuts per call
+  [~, handle] = copt_solve(lp, param);
+  cuts = sprand(5, n, 1 / 5);
+  results = bench_case(results, name, 'addrows', repeats, ...
+                       @() copt_addrows(handle, cuts, repmat('L', 5, 1), ...
+                                        10 * full(sum(cuts, 2)) + 1));
+  copt_free(handle);
+end
+
+fid = fopen(outfile, 'w');
+if fid < 0
+  error('coptmex_bench: failed to open ''%s''', outfile);
+end
+fprintf(fid, '%s\n', jsonencode(struct('bench', 'coptmex', 'results', results)));
+fclose(fid);
+fprintf('Results written to ''%s''\n', outfile);
+
+end
+
+function results = bench_case(results, model, name, repeats, func)
+% Run one operation once untimed, then repeatedly, and append its statistics
+
+times = zeros(repeats, 1);
+phases = struct();
+allocbytes = [];
+peakbytes = bench_peakmem(true);
+
+out = func();
+for k = 1:repeats
+  tic;
+  out = func();
+  times(k) = toc;
+  peakbytes = max([peakbytes, bench_peakmem(false)]);
+
+  % Only solve results report the breakdown of phases
+  if isstruct(out) && isfield(out, 'timing')
+    names = fieldnames(out.timing);
+    for j = 1:numel(names)
+      if strcmp(names{j}, 'total')
+        continue;
+      elseif strcmp(names{j}, 'bytes')
+        allocbytes(end+1, 1) = bench_sumbytes(out.timing.bytes);
+      else
+        if ~isfield(phases, names{j})
+          phases.(names{j}) = zeros(repeats, 1);
+        end
+        phases.(names{j})(k) = out.timing.(names{j});
+      end
+    end
+  end
+end
+
+rec.model = model;
+rec.case = name;
+rec.repeats = repeats;
+rec.time = bench_stat(times);
+rec.phases = structfun(@bench_stat, phases, 'UniformOutput', false);
+% Bytes allocated in all phases of a run, the largest over runs, which is
+% a volume of allocations rather than the peak memory of the process
+if isempty(allocbytes)
+  rec.allocbytes = [];
+else
+  rec.allocbytes = max(allocbytes);
+end
+rec.peakbytes = peakbytes;
+
+fprintf('%-16s %-14s median %10.3f ms  p95 %10.3f ms\n', model, name, ...
+        1e3 * rec.time.median, 1e3 * rec.time.p95);
+
+if isempty(results)
+  results = rec;
+else
+  results(end+1) = rec;
+end
+
+end
+
+function stat = bench_stat(x)
+% Median and 95th percentile by nearest rank
+
+x = sort(x(:));
+stat.median = median(x);
+stat.p95 = x(max(1, ceil(0.95 * numel(x))));
+
+end
+
+function bytes = bench_peakmem(reset)
+% Peak memory of the MATLAB process in bytes, or [] if not available
+
+bytes = [];
+if ispc
+  user = memory();
+  bytes = user.MemUsedMATLAB;
+elseif isunix && ~ismac
+  % Writing 5 to clear_refs resets the high-water mark on Linux 4.0 and later
+  if reset
+    fid = fopen('/proc/self/clear_refs', 'w');
+    if fid >= 0
+      fprintf(fid, '5');
+      fclose(fid);
+    end
+  end
+  fid = fopen('/proc/self/status', 'r');
+  if fid >= 0
+    status = fread(fid, inf, '*char')';
+    fclose(fid);
+    tok = regexp(status, 'VmHWM:\s*(\d+)\s*kB', 'tokens', 'once');
+    if ~isempty(tok)
+      bytes = 1024 * str2double(tok{1});
+    end
+  end
+end
+
+end
+
+function total = bench_sumbytes(bytes)
+% Total bytes over all phases reported by the Timing parameter
+
+if isstruct(bytes)
+  total = sum(cellfun(@double, struct2cell(bytes)));
+else
+  total = sum(double(bytes(:)));
+end
+
+end
+
+function problem = bench_genmodel(n, m, isint)
+% Random feasible model with 5 non-zeros per column
+
+rng(1);
+problem.objsen = 'Minimize';
+problem.A = sprand(m, n, 5 / m);
+problem.obj = rand(n, 1);
+problem.lb = zeros(n, 1);
+problem.ub = 10 * ones(n, 1);
+problem.sense = repmat('L', m, 1);
+problem.rhs = 10 * full(sum(problem.A, 2)) + 1;
+if isint
+  problem.vtype = repmat('I', n, 1);
+end
+
+end
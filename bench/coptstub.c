@@ -0,0 +1,2420 @@
+/*
+ * Stub implementation of the COPT C API used by the MEX interface.
+ *
+ * The stub records the loaded model and answers every query from that record,
+ * so that the cost of the interface layer itself (argument checking, format
+ * conversion, result extraction) can be measured without a solver license.
+ * Solve produces a synthetic solution: every column is set to the value in
+ * its bounds closest to zero, rows report their activity, duals are zero and
+ * reduced costs equal the objective. All model files are written and read in
+ * a private binary format, so only files written by the stub can be read back.
+ */
+
+/* Expose clock_gettime and strdup declarations under -std=c99 */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "copt.h"
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define STUB_MAGIC "COPTSTUB"
+
+typedef struct stub_param_s
+{
+  const char* name;
+  int type;
+  double def;
+  double lb;
+  double ub;
+} stub_param;
+
+static const stub_param STUB_paramTable[] = {
+  /* Double parameters */
+  {COPT_DBLPARAM_TIMELIMIT, 0, 1e20, 0.0, 1e20},
+  {COPT_DBLPARAM_SOLTIMELIMIT, 0, 1e20, 0.0, 1e20},
+  {COPT_DBLPARAM_MATRIXTOL, 0, 1e-10, 0.0, 1e-7},
+  {COPT_DBLPARAM_FEASTOL, 0, 1e-6, 1e-9, 1e-4},
+  {COPT_DBLPARAM_DUALTOL, 0, 1e-6, 1e-9, 1e-4},
+  {COPT_DBLPARAM_INTTOL, 0, 1e-6, 1e-9, 1e-1},
+  {COPT_DBLPARAM_PDLPTOL, 0, 1e-6, 1e-12, 1e-1},
+  {COPT_DBLPARAM_RELGAP, 0, 1e-4, 0.0, COPT_INFINITY},
+  {COPT_DBLPARAM_ABSGAP, 0, 1e-6, 0.0, COPT_INFINITY},
+  {COPT_DBLPARAM_TUNETIMELIMIT, 0, 0.0, 0.0, 1e20},
+  {COPT_DBLPARAM_TUNETARGETTIME, 0, 1e-2, 0.0, COPT_INFINITY},
+  {COPT_DBLPARAM_TUNETARGETRELGAP, 0, 1e-4, 0.0, COPT_INFINITY},
+  /* Integer parameters */
+  {COPT_INTPARAM_LOGGING, 1, 1, 0, 1},
+  {COPT_INTPARAM_LOGTOCONSOLE, 1, 1, 0, 1},
+  {COPT_INTPARAM_PRESOLVE, 1, -1, -1, 5},
+  {COPT_INTPARAM_SCALING, 1, -1, -1, 1},
+  {COPT_INTPARAM_DUALIZE, 1, -1, -1, 1},
+  {COPT_INTPARAM_LPMETHOD, 1, -1, -1, 6},
+  {COPT_INTPARAM_GPUMODE, 1, 0, 0, 1},
+  {COPT_INTPARAM_GPUDEVICE, 1, -1, -1, 2147483647},
+  {COPT_INTPARAM_REQFARKASRAY, 1, 0, 0, 1},
+  {COPT_INTPARAM_DUALPRICE, 1, -1, -1, 1},
+  {COPT_INTPARAM_DUALPERTURB, 1, -1, -1, 1},
+  {COPT_INTPARAM_CUTLEVEL, 1, -1, -1, 3},
+  {COPT_INTPARAM_ROOTCUTLEVEL, 1, -1, -1, 3},
+  {COPT_INTPARAM_TREECUTLEVEL, 1, -1, -1, 3},
+  {COPT_INTPARAM_ROOTCUTROUNDS, 1, -1, -1, 2147483647},
+  {COPT_INTPARAM_NODECUTROUNDS, 1, -1, -1, 2147483647},
+  {COPT_INTPARAM_HEURLEVEL, 1, -1, -1, 3},
+  {COPT_INTPARAM_ROUNDINGHEURLEVEL, 1, -1, -1, 3},
+  {COPT_INTPARAM_DIVINGHEURLEVEL, 1, -1, -1, 3},
+  {COPT_INTPARAM_FAPHEURLEVEL, 1, -1, -1, 3},
+  {COPT_INTPARAM_SUBMIPHEURLEVEL, 1, -1, -1, 3},
+  {COPT_INTPARAM_STRONGBRANCHING, 1, -1, -1, 3},
+  {COPT_INTPARAM_CONFLICTANALYSIS, 1, -1, -1, 1},
+  {COPT_INTPARAM_NODELIMIT, 1, -1, -1, 2147483647},
+  {COPT_INTPARAM_MIPTASKS, 1, -1, -1, 256},
+  {COPT_INTPARAM_BARHOMOGENEOUS, 1, -1, -1, 1},
+  {COPT_INTPARAM_BARORDER, 1, -1, -1, 1},
+  {COPT_INTPARAM_BARSTART, 1, -1, -1, 2},
+  {COPT_INTPARAM_BARITERLIMIT, 1, 500, 0, 2147483647},
+  {COPT_INTPARAM_THREADS, 1, -1, -1, 128},
+  {COPT_INTPARAM_BARTHREADS, 1, -1, -1, 128},
+  {COPT_INTPARAM_SIMPLEXTHREADS, 1, -1, -1, 128},
+  {COPT_INTPARAM_CROSSOVERTHREADS, 1, -1, -1, 128},
+  {COPT_INTPARAM_CROSSOVER, 1, 1, 0, 1},
+  {COPT_INTPARAM_SDPMETHOD, 1, -1, -1, 2},
+  {COPT_INTPARAM_IISMETHOD, 1, -1, -1, 1},
+  {COPT_INTPARAM_FEASRELAXMODE, 1, 0, 0, 5},
+  {COPT_INTPARAM_MIPSTARTMODE, 1, -1, -1, 2},
+  {COPT_INTPARAM_MIPSTARTNODELIMIT, 1, -1, -1, 2147483647},
+  {COPT_INTPARAM_TUNEMETHOD, 1, -1, -1, 1},
+  {COPT_INTPARAM_TUNEMODE, 1, -1, -1, 3},
+  {COPT_INTPARAM_TUNEMEASURE, 1, -1, -1, 1},
+  {COPT_INTPARAM_TUNEPERMUTES, 1, 0, 0, 2147483647},
+  {COPT_INTPARAM_TUNEOUTPUTLEVEL, 1, 2, 0, 3},
+  {COPT_INTPARAM_LAZYCONSTRAINTS, 1, -1, -1, 1},
+};
+
+#define STUB_NPARAM ((int) (sizeof(STUB_paramTable) / sizeof(STUB_paramTable[0])))
+
+struct copt_env_s
+{
+  int nProb;
+};
+
+struct copt_prob_s
+{
+  copt_env* env;
+  double paramValue[STUB_NPARAM];
+
+  /* Linear part */
+  int nCol;
+  int nRow;
+  int nElem;
+  int nObjSense;
+  double dObjConst;
+  double* colObj;
+  double* colLower;
+  double* colUpper;
+  char* colType;
+  int* colMatBeg;
+  int* colMatIdx;
+  double* colMatElem;
+  double* rowLower;
+  double* rowUpper;
+  char** colNames;
+  char** rowNames;
+
+  /* SOS constraints */
+  int nSos;
+  int nSosCap;
+  int nSosElem;
+  int nSosElemCap;
+  int* sosType;
+  int* sosBeg;
+  int* sosCnt;
+  int* sosIdx;
+  double* sosWt;
+
+  /* Indicator constraints */
+  int nIndicator;
+  int nIndicatorCap;
+  int nIndicatorElem;
+  int nIndicatorElemCap;
+  int* indBinIdx;
+  int* indBinVal;
+  int* indBeg;
+  int* indCnt;
+  int* indIdx;
+  double* indElem;
+  char* indSense;
+  double* indBound;
+
+  /* Second-order and exponential cones */
+  int nCone;
+  int nConeCap;
+  int nConeElem;
+  int nConeElemCap;
+  int* coneType;
+  int* coneBeg;
+  int* coneCnt;
+  int* coneIdx;
+  int nExpCone;
+  int nExpConeCap;
+  int* expConeType;
+  int* expConeIdx;
+
+  /* Only counted, queries return empty constraints */
+  int nAffCone;
+  int nQConstr;
+
+  /* Quadratic objective */
+  int nQElem;
+  int* qRow;
+  int* qCol;
+  double* qElem;
+
+  /* Synthetic solution */
+  int isMIP;
+  int hasSol;
+  int hasIIS;
+  int hasRelax;
+  int nLpStatus;
+  int nMipStatus;
+  int nMipStart;
+  double dObjVal;
+  double dSolvingTime;
+  double* colValue;
+  double* rowSlack;
+
+  int(COPT_CALL* cbfunc)(copt_prob*, void*, int, void*);
+  int cbctx;
+  int nCbRow;
+  void* cbdata;
+  void(COPT_CALL* logfunc)(char*, void*);
+  void* logdata;
+};
+
+static int STUB_strcmp(const char* a, const char* b)
+{
+  while (*a && tolower((unsigned char) *a) == tolower((unsigned char) *b))
+  {
+    a++;
+    b++;
+  }
+  return tolower((unsigned char) *a) - tolower((unsigned char) *b);
+}
+
+static double STUB_getWallTime(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Capacity of growing arrays holding at least 'need' elements */
+static int STUB_getCap(int cap, int need)
+{
+  int ncap = cap > 0 ? cap : 8;
+  while (ncap < need)
+  {
+    ncap *= 2;
+  }
+  return ncap;
+}
+
+/* Reallocate growing array to the given capacity */
+static int STUB_grow(void** data, int cap, size_t size)
+{
+  void* ndata = realloc(*data, cap * size);
+  if (!ndata)
+  {
+    return COPT_RETCODE_MEMORY;
+  }
+  *data = ndata;
+  return COPT_RETCODE_OK;
+}
+
+static void STUB_freeNames(char** names, int num)
+{
+  if (names != NULL)
+  {
+    for (int i = 0; i < num; ++i)
+    {
+      free(names[i]);
+    }
+    free(names);
+  }
+}
+
+static void STUB_clearSolution(copt_prob* prob)
+{
+  free(prob->colValue);
+  free(prob->rowSlack);
+  prob->colValue = NULL;
+  prob->rowSlack = NULL;
+  prob->hasSol = 0;
+  prob->hasIIS = 0;
+  prob->hasRelax = 0;
+  prob->nLpStatus = COPT_LPSTATUS_UNSTARTED;
+  prob->nMipStatus = COPT_MIPSTATUS_UNSTARTED;
+  prob->dObjVal = 0.0;
+}
+
+static void STUB_clearModel(copt_prob* prob)
+{
+  STUB_clearSolution(prob);
+
+  free(prob->colObj);
+  free(prob->colLower);
+  free(prob->colUpper);
+  free(prob->colType);
+  free(prob->colMatBeg);
+  free(prob->colMatIdx);
+  free(prob->colMatElem);
+  free(prob->rowLower);
+  free(prob->rowUpper);
+  STUB_freeNames(prob->colNames, prob->nCol);
+  STUB_freeNames(prob->rowNames, prob->nRow);
+
+  free(prob->sosType);
+  free(prob->sosBeg);
+  free(prob->sosCnt);
+  free(prob->sosIdx);
+  free(prob->sosWt);
+
+  free(prob->indBinIdx);
+  free(prob->indBinVal);
+  free(prob->indBeg);
+  free(prob->indCnt);
+  free(prob->indIdx);
+  free(prob->indElem);
+  free(prob->indSense);
+  free(prob->indBound);
+
+  free(prob->coneType);
+  free(prob->coneBeg);
+  free(prob->coneCnt);
+  free(prob->coneIdx);
+  free(prob->expConeType);
+  free(prob->expConeIdx);
+
+  free(prob->qRow);
+  free(prob->qCol);
+  free(prob->qElem);
+
+  {
+    copt_env* env = prob->env;
+    double paramValue[STUB_NPARAM];
+    int(COPT_CALL * cbfunc)(copt_prob*, void*, int, void*) = prob->cbfunc;
+    int cbctx = prob->cbctx;
+    void* cbdata = prob->cbdata;
+    void(COPT_CALL * logfunc)(char*, void*) = prob->logfunc;
+    void* logdata = prob->logdata;
+
+    memcpy(paramValue, prob->paramValue, sizeof(paramValue));
+    memset(prob, 0, sizeof(copt_prob));
+    memcpy(prob->paramValue, paramValue, sizeof(paramValue));
+    prob->env = env;
+    prob->cbfunc = cbfunc;
+    prob->cbctx = cbctx;
+    prob->cbdata = cbdata;
+    prob->logfunc = logfunc;
+    prob->logdata = logdata;
+  }
+
+  prob->nObjSense = COPT_MINIMIZE;
+  prob->nLpStatus = COPT_LPSTATUS_UNSTARTED;
+  prob->nMipStatus = COPT_MIPSTATUS_UNSTARTED;
+}
+
+static char** STUB_copyNames(char const* const* names, int num)
+{
+  char** copy = NULL;
+
+  if (names == NULL || num == 0)
+  {
+    return NULL;
+  }
+
+  copy = (char**) calloc(num, sizeof(char*));
+  if (copy != NULL)
+  {
+    for (int i = 0; i < num; ++i)
+    {
+      copy[i] = strdup(names[i] != NULL ? names[i] : "");
+    }
+  }
+  return copy;
+}
+
+static void STUB_log(copt_prob* prob, const char* msg)
+{
+  int nLogging = 1;
+
+  for (int i = 0; i < STUB_NPARAM; ++i)
+  {
+    if (STUB_strcmp(STUB_paramTable[i].name, COPT_INTPARAM_LOGGING) == 0)
+    {
+      nLogging = (int) prob->paramValue[i];
+    }
+  }
+
+  if (nLogging && prob->logfunc != NULL)
+  {
+    prob->logfunc((char*) msg, prob->logdata);
+  }
+}
+
+/* Environment and problem */
+int COPT_CALL COPT_CreateEnv(copt_env** p_env)
+{
+  *p_env = (copt_env*) calloc(1, sizeof(copt_env));
+  return *p_env != NULL ? COPT_RETCODE_OK : COPT_RETCODE_MEMORY;
+}
+
+int COPT_CALL COPT_DeleteEnv(copt_env** p_env)
+{
+  if (p_env != NULL)
+  {
+    free(*p_env);
+    *p_env = NULL;
+  }
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_CreateProb(copt_env* env, copt_prob** p_prob)
+{
+  copt_prob* prob = (copt_prob*) calloc(1, sizeof(copt_prob));
+  if (!prob)
+  {
+    return COPT_RETCODE_MEMORY;
+  }
+
+  prob->env = env;
+  for (int i = 0; i < STUB_NPARAM; ++i)
+  {
+    prob->paramValue[i] = STUB_paramTable[i].def;
+  }
+  STUB_clearModel(prob);
+  env->nProb++;
+
+  *p_prob = prob;
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_DeleteProb(copt_prob** p_prob)
+{
+  if (p_prob != NULL && *p_prob != NULL)
+  {
+    STUB_clearModel(*p_prob);
+    (*p_prob)->env->nProb--;
+    free(*p_prob);
+    *p_prob = NULL;
+  }
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetBanner(char* buff, int buffSize)
+{
+  snprintf(buff, buffSize, "Cardinal Optimizer API stub, for benchmarking the MEX interface only\n");
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetRetcodeMsg(int code, char* buff, int buffSize)
+{
+  const char* msg = "Unknown error";
+
+  if (code == COPT_RETCODE_OK)
+  {
+    msg = "No error";
+  }
+  else if (code == COPT_RETCODE_MEMORY)
+  {
+    msg = "Memory allocation failure";
+  }
+  else if (code == COPT_RETCODE_FILE)
+  {
+    msg = "File I/O error or unsupported file format";
+  }
+  else if (code == COPT_RETCODE_INVALID)
+  {
+    msg = "Invalid data or feature not supported by stub";
+  }
+
+  snprintf(buff, buffSize, "%s", msg);
+  return COPT_RETCODE_OK;
+}
+
+/* Model loading */
+int COPT_CALL COPT_LoadProb(copt_prob* prob, int nCol, int nRow, int iObjSense, double dObjConst,
+                            const double* colObj, const int* colMatBeg, const int* colMatCnt, const int* colMatIdx,
+                            const double* colMatElem, const char* colType, const double* colLower,
+                            const double* colUpper, const char* rowSense, const double* rowBound,
+                            const double* rowUpper, char const* const* colNames, char const* const* rowNames)
+{
+  int nElem = 0;
+
+  STUB_clearModel(prob);
+
+  for (int j = 0; j < nCol; ++j)
+  {
+    nElem += colMatCnt != NULL ? colMatCnt[j] : colMatBeg[j + 1] - colMatBeg[j];
+  }
+
+  prob->nCol = nCol;
+  prob->nRow = nRow;
+  prob->nElem = nElem;
+  prob->nObjSense = iObjSense;
+  prob->dObjConst = dObjConst;
+  prob->colObj = (double*) calloc(nCol + 1, sizeof(double));
+  prob->colLower = (double*) calloc(nCol + 1, sizeof(double));
+  prob->colUpper = (double*) calloc(nCol + 1, sizeof(double));
+  prob->colType = (char*) calloc(nCol + 1, sizeof(char));
+  prob->colMatBeg = (int*) calloc(nCol + 1, sizeof(int));
+  prob->colMatIdx = (int*) calloc(nElem + 1, sizeof(int));
+  prob->colMatElem = (double*) calloc(nElem + 1, sizeof(double));
+  prob->rowLower = (double*) calloc(nRow + 1, sizeof(double));
+  prob->rowUpper = (double*) calloc(nRow + 1, sizeof(double));
+  if (!prob->colObj || !prob->colLower || !prob->colUpper || !prob->colType || !prob->colMatBeg ||
+      !prob->colMatIdx || !prob->colMatElem || !prob->rowLower || !prob->rowUpper)
+  {
+    STUB_clearModel(prob);
+    return COPT_RETCODE_MEMORY;
+  }
+
+  nElem = 0;
+  for (int j = 0; j < nCol; ++j)
+  {
+    int beg = colMatBeg[j];
+    int cnt = colMatCnt != NULL ? colMatCnt[j] : colMatBeg[j + 1] - colMatBeg[j];
+
+    prob->colObj[j] = colObj != NULL ? colObj[j] : 0.0;
+    prob->colLower[j] = colLower != NULL ? colLower[j] : 0.0;
+    prob->colUpper[j] = colUpper != NULL ? colUpper[j] : COPT_INFINITY;
+    prob->colType[j] = colType != NULL ? colType[j] : COPT_CONTINUOUS;
+    prob->colMatBeg[j] = nElem;
+    memcpy(prob->colMatIdx + nElem, colMatIdx + beg, cnt * sizeof(int));
+    memcpy(prob->colMatElem + nElem, colMatElem + beg, cnt * sizeof(double));
+    nElem += cnt;
+  }
+  prob->colMatBeg[nCol] = nElem;
+
+  for (int i = 0; i < nRow; ++i)
+  {
+    if (rowSense == NULL)
+    {
+      prob->rowLower[i] = rowBound[i];
+      prob->rowUpper[i] = rowUpper[i];
+      continue;
+    }
+
+    switch (rowSense[i])
+    {
+    case COPT_LESS_EQUAL:
+      prob->rowLower[i] = -COPT_INFINITY;
+      prob->rowUpper[i] = rowBound[i];
+      break;
+    case COPT_GREATER_EQUAL:
+      prob->rowLower[i] = rowBound[i];
+      prob->rowUpper[i] = COPT_INFINITY;
+      break;
+    case COPT_EQUAL:
+      prob->rowLower[i] = rowBound[i];
+      prob->rowUpper[i] = rowBound[i];
+      break;
+    case COPT_RANGE:
+      prob->rowLower[i] = rowBound[i] - (rowUpper != NULL ? rowUpper[i] : 0.0);
+      prob->rowUpper[i] = rowBound[i];
+      break;
+    default:
+      prob->rowLower[i] = -COPT_INFINITY;
+      prob->rowUpper[i] = COPT_INFINITY;
+      break;
+    }
+  }
+
+  prob->colNames = STUB_copyNames(colNames, nCol);
+  prob->rowNames = STUB_copyNames(rowNames, nRow);
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_LoadConeProb(copt_prob* prob, int nCol, int nRow, int nFree, int nPositive, int nBox, int nCone,
+                                int nRotateCone, int nPrimalExp, int nDualExp, int nPrimalPow, int nDualPow,
+                                int nPSD, int nQObjElem, int iObjSense, double dObjConst, const double* colObj,
+                                const int* qObjRow, const int* qObjCol, const double* qObjElem,
+                                const int* colMatBeg, const int* colMatCnt, const int* colMatIdx,
+                                const double* colMatElem, const double* rowRhs, const double* boxLower,
+                                const double* boxUpper, const int* coneDim, const int* rotateConeDim,
+                                const int* primalPowDim, const int* dualPowDim, const double* primalPowAlpha,
+                                const double* dualPowAlpha, const int* psdDim, const char* colType,
+                                char const* const* colNames, char const* const* rowNames,
+                                char const* const* psdColNames, int* outRowMap)
+{
+  int retcode = COPT_RETCODE_OK;
+  int iCol = 0;
+  double* colLower = NULL;
+  double* colUpper = NULL;
+
+  if (nBox > 0 || nPrimalPow > 0 || nDualPow > 0 || nPSD > 0)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+
+  colLower = (double*) calloc(nCol + 1, sizeof(double));
+  colUpper = (double*) calloc(nCol + 1, sizeof(double));
+  if (!colLower || !colUpper)
+  {
+    free(colLower);
+    free(colUpper);
+    return COPT_RETCODE_MEMORY;
+  }
+
+  for (int j = 0; j < nCol; ++j)
+  {
+    colLower[j] = (j >= nFree && j < nFree + nPositive) ? 0.0 : -COPT_INFINITY;
+    colUpper[j] = COPT_INFINITY;
+  }
+
+  retcode = COPT_LoadProb(prob, nCol, nRow, iObjSense, dObjConst, colObj, colMatBeg, colMatCnt, colMatIdx,
+                          colMatElem, colType, colLower, colUpper, NULL, rowRhs, rowRhs, colNames, rowNames);
+  free(colLower);
+  free(colUpper);
+  if (retcode != COPT_RETCODE_OK)
+  {
+    return retcode;
+  }
+
+  iCol = nFree + nPositive;
+  for (int i = 0; i < nCone + nRotateCone && retcode == COPT_RETCODE_OK; ++i)
+  {
+    int type = i < nCone ? COPT_CONE_QUAD : COPT_CONE_RQUAD;
+    int dim = i < nCone ? coneDim[i] : rotateConeDim[i - nCone];
+    int beg = 0;
+    int* idx = (int*) calloc(dim + 1, sizeof(int));
+
+    if (!idx)
+    {
+      return COPT_RETCODE_MEMORY;
+    }
+    for (int k = 0; k < dim; ++k)
+    {
+      idx[k] = iCol++;
+    }
+    retcode = COPT_AddCones(prob, 1, &type, &beg, &dim, idx);
+    free(idx);
+  }
+
+  for (int i = 0; i < nPrimalExp + nDualExp && retcode == COPT_RETCODE_OK; ++i)
+  {
+    int type = i < nPrimalExp ? COPT_EXPCONE_PRIMAL : COPT_EXPCONE_DUAL;
+    int idx[3] = {iCol, iCol + 1, iCol + 2};
+
+    iCol += 3;
+    retcode = COPT_AddExpCones(prob, 1, &type, idx);
+  }
+
+  if (retcode == COPT_RETCODE_OK && nQObjElem > 0)
+  {
+    retcode = COPT_SetQuadObj(prob, nQObjElem, qObjRow, qObjCol, qObjElem);
+  }
+
+  if (outRowMap != NULL)
+  {
+    for (int i = 0; i < nRow; ++i)
+    {
+      outRowMap[i] = i;
+    }
+  }
+
+  return retcode;
+}
+
+int COPT_CALL COPT_AddCols(copt_prob* prob, int nAddCol, const double* colObj, const int* colMatBeg,
+                           const int* colMatCnt, const int* colMatIdx, const double* colMatElem, const char* colType,
+                           const double* colLower, const double* colUpper, char const* const* colNames)
+{
+  int nCol = prob->nCol + nAddCol;
+  int nElem = prob->nElem;
+
+  for (int j = 0; j < nAddCol; ++j)
+  {
+    nElem += colMatCnt != NULL ? colMatCnt[j] : colMatBeg[j + 1] - colMatBeg[j];
+  }
+
+  // Arrays are exactly sized by COPT_LoadProb, so they grow to the new size
+  if (STUB_grow((void**) &prob->colObj, nCol + 1, sizeof(double)) ||
+      STUB_grow((void**) &prob->colLower, nCol + 1, sizeof(double)) ||
+      STUB_grow((void**) &prob->colUpper, nCol + 1, sizeof(double)) ||
+      STUB_grow((void**) &prob->colType, nCol + 1, sizeof(char)) ||
+      STUB_grow((void**) &prob->colMatBeg, nCol + 1, sizeof(int)) ||
+      STUB_grow((void**) &prob->colMatIdx, nElem + 1, sizeof(int)) ||
+      STUB_grow((void**) &prob->colMatElem, nElem + 1, sizeof(double)) ||
+      (prob->colNames != NULL && STUB_grow((void**) &prob->colNames, nCol, sizeof(char*))))
+  {
+    return COPT_RETCODE_MEMORY;
+  }
+
+  if (prob->colNames != NULL)
+  {
+    for (int j = 0; j < nAddCol; ++j)
+    {
+      const char* name = colNames != NULL ? colNames[j] : NULL;
+      prob->colNames[prob->nCol + j] = name != NULL ? strdup(name) : NULL;
+    }
+  }
+
+  nElem = prob->nElem;
+  for (int j = 0; j < nAddCol; ++j)
+  {
+    int iCol = prob->nCol + j;
+    int beg = colMatBeg[j];
+    int cnt = colMatCnt != NULL ? colMatCnt[j] : colMatBeg[j + 1] - colMatBeg[j];
+
+    prob->colObj[iCol] = colObj != NULL ? colObj[j] : 0.0;
+    prob->colLower[iCol] = colLower != NULL ? colLower[j] : 0.0;
+    prob->colUpper[iCol] = colUpper != NULL ? colUpper[j] : COPT_INFINITY;
+    prob->colType[iCol] = colType != NULL ? colType[j] : COPT_CONTINUOUS;
+    prob->colMatBeg[iCol] = nElem;
+    memcpy(prob->colMatIdx + nElem, colMatIdx + beg, cnt * sizeof(int));
+    memcpy(prob->colMatElem + nElem, colMatElem + beg, cnt * sizeof(double));
+    nElem += cnt;
+  }
+  prob->colMatBeg[nCol] = nElem;
+
+  prob->nCol = nCol;
+  prob->nElem = nElem;
+  STUB_clearSolution(prob);
+
+  return COPT_RETCODE_OK;
+}
+
+/* Replace column-wise matrix, taking ownership of the new arrays */
+static void STUB_setMatrix(copt_prob* prob, int* colMatBeg, int* colMatIdx, double* colMatElem)
+{
+  free(prob->colMatBeg);
+  free(prob->colMatIdx);
+  free(prob->colMatElem);
+  prob->colMatBeg = colMatBeg;
+  prob->colMatIdx = colMatIdx;
+  prob->colMatElem = colMatElem;
+  prob->nElem = colMatBeg[prob->nCol];
+}
+
+int COPT_CALL COPT_AddRows(copt_prob* prob, int nAddRow, const int* rowMatBeg, const int* rowMatCnt,
+                           const int* rowMatIdx, const double* rowMatElem, const char* rowSense,
+                           const double* rowBound, const double* rowUpper, char const* const* rowNames)
+{
+  int nRow = prob->nRow + nAddRow;
+  int nAddElem = 0;
+  int* colCnt = NULL;
+  int* colMatBeg = NULL;
+  int* colMatIdx = NULL;
+  double* colMatElem = NULL;
+
+  for (int i = 0; i < nAddRow; ++i)
+  {
+    nAddElem += rowMatCnt != NULL ? rowMatCnt[i] : rowMatBeg[i + 1] - rowMatBeg[i];
+  }
+
+  colCnt = (int*) calloc(prob->nCol + 1, sizeof(int));
+  colMatBeg = (int*) calloc(prob->nCol + 1, sizeof(int));
+  colMatIdx = (int*) calloc(prob->nElem + nAddElem + 1, sizeof(int));
+  colMatElem = (double*) calloc(prob->nElem + nAddElem + 1, sizeof(double));
+  if (!colCnt || !colMatBeg || !colMatIdx || !colMatElem ||
+      STUB_grow((void**) &prob->rowLower, nRow + 1, sizeof(double)) ||
+      STUB_grow((void**) &prob->rowUpper, nRow + 1, sizeof(double)) ||
+      (prob->rowNames != NULL && STUB_grow((void**) &prob->rowNames, nRow, sizeof(char*))))
+  {
+    free(colCnt);
+    free(colMatBeg);
+    free(colMatIdx);
+    free(colMatElem);
+    return COPT_RETCODE_MEMORY;
+  }
+
+  // Rebuild the column-wise matrix with the new rows appended to each column
+  for (int i = 0; i < nAddRow; ++i)
+  {
+    int cnt = rowMatCnt != NULL ? rowMatCnt[i] : rowMatBeg[i + 1] - rowMatBeg[i];
+    for (int k = rowMatBeg[i]; k < rowMatBeg[i] + cnt; ++k)
+    {
+      colCnt[rowMatIdx[k]]++;
+    }
+  }
+  for (int j = 0; j < prob->nCol; ++j)
+  {
+    int nOld = prob->colMatBeg[j + 1] - prob->colMatBeg[j];
+    colMatBeg[j + 1] = colMatBeg[j] + nOld + colCnt[j];
+    memcpy(colMatIdx + colMatBeg[j], prob->colMatIdx + prob->colMatBeg[j], nOld * sizeof(int));
+    memcpy(colMatElem + colMatBeg[j], prob->colMatElem + prob->colMatBeg[j], nOld * sizeof(double));
+    colCnt[j] = colMatBeg[j] + nOld;
+  }
+  for (int i = 0; i < nAddRow; ++i)
+  {
+    int cnt = rowMatCnt != NULL ? rowMatCnt[i] : rowMatBeg[i + 1] - rowMatBeg[i];
+    for (int k = rowMatBeg[i]; k < rowMatBeg[i] + cnt; ++k)
+    {
+      colMatIdx[colCnt[rowMatIdx[k]]] = prob->nRow + i;
+      colMatElem[colCnt[rowMatIdx[k]]++] = rowMatElem[k];
+    }
+  }
+  STUB_setMatrix(prob, colMatBeg, colMatIdx, colMatElem);
+  free(colCnt);
+
+  for (int i = 0; i < nAddRow; ++i)
+  {
+    int iRow = prob->nRow + i;
+    char sense = rowSense != NULL ? rowSense[i] : COPT_RANGE;
+
+    prob->rowLower[iRow] = sense == COPT_LESS_EQUAL ? -COPT_INFINITY : rowBound[i];
+    prob->rowUpper[iRow] = sense == COPT_GREATER_EQUAL ? COPT_INFINITY :
+                           sense == COPT_RANGE && rowUpper != NULL ? rowUpper[i] : rowBound[i];
+    if (prob->rowNames != NULL)
+    {
+      prob->rowNames[iRow] = rowNames != NULL && rowNames[i] != NULL ? strdup(rowNames[i]) : NULL;
+    }
+  }
+
+  prob->nRow = nRow;
+  STUB_clearSolution(prob);
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_DelRows(copt_prob* prob, int num, const int* list)
+{
+  int nRow = 0;
+  int nElem = 0;
+  int* rowMap = (int*) calloc(prob->nRow + 1, sizeof(int));
+
+  if (!rowMap)
+  {
+    return COPT_RETCODE_MEMORY;
+  }
+
+  // Deleted rows are marked, the remaining ones are renumbered in order
+  for (int k = 0; k < num; ++k)
+  {
+    if (list[k] < 0 || list[k] >= prob->nRow)
+    {
+      free(rowMap);
+      return COPT_RETCODE_INVALID;
+    }
+    rowMap[list[k]] = -1;
+  }
+  for (int i = 0; i < prob->nRow; ++i)
+  {
+    if (rowMap[i] < 0)
+    {
+      if (prob->rowNames != NULL)
+      {
+        free(prob->rowNames[i]);
+      }
+      continue;
+    }
+    rowMap[i] = nRow;
+    prob->rowLower[nRow] = prob->rowLower[i];
+    prob->rowUpper[nRow] = prob->rowUpper[i];
+    if (prob->rowNames != NULL)
+    {
+      prob->rowNames[nRow] = prob->rowNames[i];
+    }
+    nRow++;
+  }
+
+  for (int j = 0; j < prob->nCol; ++j)
+  {
+    int beg = prob->colMatBeg[j];
+    prob->colMatBeg[j] = nElem;
+    for (int k = beg; k < prob->colMatBeg[j + 1]; ++k)
+    {
+      if (rowMap[prob->colMatIdx[k]] >= 0)
+      {
+        prob->colMatIdx[nElem] = rowMap[prob->colMatIdx[k]];
+        prob->colMatElem[nElem] = prob->colMatElem[k];
+        nElem++;
+      }
+    }
+  }
+  prob->colMatBeg[prob->nCol] = nElem;
+
+  prob->nRow = nRow;
+  prob->nElem = nElem;
+  free(rowMap);
+  STUB_clearSolution(prob);
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_AddSOSs(copt_prob* prob, int nAddSOS, const int* sosType, const int* sosMatBeg,
+                           const int* sosMatCnt, const int* sosMatIdx, const double* sosMatWt)
+{
+  int nAddElem = 0;
+
+  for (int i = 0; i < nAddSOS; ++i)
+  {
+    nAddElem += sosMatCnt[i];
+  }
+
+  if (prob->nSos + nAddSOS > prob->nSosCap)
+  {
+    int nCap = STUB_getCap(prob->nSosCap, prob->nSos + nAddSOS);
+    if (STUB_grow((void**) &prob->sosType, nCap, sizeof(int)) || STUB_grow((void**) &prob->sosBeg, nCap, sizeof(int)) ||
+        STUB_grow((void**) &prob->sosCnt, nCap, sizeof(int)))
+    {
+      return COPT_RETCODE_MEMORY;
+    }
+    prob->nSosCap = nCap;
+  }
+
+  if (prob->nSosElem + nAddElem > prob->nSosElemCap)
+  {
+    int nCap = STUB_getCap(prob->nSosElemCap, prob->nSosElem + nAddElem);
+    if (STUB_grow((void**) &prob->sosIdx, nCap, sizeof(int)) || STUB_grow((void**) &prob->sosWt, nCap, sizeof(double)))
+    {
+      return COPT_RETCODE_MEMORY;
+    }
+    prob->nSosElemCap = nCap;
+  }
+
+  for (int i = 0; i < nAddSOS; ++i)
+  {
+    prob->sosType[prob->nSos] = sosType[i];
+    prob->sosBeg[prob->nSos] = prob->nSosElem;
+    prob->sosCnt[prob->nSos] = sosMatCnt[i];
+    for (int k = 0; k < sosMatCnt[i]; ++k)
+    {
+      prob->sosIdx[prob->nSosElem] = sosMatIdx[sosMatBeg[i] + k];
+      prob->sosWt[prob->nSosElem] = sosMatWt != NULL ? sosMatWt[sosMatBeg[i] + k] : k + 1.0;
+      prob->nSosElem++;
+    }
+    prob->nSos++;
+  }
+
+  STUB_clearSolution(prob);
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_AddIndicator(copt_prob* prob, int binColIdx, int binColVal, int nRowMatCnt, const int* rowMatIdx,
+                                const double* rowMatElem, char cRowSense, double dRowBound)
+{
+  if (prob->nIndicator + 1 > prob->nIndicatorCap)
+  {
+    int nCap = STUB_getCap(prob->nIndicatorCap, prob->nIndicator + 1);
+    if (STUB_grow((void**) &prob->indBinIdx, nCap, sizeof(int)) ||
+        STUB_grow((void**) &prob->indBinVal, nCap, sizeof(int)) || STUB_grow((void**) &prob->indBeg, nCap, sizeof(int)) ||
+        STUB_grow((void**) &prob->indCnt, nCap, sizeof(int)) || STUB_grow((void**) &prob->indSense, nCap, sizeof(char)) ||
+        STUB_grow((void**) &prob->indBound, nCap, sizeof(double)))
+    {
+      return COPT_RETCODE_MEMORY;
+    }
+    prob->nIndicatorCap = nCap;
+  }
+
+  if (prob->nIndicatorElem + nRowMatCnt > prob->nIndicatorElemCap)
+  {
+    int nCap = STUB_getCap(prob->nIndicatorElemCap, prob->nIndicatorElem + nRowMatCnt);
+    if (STUB_grow((void**) &prob->indIdx, nCap, sizeof(int)) || STUB_grow((void**) &prob->indElem, nCap, sizeof(double)))
+    {
+      return COPT_RETCODE_MEMORY;
+    }
+    prob->nIndicatorElemCap = nCap;
+  }
+
+  prob->indBinIdx[prob->nIndicator] = binColIdx;
+  prob->indBinVal[prob->nIndicator] = binColVal;
+  prob->indBeg[prob->nIndicator] = prob->nIndicatorElem;
+  prob->indCnt[prob->nIndicator] = nRowMatCnt;
+  prob->indSense[prob->nIndicator] = cRowSense;
+  prob->indBound[prob->nIndicator] = dRowBound;
+  memcpy(prob->indIdx + prob->nIndicatorElem, rowMatIdx, nRowMatCnt * sizeof(int));
+  memcpy(prob->indElem + prob->nIndicatorElem, rowMatElem, nRowMatCnt * sizeof(double));
+  prob->nIndicatorElem += nRowMatCnt;
+  prob->nIndicator++;
+
+  STUB_clearSolution(prob);
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_AddCones(copt_prob* prob, int nAddCone, const int* coneType, const int* coneBeg,
+                            const int* coneCnt, const int* coneIdx)
+{
+  int nAddElem = 0;
+
+  for (int i = 0; i < nAddCone; ++i)
+  {
+    nAddElem += coneCnt[i];
+  }
+
+  if (prob->nCone + nAddCone > prob->nConeCap)
+  {
+    int nCap = STUB_getCap(prob->nConeCap, prob->nCone + nAddCone);
+    if (STUB_grow((void**) &prob->coneType, nCap, sizeof(int)) || STUB_grow((void**) &prob->coneBeg, nCap, sizeof(int)) ||
+        STUB_grow((void**) &prob->coneCnt, nCap, sizeof(int)))
+    {
+      return COPT_RETCODE_MEMORY;
+    }
+    prob->nConeCap = nCap;
+  }
+
+  if (prob->nConeElem + nAddElem > prob->nConeElemCap)
+  {
+    int nCap = STUB_getCap(prob->nConeElemCap, prob->nConeElem + nAddElem);
+    if (STUB_grow((void**) &prob->coneIdx, nCap, sizeof(int)))
+    {
+      return COPT_RETCODE_MEMORY;
+    }
+    prob->nConeElemCap = nCap;
+  }
+
+  for (int i = 0; i < nAddCone; ++i)
+  {
+    prob->coneType[prob->nCone] = coneType[i];
+    prob->coneBeg[prob->nCone] = prob->nConeElem;
+    prob->coneCnt[prob->nCone] = coneCnt[i];
+    memcpy(prob->coneIdx + prob->nConeElem, coneIdx + coneBeg[i], coneCnt[i] * sizeof(int));
+    prob->nConeElem += coneCnt[i];
+    prob->nCone++;
+  }
+
+  STUB_clearSolution(prob);
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_AddExpCones(copt_prob* prob, int nAddCone, const int* coneType, const int* coneIdx)
+{
+  if (prob->nExpCone + nAddCone > prob->nExpConeCap)
+  {
+    int nCap = STUB_getCap(prob->nExpConeCap, prob->nExpCone + nAddCone);
+    if (STUB_grow((void**) &prob->expConeType, nCap, sizeof(int)) ||
+        STUB_grow((void**) &prob->expConeIdx, nCap, 3 * sizeof(int)))
+    {
+      return COPT_RETCODE_MEMORY;
+    }
+    prob->nExpConeCap = nCap;
+  }
+
+  memcpy(prob->expConeType + prob->nExpCone, coneType, nAddCone * sizeof(int));
+  memcpy(prob->expConeIdx + 3 * prob->nExpCone, coneIdx, 3 * nAddCone * sizeof(int));
+  prob->nExpCone += nAddCone;
+
+  STUB_clearSolution(prob);
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_AddAffineCone(copt_prob* prob, int coneType, int nRow, int nAColCnt, const int* AColIdx,
+                                 const double* AColElem, const int* APSDBeg, const int* APSDCnt,
+                                 const int* APSDIdx, const int* AMatBeg, const int* AMatCnt, const int* AMatIdx,
+                                 const double* AMatElem, const double* affConst, const char* name)
+{
+  prob->nAffCone++;
+  STUB_clearSolution(prob);
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_AddQConstr(copt_prob* prob, int nRowMatCnt, const int* rowMatIdx, const double* rowMatElem,
+                              int nQMatCnt, const int* qMatRow, const int* qMatCol, const double* qMatElem,
+                              char cRowSense, double dRowBound, const char* name)
+{
+  prob->nQConstr++;
+  STUB_clearSolution(prob);
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_SetQuadObj(copt_prob* prob, int num, const int* qRow, const int* qCol, const double* qElem)
+{
+  free(prob->qRow);
+  free(prob->qCol);
+  free(prob->qElem);
+
+  prob->qRow = (int*) calloc(num + 1, sizeof(int));
+  prob->qCol = (int*) calloc(num + 1, sizeof(int));
+  prob->qElem = (double*) calloc(num + 1, sizeof(double));
+  if (!prob->qRow || !prob->qCol || !prob->qElem)
+  {
+    prob->nQElem = 0;
+    return COPT_RETCODE_MEMORY;
+  }
+
+  memcpy(prob->qRow, qRow, num * sizeof(int));
+  memcpy(prob->qCol, qCol, num * sizeof(int));
+  memcpy(prob->qElem, qElem, num * sizeof(double));
+  prob->nQElem = num;
+
+  STUB_clearSolution(prob);
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_AddMipStart(copt_prob* prob, int num, const int* list, double* colVal)
+{
+  prob->nMipStart++;
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_SetBasis(copt_prob* prob, const int* colBasis, const int* rowBasis)
+{
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_SetLpSolution(copt_prob* prob, const double* value, const double* slack, const double* rowDual,
+                                 const double* redCost)
+{
+  return COPT_RETCODE_OK;
+}
+
+/* Model queries */
+int COPT_CALL COPT_GetCols(copt_prob* prob, int nCol, const int* list, int* colMatBeg, int* colMatCnt,
+                           int* colMatIdx, double* colMatElem, int nElemSize, int* pReqSize)
+{
+  int nElem = 0;
+
+  for (int k = 0; k < nCol; ++k)
+  {
+    int j = list != NULL ? list[k] : k;
+    int beg = prob->colMatBeg[j];
+    int cnt = prob->colMatBeg[j + 1] - beg;
+
+    if (colMatBeg != NULL)
+    {
+      colMatBeg[k] = nElem;
+    }
+    if (colMatCnt != NULL)
+    {
+      colMatCnt[k] = cnt;
+    }
+    if (colMatIdx != NULL && nElem + cnt <= nElemSize)
+    {
+      memcpy(colMatIdx + nElem, prob->colMatIdx + beg, cnt * sizeof(int));
+      memcpy(colMatElem + nElem, prob->colMatElem + beg, cnt * sizeof(double));
+    }
+    nElem += cnt;
+  }
+
+  if (colMatBeg != NULL && list == NULL)
+  {
+    colMatBeg[nCol] = nElem;
+  }
+  if (pReqSize != NULL)
+  {
+    *pReqSize = nElem;
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+static int STUB_getName(char** names, int idx, char* buff, int buffSize, int* pReqSize)
+{
+  const char* name = names != NULL ? names[idx] : NULL;
+  char defname[32];
+
+  if (name == NULL)
+  {
+    snprintf(defname, sizeof(defname), "%s%d", names == NULL ? "N" : "", idx);
+    name = defname;
+  }
+
+  if (pReqSize != NULL)
+  {
+    *pReqSize = (int) strlen(name) + 1;
+  }
+  if (buff != NULL && buffSize > 0)
+  {
+    snprintf(buff, buffSize, "%s", name);
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetColName(copt_prob* prob, int iCol, char* buff, int buffSize, int* pReqSize)
+{
+  if (iCol < 0 || iCol >= prob->nCol)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+  return STUB_getName(prob->colNames, iCol, buff, buffSize, pReqSize);
+}
+
+int COPT_CALL COPT_GetRowName(copt_prob* prob, int iRow, char* buff, int buffSize, int* pReqSize)
+{
+  if (iRow < 0 || iRow >= prob->nRow)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+  return STUB_getName(prob->rowNames, iRow, buff, buffSize, pReqSize);
+}
+
+int COPT_CALL COPT_GetColType(copt_prob* prob, int num, const int* list, char* type)
+{
+  for (int k = 0; k < num; ++k)
+  {
+    type[k] = prob->colType[list != NULL ? list[k] : k];
+  }
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetSOSs(copt_prob* prob, int nSos, const int* list, int* sosType, int* sosMatBeg,
+                           int* sosMatCnt, int* sosMatIdx, double* sosMatWt, int nElemSize, int* pReqSize)
+{
+  int nElem = 0;
+
+  for (int k = 0; k < nSos; ++k)
+  {
+    int i = list != NULL ? list[k] : k;
+    int cnt = prob->sosCnt[i];
+
+    if (sosType != NULL)
+    {
+      sosType[k] = prob->sosType[i];
+    }
+    if (sosMatBeg != NULL)
+    {
+      sosMatBeg[k] = nElem;
+    }
+    if (sosMatCnt != NULL)
+    {
+      sosMatCnt[k] = cnt;
+    }
+    if (sosMatIdx != NULL && nElem + cnt <= nElemSize)
+    {
+      memcpy(sosMatIdx + nElem, prob->sosIdx + prob->sosBeg[i], cnt * sizeof(int));
+      memcpy(sosMatWt + nElem, prob->sosWt + prob->sosBeg[i], cnt * sizeof(double));
+    }
+    nElem += cnt;
+  }
+
+  if (pReqSize != NULL)
+  {
+    *pReqSize = nElem;
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetIndicator(copt_prob* prob, int rowIdx, int* binColIdx, int* binColVal, int* nRowMatCnt,
+                                int* rowMatIdx, double* rowMatElem, char* cRowSense, double* dRowBound,
+                                int nElemSize, int* pReqSize)
+{
+  int cnt = 0;
+
+  if (rowIdx < 0 || rowIdx >= prob->nIndicator)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+
+  cnt = prob->indCnt[rowIdx];
+  if (binColIdx != NULL)
+  {
+    *binColIdx = prob->indBinIdx[rowIdx];
+  }
+  if (binColVal != NULL)
+  {
+    *binColVal = prob->indBinVal[rowIdx];
+  }
+  if (nRowMatCnt != NULL)
+  {
+    *nRowMatCnt = cnt;
+  }
+  if (rowMatIdx != NULL && cnt <= nElemSize)
+  {
+    memcpy(rowMatIdx, prob->indIdx + prob->indBeg[rowIdx], cnt * sizeof(int));
+    memcpy(rowMatElem, prob->indElem + prob->indBeg[rowIdx], cnt * sizeof(double));
+  }
+  if (cRowSense != NULL)
+  {
+    *cRowSense = prob->indSense[rowIdx];
+  }
+  if (dRowBound != NULL)
+  {
+    *dRowBound = prob->indBound[rowIdx];
+  }
+  if (pReqSize != NULL)
+  {
+    *pReqSize = cnt;
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetCones(copt_prob* prob, int nCone, const int* list, int* coneType, int* coneBeg, int* coneCnt,
+                            int* coneIdx, int nElemSize, int* pReqSize)
+{
+  int nElem = 0;
+
+  for (int k = 0; k < nCone; ++k)
+  {
+    int i = list != NULL ? list[k] : k;
+    int cnt = prob->coneCnt[i];
+
+    if (coneType != NULL)
+    {
+      coneType[k] = prob->coneType[i];
+    }
+    if (coneBeg != NULL)
+    {
+      coneBeg[k] = nElem;
+    }
+    if (coneCnt != NULL)
+    {
+      coneCnt[k] = cnt;
+    }
+    if (coneIdx != NULL && nElem + cnt <= nElemSize)
+    {
+      memcpy(coneIdx + nElem, prob->coneIdx + prob->coneBeg[i], cnt * sizeof(int));
+    }
+    nElem += cnt;
+  }
+
+  if (pReqSize != NULL)
+  {
+    *pReqSize = nElem;
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetExpCones(copt_prob* prob, int nCone, const int* list, int* coneType, int* coneIdx,
+                               int nElemSize, int* pReqSize)
+{
+  for (int k = 0; k < nCone; ++k)
+  {
+    int i = list != NULL ? list[k] : k;
+
+    if (coneType != NULL)
+    {
+      coneType[k] = prob->expConeType[i];
+    }
+    if (coneIdx != NULL && 3 * (k + 1) <= nElemSize)
+    {
+      memcpy(coneIdx + 3 * k, prob->expConeIdx + 3 * i, 3 * sizeof(int));
+    }
+  }
+
+  if (pReqSize != NULL)
+  {
+    *pReqSize = 3 * nCone;
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetAffineCone(copt_prob* prob, int iCone, int* coneType, int* nRow, int* AColBeg,
+                                 int* AColCnt, int* AColIdx, double* AColElem, int* APSDBeg, int* APSDCnt,
+                                 int nPSDSize, int* pPSDReqSize, int* AMatBeg, int* AMatCnt, int* AMatIdx,
+                                 double* AMatElem, double* affConst, int nElemSize, int* pReqSize)
+{
+  if (iCone < 0 || iCone >= prob->nAffCone)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+
+  if (coneType != NULL)
+  {
+    *coneType = COPT_CONE_QUAD;
+  }
+  if (nRow != NULL)
+  {
+    *nRow = 0;
+  }
+  if (pPSDReqSize != NULL)
+  {
+    *pPSDReqSize = 0;
+  }
+  if (AMatBeg != NULL)
+  {
+    AMatBeg[0] = 0;
+  }
+  if (pReqSize != NULL)
+  {
+    *pReqSize = 0;
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetAffineConeName(copt_prob* prob, int iCone, char* buff, int buffSize, int* pReqSize)
+{
+  return STUB_getName(NULL, iCone, buff, buffSize, pReqSize);
+}
+
+int COPT_CALL COPT_GetQuadObj(copt_prob* prob, int* p_nQElem, int* qRow, int* qCol, double* qElem)
+{
+  if (p_nQElem != NULL)
+  {
+    *p_nQElem = prob->nQElem;
+  }
+  if (qRow != NULL)
+  {
+    memcpy(qRow, prob->qRow, prob->nQElem * sizeof(int));
+    memcpy(qCol, prob->qCol, prob->nQElem * sizeof(int));
+    memcpy(qElem, prob->qElem, prob->nQElem * sizeof(double));
+  }
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetQConstr(copt_prob* prob, int qConstrIdx, int* qMatRow, int* qMatCol, double* qMatElem,
+                              int nQElemSize, int* pQReqSize, int* rowMatIdx, double* rowMatElem, char* cRowSense,
+                              double* dRowBound, int nElemSize, int* pReqSize)
+{
+  if (qConstrIdx < 0 || qConstrIdx >= prob->nQConstr)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+
+  if (pQReqSize != NULL)
+  {
+    *pQReqSize = 0;
+  }
+  if (cRowSense != NULL)
+  {
+    *cRowSense = COPT_LESS_EQUAL;
+  }
+  if (dRowBound != NULL)
+  {
+    *dRowBound = 0.0;
+  }
+  if (pReqSize != NULL)
+  {
+    *pReqSize = 0;
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetQConstrName(copt_prob* prob, int iQConstr, char* buff, int buffSize, int* pReqSize)
+{
+  return STUB_getName(NULL, iQConstr, buff, buffSize, pReqSize);
+}
+
+/* Solving */
+int COPT_CALL COPT_Solve(copt_prob* prob)
+{
+  double dStart = STUB_getWallTime();
+  int isInfeas = 0;
+  char msg[128];
+
+  STUB_clearSolution(prob);
+
+  snprintf(msg, sizeof(msg), "Stub solver: %d rows, %d columns and %d non-zero elements", prob->nRow, prob->nCol,
+           prob->nElem);
+  STUB_log(prob, msg);
+
+  prob->colValue = (double*) calloc(prob->nCol + 1, sizeof(double));
+  prob->rowSlack = (double*) calloc(prob->nRow + 1, sizeof(double));
+  if (!prob->colValue || !prob->rowSlack)
+  {
+    STUB_clearSolution(prob);
+    return COPT_RETCODE_MEMORY;
+  }
+
+  prob->isMIP = prob->nSos > 0 || prob->nIndicator > 0;
+  prob->dObjVal = prob->dObjConst;
+  for (int j = 0; j < prob->nCol; ++j)
+  {
+    double lb = prob->colLower[j];
+    double ub = prob->colUpper[j];
+    double x = 0.0;
+
+    if (prob->colType[j] != COPT_CONTINUOUS)
+    {
+      prob->isMIP = 1;
+      lb = ceil(lb);
+      ub = floor(ub);
+    }
+
+    x = lb > 0.0 ? lb : (ub < 0.0 ? ub : 0.0);
+    isInfeas |= lb > ub;
+
+    prob->colValue[j] = x;
+    prob->dObjVal += prob->colObj[j] * x;
+    for (int k = prob->colMatBeg[j]; k < prob->colMatBeg[j + 1]; ++k)
+    {
+      prob->rowSlack[prob->colMatIdx[k]] += prob->colMatElem[k] * x;
+    }
+  }
+
+  for (int k = 0; k < prob->nQElem; ++k)
+  {
+    prob->dObjVal += prob->qElem[k] * prob->colValue[prob->qRow[k]] * prob->colValue[prob->qCol[k]];
+  }
+
+  for (int i = 0; i < prob->nRow; ++i)
+  {
+    isInfeas |= prob->rowLower[i] > prob->rowUpper[i];
+  }
+
+  prob->hasSol = !isInfeas;
+
+  if (prob->isMIP)
+  {
+    // One relaxation and one incumbent found at one node, the problem itself serves as callback data
+    if (prob->cbfunc != NULL && !isInfeas && (prob->cbctx & COPT_CBCONTEXT_MIPRELAX))
+    {
+      prob->cbfunc(prob, prob, COPT_CBCONTEXT_MIPRELAX, prob->cbdata);
+    }
+    if (prob->cbfunc != NULL && !isInfeas && (prob->cbctx & COPT_CBCONTEXT_MIPSOL))
+    {
+      prob->cbfunc(prob, prob, COPT_CBCONTEXT_MIPSOL, prob->cbdata);
+    }
+    if (prob->cbfunc != NULL && (prob->cbctx & COPT_CBCONTEXT_MIPNODE))
+    {
+      prob->cbfunc(prob, prob, COPT_CBCONTEXT_MIPNODE, prob->cbdata);
+    }
+    prob->nMipStatus = isInfeas ? COPT_MIPSTATUS_INFEASIBLE : COPT_MIPSTATUS_OPTIMAL;
+  }
+  else
+  {
+    prob->nLpStatus = isInfeas ? COPT_LPSTATUS_INFEASIBLE : COPT_LPSTATUS_OPTIMAL;
+  }
+
+  prob->dSolvingTime = STUB_getWallTime() - dStart;
+  snprintf(msg, sizeof(msg), "Stub solver finished in %.6fs", prob->dSolvingTime);
+  STUB_log(prob, msg);
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_Interrupt(copt_prob* prob)
+{
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_Reset(copt_prob* prob, int iClearAll)
+{
+  STUB_clearSolution(prob);
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_ComputeIIS(copt_prob* prob)
+{
+  prob->hasIIS = 1;
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_FeasRelax(copt_prob* prob, double* colLowPen, double* colUppPen, double* rowBndPen,
+                             double* rowUppPen)
+{
+  int retcode = COPT_Solve(prob);
+  if (retcode == COPT_RETCODE_OK)
+  {
+    prob->hasRelax = 1;
+  }
+  return retcode;
+}
+
+int COPT_CALL COPT_Tune(copt_prob* prob)
+{
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_SetCallback(copt_prob* prob, int(COPT_CALL* cb)(copt_prob*, void*, int, void*), int cbctx,
+                               void* userdata)
+{
+  prob->cbfunc = cb;
+  prob->cbctx = cbctx;
+  prob->cbdata = userdata;
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetCallbackInfo(void* cbdata, const char* cbinfo, void* p_val)
+{
+  copt_prob* prob = (copt_prob*) cbdata;
+
+  if (STUB_strcmp(cbinfo, COPT_CBINFO_BESTOBJ) == 0 || STUB_strcmp(cbinfo, COPT_CBINFO_MIPCANDOBJ) == 0)
+    *(double*) p_val = prob->hasSol ? prob->dObjVal : COPT_INFINITY;
+  else if (STUB_strcmp(cbinfo, COPT_CBINFO_BESTBND) == 0)
+    *(double*) p_val = prob->dObjVal;
+  else if (STUB_strcmp(cbinfo, COPT_CBINFO_MIPCANDIDATE) == 0 || STUB_strcmp(cbinfo, COPT_CBINFO_RELAXSOLUTION) == 0)
+    memcpy(p_val, prob->colValue, prob->nCol * sizeof(double));
+  else
+    return COPT_RETCODE_INVALID;
+
+  return COPT_RETCODE_OK;
+}
+
+/* Rows added from callbacks are counted only, the stub solution never violates them */
+int COPT_CALL COPT_AddCallbackLazyConstrs(void* cbdata, int nRow, const int* rowMatBeg, const int* rowMatCnt,
+                                          const int* rowMatIdx, const double* rowMatElem, const char* rowSense,
+                                          const double* rowRhs)
+{
+  ((copt_prob*) cbdata)->nCbRow += nRow;
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_AddCallbackUserCuts(void* cbdata, int nRow, const int* rowMatBeg, const int* rowMatCnt,
+                                       const int* rowMatIdx, const double* rowMatElem, const char* rowSense,
+                                       const double* rowRhs)
+{
+  ((copt_prob*) cbdata)->nCbRow += nRow;
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_SetLogCallback(copt_prob* prob, void(COPT_CALL* logcb)(char* msg, void* userdata),
+                                  void* userdata)
+{
+  prob->logfunc = logcb;
+  prob->logdata = userdata;
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_SetLogFile(copt_prob* prob, const char* logfilename)
+{
+  return COPT_RETCODE_OK;
+}
+
+/* Solution queries */
+int COPT_CALL COPT_GetSolution(copt_prob* prob, double* colVal)
+{
+  if (!prob->hasSol)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+  memcpy(colVal, prob->colValue, prob->nCol * sizeof(double));
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetLpSolution(copt_prob* prob, double* value, double* slack, double* rowDual, double* redCost)
+{
+  if (!prob->hasSol)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+
+  if (value != NULL)
+  {
+    memcpy(value, prob->colValue, prob->nCol * sizeof(double));
+  }
+  if (slack != NULL)
+  {
+    memcpy(slack, prob->rowSlack, prob->nRow * sizeof(double));
+  }
+  if (rowDual != NULL)
+  {
+    memset(rowDual, 0, prob->nRow * sizeof(double));
+  }
+  if (redCost != NULL)
+  {
+    memcpy(redCost, prob->colObj, prob->nCol * sizeof(double));
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetPSDSolution(copt_prob* prob, double* psdColValue, double* psdRowSlack, double* psdRowDual,
+                                  double* psdColDual)
+{
+  return COPT_RETCODE_OK;
+}
+
+static int STUB_getColBasis(copt_prob* prob, int j)
+{
+  if (prob->colValue[j] == prob->colLower[j])
+  {
+    return COPT_BASIS_LOWER;
+  }
+  else if (prob->colValue[j] == prob->colUpper[j])
+  {
+    return COPT_BASIS_UPPER;
+  }
+  return COPT_BASIS_SUPERBASIC;
+}
+
+int COPT_CALL COPT_GetBasis(copt_prob* prob, int* colBasis, int* rowBasis)
+{
+  if (!prob->hasSol || prob->isMIP)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+
+  if (colBasis != NULL)
+  {
+    for (int j = 0; j < prob->nCol; ++j)
+    {
+      colBasis[j] = STUB_getColBasis(prob, j);
+    }
+  }
+  if (rowBasis != NULL)
+  {
+    for (int i = 0; i < prob->nRow; ++i)
+    {
+      rowBasis[i] = COPT_BASIS_BASIC;
+    }
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetColBasis(copt_prob* prob, int num, const int* list, int* colBasis)
+{
+  if (!prob->hasSol || prob->isMIP)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+
+  for (int k = 0; k < num; ++k)
+  {
+    colBasis[k] = STUB_getColBasis(prob, list != NULL ? list[k] : k);
+  }
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetRowBasis(copt_prob* prob, int num, const int* list, int* rowBasis)
+{
+  if (!prob->hasSol || prob->isMIP)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+
+  for (int k = 0; k < num; ++k)
+  {
+    rowBasis[k] = COPT_BASIS_BASIC;
+  }
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetPoolObjVal(copt_prob* prob, int iSol, double* p_objVal)
+{
+  if (!prob->hasSol || iSol != 0)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+  *p_objVal = prob->dObjVal;
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetPoolSolution(copt_prob* prob, int iSol, int num, const int* list, double* colVal)
+{
+  if (!prob->hasSol || iSol != 0)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+
+  for (int k = 0; k < num; ++k)
+  {
+    colVal[k] = prob->colValue[list != NULL ? list[k] : k];
+  }
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetColInfo(copt_prob* prob, const char* infoName, int num, const int* list, double* info)
+{
+  for (int k = 0; k < num; ++k)
+  {
+    int j = list != NULL ? list[k] : k;
+
+    if (STUB_strcmp(infoName, COPT_DBLINFO_OBJ) == 0)
+    {
+      info[k] = prob->colObj[j];
+    }
+    else if (STUB_strcmp(infoName, COPT_DBLINFO_LB) == 0)
+    {
+      info[k] = prob->colLower[j];
+    }
+    else if (STUB_strcmp(infoName, COPT_DBLINFO_UB) == 0)
+    {
+      info[k] = prob->colUpper[j];
+    }
+    else if (STUB_strcmp(infoName, COPT_DBLINFO_RELAXVALUE) == 0)
+    {
+      info[k] = prob->colValue != NULL ? prob->colValue[j] : 0.0;
+    }
+    else if (STUB_strcmp(infoName, COPT_DBLINFO_RELAXLB) == 0 || STUB_strcmp(infoName, COPT_DBLINFO_RELAXUB) == 0 ||
+             STUB_strcmp(infoName, COPT_DBLINFO_PRIMALRAY) == 0)
+    {
+      info[k] = 0.0;
+    }
+    else
+    {
+      return COPT_RETCODE_INVALID;
+    }
+  }
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetRowInfo(copt_prob* prob, const char* infoName, int num, const int* list, double* info)
+{
+  for (int k = 0; k < num; ++k)
+  {
+    int i = list != NULL ? list[k] : k;
+
+    if (STUB_strcmp(infoName, COPT_DBLINFO_LB) == 0)
+    {
+      info[k] = prob->rowLower[i];
+    }
+    else if (STUB_strcmp(infoName, COPT_DBLINFO_UB) == 0)
+    {
+      info[k] = prob->rowUpper[i];
+    }
+    else if (STUB_strcmp(infoName, COPT_DBLINFO_SLACK) == 0)
+    {
+      info[k] = prob->rowSlack != NULL ? prob->rowSlack[i] : 0.0;
+    }
+    else if (STUB_strcmp(infoName, COPT_DBLINFO_RELAXLB) == 0 || STUB_strcmp(infoName, COPT_DBLINFO_RELAXUB) == 0 ||
+             STUB_strcmp(infoName, COPT_DBLINFO_DUALFARKAS) == 0)
+    {
+      info[k] = 0.0;
+    }
+    else
+    {
+      return COPT_RETCODE_INVALID;
+    }
+  }
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetQConstrInfo(copt_prob* prob, const char* infoName, int num, const int* list, double* info)
+{
+  memset(info, 0, num * sizeof(double));
+  return COPT_RETCODE_OK;
+}
+
+/* Nothing is ever in the IIS: the stub model is never proven infeasible */
+static int STUB_getIIS(int num, int* iis)
+{
+  memset(iis, 0, num * sizeof(int));
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetColLowerIIS(copt_prob* prob, int num, const int* list, int* colLowerIIS)
+{
+  return STUB_getIIS(num, colLowerIIS);
+}
+
+int COPT_CALL COPT_GetColUpperIIS(copt_prob* prob, int num, const int* list, int* colUpperIIS)
+{
+  return STUB_getIIS(num, colUpperIIS);
+}
+
+int COPT_CALL COPT_GetRowLowerIIS(copt_prob* prob, int num, const int* list, int* rowLowerIIS)
+{
+  return STUB_getIIS(num, rowLowerIIS);
+}
+
+int COPT_CALL COPT_GetRowUpperIIS(copt_prob* prob, int num, const int* list, int* rowUpperIIS)
+{
+  return STUB_getIIS(num, rowUpperIIS);
+}
+
+int COPT_CALL COPT_GetSOSIIS(copt_prob* prob, int num, const int* list, int* sosIIS)
+{
+  return STUB_getIIS(num, sosIIS);
+}
+
+int COPT_CALL COPT_GetIndicatorIIS(copt_prob* prob, int num, const int* list, int* indicatorIIS)
+{
+  return STUB_getIIS(num, indicatorIIS);
+}
+
+/* Attributes */
+int COPT_CALL COPT_GetIntAttr(copt_prob* prob, const char* attrName, int* p_intAttr)
+{
+  int isLp = prob->hasSol && !prob->isMIP;
+
+  if (STUB_strcmp(attrName, COPT_INTATTR_COLS) == 0)
+    *p_intAttr = prob->nCol;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_ROWS) == 0)
+    *p_intAttr = prob->nRow;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_ELEMS) == 0)
+    *p_intAttr = prob->nElem;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_QELEMS) == 0)
+    *p_intAttr = prob->nQElem;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_SOSS) == 0)
+    *p_intAttr = prob->nSos;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_INDICATORS) == 0)
+    *p_intAttr = prob->nIndicator;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_CONES) == 0)
+    *p_intAttr = prob->nCone;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_EXPCONES) == 0)
+    *p_intAttr = prob->nExpCone;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_AFFINECONES) == 0)
+    *p_intAttr = prob->nAffCone;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_QCONSTRS) == 0)
+    *p_intAttr = prob->nQConstr;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_PSDCOLS) == 0 || STUB_strcmp(attrName, COPT_INTATTR_PSDCONSTRS) == 0 ||
+           STUB_strcmp(attrName, "PSDLens") == 0)
+    *p_intAttr = 0;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_OBJSENSE) == 0)
+    *p_intAttr = prob->nObjSense;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_ISMIP) == 0)
+  {
+    int isMIP = prob->nSos > 0 || prob->nIndicator > 0;
+    for (int j = 0; j < prob->nCol && !isMIP; ++j)
+    {
+      isMIP = prob->colType[j] != COPT_CONTINUOUS;
+    }
+    *p_intAttr = isMIP;
+  }
+  else if (STUB_strcmp(attrName, COPT_INTATTR_LPSTATUS) == 0)
+    *p_intAttr = prob->nLpStatus;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_MIPSTATUS) == 0)
+    *p_intAttr = prob->nMipStatus;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_SIMPLEXITER) == 0 ||
+           STUB_strcmp(attrName, COPT_INTATTR_BARRIERITER) == 0)
+    *p_intAttr = 0;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_NODECNT) == 0)
+    *p_intAttr = prob->hasSol && prob->isMIP;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_POOLSOLS) == 0 || STUB_strcmp(attrName, COPT_INTATTR_HASMIPSOL) == 0)
+    *p_intAttr = prob->hasSol && prob->isMIP;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_HASLPSOL) == 0 || STUB_strcmp(attrName, COPT_INTATTR_HASBASIS) == 0)
+    *p_intAttr = isLp;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_TUNERESULTS) == 0)
+    *p_intAttr = 0;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_HASIIS) == 0 || STUB_strcmp(attrName, COPT_INTATTR_ISMINIIS) == 0)
+    *p_intAttr = prob->hasIIS;
+  else if (STUB_strcmp(attrName, COPT_INTATTR_HASFEASRELAXSOL) == 0)
+    *p_intAttr = prob->hasRelax;
+  else
+    return COPT_RETCODE_INVALID;
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetDblAttr(copt_prob* prob, const char* attrName, double* p_dblAttr)
+{
+  if (STUB_strcmp(attrName, COPT_DBLATTR_SOLVINGTIME) == 0)
+    *p_dblAttr = prob->dSolvingTime;
+  else if (STUB_strcmp(attrName, COPT_DBLATTR_OBJCONST) == 0)
+    *p_dblAttr = prob->dObjConst;
+  else if (STUB_strcmp(attrName, COPT_DBLATTR_LPOBJVAL) == 0 || STUB_strcmp(attrName, COPT_DBLATTR_BESTOBJ) == 0 ||
+           STUB_strcmp(attrName, COPT_DBLATTR_BESTBND) == 0)
+    *p_dblAttr = prob->dObjVal;
+  else if (STUB_strcmp(attrName, COPT_DBLATTR_BESTGAP) == 0 || STUB_strcmp(attrName, COPT_DBLATTR_FEASRELAXOBJ) == 0)
+    *p_dblAttr = 0.0;
+  else
+    return COPT_RETCODE_INVALID;
+
+  return COPT_RETCODE_OK;
+}
+
+/* Parameters */
+static int STUB_findParam(const char* paramName, int type)
+{
+  for (int i = 0; i < STUB_NPARAM; ++i)
+  {
+    if (STUB_paramTable[i].type == type && STUB_strcmp(STUB_paramTable[i].name, paramName) == 0)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int COPT_SearchParamAttr(copt_prob* prob, const char* name, int* p_type)
+{
+  int idx = STUB_findParam(name, 0);
+
+  if (idx >= 0)
+  {
+    *p_type = 0;
+  }
+  else if ((idx = STUB_findParam(name, 1)) >= 0)
+  {
+    *p_type = 1;
+  }
+  else
+  {
+    *p_type = -1;
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_SetDblParam(copt_prob* prob, const char* paramName, double dblParam)
+{
+  int idx = STUB_findParam(paramName, 0);
+
+  if (idx < 0 || dblParam < STUB_paramTable[idx].lb || dblParam > STUB_paramTable[idx].ub)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+  prob->paramValue[idx] = dblParam;
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_SetIntParam(copt_prob* prob, const char* paramName, int intParam)
+{
+  int idx = STUB_findParam(paramName, 1);
+
+  if (idx < 0 || intParam < STUB_paramTable[idx].lb || intParam > STUB_paramTable[idx].ub)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+  prob->paramValue[idx] = intParam;
+  return COPT_RETCODE_OK;
+}
+
+/* Query current, default, lower or upper value of parameter */
+static int STUB_getParam(copt_prob* prob, const char* paramName, int type, int what, double* p_value)
+{
+  int idx = STUB_findParam(paramName, type);
+
+  if (idx < 0)
+  {
+    return COPT_RETCODE_INVALID;
+  }
+
+  switch (what)
+  {
+  case 0:
+    *p_value = prob->paramValue[idx];
+    break;
+  case 1:
+    *p_value = STUB_paramTable[idx].def;
+    break;
+  case 2:
+    *p_value = STUB_paramTable[idx].lb;
+    break;
+  default:
+    *p_value = STUB_paramTable[idx].ub;
+    break;
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_GetDblParam(copt_prob* prob, const char* paramName, double* p_dblParam)
+{
+  return STUB_getParam(prob, paramName, 0, 0, p_dblParam);
+}
+
+int COPT_CALL COPT_GetDblParamDef(copt_prob* prob, const char* paramName, double* p_dblParam)
+{
+  return STUB_getParam(prob, paramName, 0, 1, p_dblParam);
+}
+
+int COPT_CALL COPT_GetDblParamMin(copt_prob* prob, const char* paramName, double* p_dblParam)
+{
+  return STUB_getParam(prob, paramName, 0, 2, p_dblParam);
+}
+
+int COPT_CALL COPT_GetDblParamMax(copt_prob* prob, const char* paramName, double* p_dblParam)
+{
+  return STUB_getParam(prob, paramName, 0, 3, p_dblParam);
+}
+
+static int STUB_getIntParam(copt_prob* prob, const char* paramName, int what, int* p_intParam)
+{
+  double value = 0.0;
+  int retcode = STUB_getParam(prob, paramName, 1, what, &value);
+  *p_intParam = (int) value;
+  return retcode;
+}
+
+int COPT_CALL COPT_GetIntParam(copt_prob* prob, const char* paramName, int* p_intParam)
+{
+  return STUB_getIntParam(prob, paramName, 0, p_intParam);
+}
+
+int COPT_CALL COPT_GetIntParamDef(copt_prob* prob, const char* paramName, int* p_intParam)
+{
+  return STUB_getIntParam(prob, paramName, 1, p_intParam);
+}
+
+int COPT_CALL COPT_GetIntParamMin(copt_prob* prob, const char* paramName, int* p_intParam)
+{
+  return STUB_getIntParam(prob, paramName, 2, p_intParam);
+}
+
+int COPT_CALL COPT_GetIntParamMax(copt_prob* prob, const char* paramName, int* p_intParam)
+{
+  return STUB_getIntParam(prob, paramName, 3, p_intParam);
+}
+
+int COPT_CALL COPT_ResetParam(copt_prob* prob)
+{
+  for (int i = 0; i < STUB_NPARAM; ++i)
+  {
+    prob->paramValue[i] = STUB_paramTable[i].def;
+  }
+  return COPT_RETCODE_OK;
+}
+
+/* Files: one private binary format for every model file type */
+static int STUB_write(FILE* fp, const void* data, size_t size, size_t num)
+{
+  return num == 0 || fwrite(data, size, num, fp) == num ? COPT_RETCODE_OK : COPT_RETCODE_FILE;
+}
+
+static int STUB_read(FILE* fp, void* data, size_t size, size_t num)
+{
+  return num == 0 || fread(data, size, num, fp) == num ? COPT_RETCODE_OK : COPT_RETCODE_FILE;
+}
+
+static int STUB_writeNames(FILE* fp, char** names, int num)
+{
+  int hasNames = names != NULL;
+  int retcode = STUB_write(fp, &hasNames, sizeof(int), 1);
+
+  for (int i = 0; i < num && hasNames && retcode == COPT_RETCODE_OK; ++i)
+  {
+    int len = (int) strlen(names[i]);
+    retcode = STUB_write(fp, &len, sizeof(int), 1);
+    if (retcode == COPT_RETCODE_OK)
+    {
+      retcode = STUB_write(fp, names[i], 1, len);
+    }
+  }
+  return retcode;
+}
+
+static int STUB_readNames(FILE* fp, char*** p_names, int num)
+{
+  int hasNames = 0;
+  int retcode = STUB_read(fp, &hasNames, sizeof(int), 1);
+  char** names = NULL;
+
+  if (retcode != COPT_RETCODE_OK || !hasNames)
+  {
+    return retcode;
+  }
+
+  names = (char**) calloc(num + 1, sizeof(char*));
+  if (!names)
+  {
+    return COPT_RETCODE_MEMORY;
+  }
+
+  for (int i = 0; i < num && retcode == COPT_RETCODE_OK; ++i)
+  {
+    int len = 0;
+    retcode = STUB_read(fp, &len, sizeof(int), 1);
+    if (retcode == COPT_RETCODE_OK && (len < 0 || (names[i] = (char*) calloc(len + 1, 1)) == NULL))
+    {
+      retcode = COPT_RETCODE_FILE;
+    }
+    if (retcode == COPT_RETCODE_OK)
+    {
+      retcode = STUB_read(fp, names[i], 1, len);
+    }
+  }
+
+  *p_names = names;
+  return retcode;
+}
+
+static int STUB_writeModel(copt_prob* prob, const char* filename)
+{
+  int retcode = COPT_RETCODE_OK;
+  int header[5] = {prob->nCol, prob->nRow, prob->nElem, prob->nObjSense, prob->nSos};
+  FILE* fp = fopen(filename, "wb");
+
+  if (fp == NULL)
+  {
+    return COPT_RETCODE_FILE;
+  }
+
+  retcode |= STUB_write(fp, STUB_MAGIC, 1, 8);
+  retcode |= STUB_write(fp, header, sizeof(int), 5);
+  retcode |= STUB_write(fp, &prob->nSosElem, sizeof(int), 1);
+  retcode |= STUB_write(fp, &prob->dObjConst, sizeof(double), 1);
+  retcode |= STUB_write(fp, prob->colObj, sizeof(double), prob->nCol);
+  retcode |= STUB_write(fp, prob->colLower, sizeof(double), prob->nCol);
+  retcode |= STUB_write(fp, prob->colUpper, sizeof(double), prob->nCol);
+  retcode |= STUB_write(fp, prob->colType, sizeof(char), prob->nCol);
+  retcode |= STUB_write(fp, prob->colMatBeg, sizeof(int), prob->nCol + 1);
+  retcode |= STUB_write(fp, prob->colMatIdx, sizeof(int), prob->nElem);
+  retcode |= STUB_write(fp, prob->colMatElem, sizeof(double), prob->nElem);
+  retcode |= STUB_write(fp, prob->rowLower, sizeof(double), prob->nRow);
+  retcode |= STUB_write(fp, prob->rowUpper, sizeof(double), prob->nRow);
+  retcode |= STUB_writeNames(fp, prob->colNames, prob->nCol);
+  retcode |= STUB_writeNames(fp, prob->rowNames, prob->nRow);
+  retcode |= STUB_write(fp, prob->sosType, sizeof(int), prob->nSos);
+  retcode |= STUB_write(fp, prob->sosCnt, sizeof(int), prob->nSos);
+  retcode |= STUB_write(fp, prob->sosIdx, sizeof(int), prob->nSosElem);
+  retcode |= STUB_write(fp, prob->sosWt, sizeof(double), prob->nSosElem);
+  retcode |= STUB_write(fp, &prob->nQElem, sizeof(int), 1);
+  retcode |= STUB_write(fp, prob->qRow, sizeof(int), prob->nQElem);
+  retcode |= STUB_write(fp, prob->qCol, sizeof(int), prob->nQElem);
+  retcode |= STUB_write(fp, prob->qElem, sizeof(double), prob->nQElem);
+
+  if (fclose(fp) != 0)
+  {
+    retcode = COPT_RETCODE_FILE;
+  }
+
+  return retcode != COPT_RETCODE_OK ? COPT_RETCODE_FILE : COPT_RETCODE_OK;
+}
+
+static int STUB_readModel(copt_prob* prob, const char* filename)
+{
+  int retcode = COPT_RETCODE_OK;
+  char magic[8];
+  int header[5];
+  int nSosElem = 0;
+  int nQElem = 0;
+  double dObjConst = 0.0;
+  FILE* fp = fopen(filename, "rb");
+
+  if (fp == NULL)
+  {
+    return COPT_RETCODE_FILE;
+  }
+
+  if (STUB_read(fp, magic, 1, 8) != COPT_RETCODE_OK || memcmp(magic, STUB_MAGIC, 8) != 0 ||
+      STUB_read(fp, header, sizeof(int), 5) != COPT_RETCODE_OK ||
+      STUB_read(fp, &nSosElem, sizeof(int), 1) != COPT_RETCODE_OK ||
+      STUB_read(fp, &dObjConst, sizeof(double), 1) != COPT_RETCODE_OK || header[0] < 0 || header[1] < 0 ||
+      header[2] < 0 || header[4] < 0 || nSosElem < 0)
+  {
+    fclose(fp);
+    return COPT_RETCODE_FILE;
+  }
+
+  STUB_clearModel(prob);
+  prob->nCol = header[0];
+  prob->nRow = header[1];
+  prob->nElem = header[2];
+  prob->nObjSense = header[3];
+  prob->dObjConst = dObjConst;
+  prob->colObj = (double*) calloc(prob->nCol + 1, sizeof(double));
+  prob->colLower = (double*) calloc(prob->nCol + 1, sizeof(double));
+  prob->colUpper = (double*) calloc(prob->nCol + 1, sizeof(double));
+  prob->colType = (char*) calloc(prob->nCol + 1, sizeof(char));
+  prob->colMatBeg = (int*) calloc(prob->nCol + 1, sizeof(int));
+  prob->colMatIdx = (int*) calloc(prob->nElem + 1, sizeof(int));
+  prob->colMatElem = (double*) calloc(prob->nElem + 1, sizeof(double));
+  prob->rowLower = (double*) calloc(prob->nRow + 1, sizeof(double));
+  prob->rowUpper = (double*) calloc(prob->nRow + 1, sizeof(double));
+  if (!prob->colObj || !prob->colLower || !prob->colUpper || !prob->colType || !prob->colMatBeg ||
+      !prob->colMatIdx || !prob->colMatElem || !prob->rowLower || !prob->rowUpper)
+  {
+    fclose(fp);
+    STUB_clearModel(prob);
+    return COPT_RETCODE_MEMORY;
+  }
+
+  retcode |= STUB_read(fp, prob->colObj, sizeof(double), prob->nCol);
+  retcode |= STUB_read(fp, prob->colLower, sizeof(double), prob->nCol);
+  retcode |= STUB_read(fp, prob->colUpper, sizeof(double), prob->nCol);
+  retcode |= STUB_read(fp, prob->colType, sizeof(char), prob->nCol);
+  retcode |= STUB_read(fp, prob->colMatBeg, sizeof(int), prob->nCol + 1);
+  retcode |= STUB_read(fp, prob->colMatIdx, sizeof(int), prob->nElem);
+  retcode |= STUB_read(fp, prob->colMatElem, sizeof(double), prob->nElem);
+  retcode |= STUB_read(fp, prob->rowLower, sizeof(double), prob->nRow);
+  retcode |= STUB_read(fp, prob->rowUpper, sizeof(double), prob->nRow);
+  retcode |= STUB_readNames(fp, &prob->colNames, prob->nCol);
+  retcode |= STUB_readNames(fp, &prob->rowNames, prob->nRow);
+
+  if (retcode == COPT_RETCODE_OK && header[4] > 0)
+  {
+    int* sosType = (int*) calloc(header[4], sizeof(int));
+    int* sosBeg = (int*) calloc(header[4], sizeof(int));
+    int* sosCnt = (int*) calloc(header[4], sizeof(int));
+    int* sosIdx = (int*) calloc(nSosElem + 1, sizeof(int));
+    double* sosWt = (double*) calloc(nSosElem + 1, sizeof(double));
+
+    if (!sosType || !sosBeg || !sosCnt || !sosIdx || !sosWt)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+    }
+    else
+    {
+      retcode |= STUB_read(fp, sosType, sizeof(int), header[4]);
+      retcode |= STUB_read(fp, sosCnt, sizeof(int), header[4]);
+      retcode |= STUB_read(fp, sosIdx, sizeof(int), nSosElem);
+      retcode |= STUB_read(fp, sosWt, sizeof(double), nSosElem);
+      for (int i = 1; i < header[4]; ++i)
+      {
+        sosBeg[i] = sosBeg[i - 1] + sosCnt[i - 1];
+      }
+      if (retcode == COPT_RETCODE_OK)
+      {
+        retcode = COPT_AddSOSs(prob, header[4], sosType, sosBeg, sosCnt, sosIdx, sosWt);
+      }
+    }
+
+    free(sosType);
+    free(sosBeg);
+    free(sosCnt);
+    free(sosIdx);
+    free(sosWt);
+  }
+
+  if (retcode == COPT_RETCODE_OK)
+  {
+    retcode = STUB_read(fp, &nQElem, sizeof(int), 1);
+  }
+  if (retcode == COPT_RETCODE_OK && nQElem > 0)
+  {
+    int* qRow = (int*) calloc(nQElem, sizeof(int));
+    int* qCol = (int*) calloc(nQElem, sizeof(int));
+    double* qElem = (double*) calloc(nQElem, sizeof(double));
+
+    if (!qRow || !qCol || !qElem)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+    }
+    else
+    {
+      retcode |= STUB_read(fp, qRow, sizeof(int), nQElem);
+      retcode |= STUB_read(fp, qCol, sizeof(int), nQElem);
+      retcode |= STUB_read(fp, qElem, sizeof(double), nQElem);
+      if (retcode == COPT_RETCODE_OK)
+      {
+        retcode = COPT_SetQuadObj(prob, nQElem, qRow, qCol, qElem);
+      }
+    }
+
+    free(qRow);
+    free(qCol);
+    free(qElem);
+  }
+
+  fclose(fp);
+
+  if (retcode != COPT_RETCODE_OK)
+  {
+    STUB_clearModel(prob);
+    return retcode == COPT_RETCODE_MEMORY ? COPT_RETCODE_MEMORY : COPT_RETCODE_FILE;
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_ReadMps(copt_prob* prob, const char* mpsfilename)
+{
+  return STUB_readModel(prob, mpsfilename);
+}
+
+int COPT_CALL COPT_ReadLp(copt_prob* prob, const char* lpfilename)
+{
+  return STUB_readModel(prob, lpfilename);
+}
+
+int COPT_CALL COPT_ReadBin(copt_prob* prob, const char* binfilename)
+{
+  return STUB_readModel(prob, binfilename);
+}
+
+int COPT_CALL COPT_ReadCbf(copt_prob* prob, const char* cbffilename)
+{
+  return STUB_readModel(prob, cbffilename);
+}
+
+int COPT_CALL COPT_ReadSDPA(copt_prob* prob, const char* sdpafilename)
+{
+  return COPT_RETCODE_FILE;
+}
+
+int COPT_CALL COPT_ReadBasis(copt_prob* prob, const char* basfilename)
+{
+  return COPT_RETCODE_OK;
+}
+
+/* Info files are only checked to exist, their content is not used */
+static int STUB_readInfo(const char* filename)
+{
+  FILE* fp = fopen(filename, "r");
+  if (fp == NULL)
+  {
+    return COPT_RETCODE_FILE;
+  }
+
+  fclose(fp);
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_ReadSol(copt_prob* prob, const char* solfilename)
+{
+  return STUB_readInfo(solfilename);
+}
+
+int COPT_CALL COPT_ReadMst(copt_prob* prob, const char* mstfilename)
+{
+  return STUB_readInfo(mstfilename);
+}
+
+int COPT_CALL COPT_ReadParam(copt_prob* prob, const char* parfilename)
+{
+  return STUB_readInfo(parfilename);
+}
+
+int COPT_CALL COPT_ReadTune(copt_prob* prob, const char* tunefilename)
+{
+  return STUB_readInfo(tunefilename);
+}
+
+int COPT_CALL COPT_WriteMps(copt_prob* prob, const char* mpsfilename)
+{
+  return STUB_writeModel(prob, mpsfilename);
+}
+
+int COPT_CALL COPT_WriteLp(copt_prob* prob, const char* lpfilename)
+{
+  return STUB_writeModel(prob, lpfilename);
+}
+
+int COPT_CALL COPT_WriteBin(copt_prob* prob, const char* binfilename)
+{
+  return STUB_writeModel(prob, binfilename);
+}
+
+int COPT_CALL COPT_WriteCbf(copt_prob* prob, const char* cbffilename)
+{
+  return STUB_writeModel(prob, cbffilename);
+}
+
+int COPT_CALL COPT_WriteIIS(copt_prob* prob, const char* iisfilename)
+{
+  return prob->hasIIS ? STUB_writeModel(prob, iisfilename) : COPT_RETCODE_INVALID;
+}
+
+int COPT_CALL COPT_WriteRelax(copt_prob* prob, const char* relaxfilename)
+{
+  return prob->hasRelax ? STUB_writeModel(prob, relaxfilename) : COPT_RETCODE_INVALID;
+}
+
+/* Solution files hold one value per column, basis files one status per column */
+static int STUB_writeSol(copt_prob* prob, const char* filename, int isBasis)
+{
+  FILE* fp = NULL;
+
+  if (!prob->hasSol || (isBasis && prob->isMIP))
+  {
+    return COPT_RETCODE_INVALID;
+  }
+
+  fp = fopen(filename, "w");
+  if (fp == NULL)
+  {
+    return COPT_RETCODE_FILE;
+  }
+
+  for (int j = 0; j < prob->nCol; ++j)
+  {
+    if (isBasis)
+    {
+      fprintf(fp, "C%d %d\n", j, STUB_getColBasis(prob, j));
+    }
+    else
+    {
+      fprintf(fp, "C%d %.17g\n", j, prob->colValue[j]);
+    }
+  }
+
+  fclose(fp);
+  return COPT_RETCODE_OK;
+}
+
+int COPT_CALL COPT_WriteSol(copt_prob* prob, const char* solfilename)
+{
+  return STUB_writeSol(prob, solfilename, 0);
+}
+
+int COPT_CALL COPT_WriteBasis(copt_prob* prob, const char* basfilename)
+{
+  return STUB_writeSol(prob, basfilename, 1);
+}
+
+int COPT_CALL COPT_WriteMst(copt_prob* prob, const char* mstfilename)
+{
+  return STUB_writeSol(prob, mstfilename, 0);
+}
+
+int COPT_CALL COPT_WriteTuneParam(copt_prob* prob, int idx, const char* parfilename)
+{
+  return COPT_RETCODE_INVALID;
+}
@@ -0,0 +1,157 @@
+#ifndef __MEXSHIM_H__
+#define __MEXSHIM_H__
+
+/*
+ * Minimal MEX API shim, used in place of the MATLAB mex.h when the interface
+ * is compiled into the standalone benchmark binary. Only the functions called
+ * by the sources in src are provided.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct mxArray_tag mxArray;
+
+/* Shim only: C function standing for a MATLAB function handle, returns nonzero on error */
+typedef int (*mexshim_func)(int nlhs, mxArray* plhs[], int nrhs, mxArray* prhs[]);
+
+typedef size_t mwSize;
+typedef size_t mwIndex;
+typedef bool mxLogical;
+typedef uint16_t mxChar;
+
+typedef int8_t int8_T;
+typedef uint8_t uint8_T;
+typedef int16_t int16_T;
+typedef uint16_t uint16_T;
+typedef int32_t int32_T;
+typedef uint32_t uint32_T;
+typedef int64_t int64_T;
+typedef uint64_t uint64_T;
+
+typedef enum
+{
+  mxUNKNOWN_CLASS = 0,
+  mxCELL_CLASS,
+  mxSTRUCT_CLASS,
+  mxLOGICAL_CLASS,
+  mxCHAR_CLASS,
+  mxVOID_CLASS,
+  mxDOUBLE_CLASS,
+  mxSINGLE_CLASS,
+  mxINT8_CLASS,
+  mxUINT8_CLASS,
+  mxINT16_CLASS,
+  mxUINT16_CLASS,
+  mxINT32_CLASS,
+  mxUINT32_CLASS,
+  mxINT64_CLASS,
+  mxUINT64_CLASS,
+  mxFUNCTION_CLASS
+} mxClassID;
+
+typedef enum
+{
+  mxREAL = 0,
+  mxCOMPLEX
+} mxComplexity;
+
+/* Memory management */
+void* mxCalloc(size_t n, size_t size);
+void* mxMalloc(size_t size);
+void* mxRealloc(void* ptr, size_t size);
+void mxFree(void* ptr);
+
+/* Array creation and destruction */
+mxArray* mxCreateDoubleMatrix(mwSize m, mwSize n, mxComplexity flag);
+mxArray* mxCreateDoubleScalar(double value);
+mxArray* mxCreateNumericMatrix(mwSize m, mwSize n, mxClassID classid, mxComplexity flag);
+mxArray* mxCreateLogicalMatrix(mwSize m, mwSize n);
+mxArray* mxCreateSparse(mwSize m, mwSize n, mwSize nzmax, mxComplexity flag);
+mxArray* mxCreateString(const char* str);
+mxArray* mxCreateCharMatrixFromStrings(mwSize m, const char** str);
+mxArray* mxCreateCellMatrix(mwSize m, mwSize n);
+mxArray* mxCreateStructMatrix(mwSize m, mwSize n, int nfields, const char** fieldnames);
+mxArray* mxCreateStructArray(mwSize ndim, const mwSize* dims, int nfields, const char** fieldnames);
+mxArray* mxDuplicateArray(const mxArray* arr);
+void mxDestroyArray(mxArray* arr);
+
+/* Array inspection */
+mxClassID mxGetClassID(const mxArray* arr);
+size_t mxGetElementSize(const mxArray* arr);
+size_t mxGetM(const mxArray* arr);
+size_t mxGetN(const mxArray* arr);
+size_t mxGetNumberOfElements(const mxArray* arr);
+mwSize mxGetNumberOfDimensions(const mxArray* arr);
+const mwSize* mxGetDimensions(const mxArray* arr);
+bool mxIsDouble(const mxArray* arr);
+bool mxIsUint8(const mxArray* arr);
+bool mxIsUint64(const mxArray* arr);
+bool mxIsLogical(const mxArray* arr);
+bool mxIsChar(const mxArray* arr);
+bool mxIsCell(const mxArray* arr);
+bool mxIsStruct(const mxArray* arr);
+bool mxIsNumeric(const mxArray* arr);
+bool mxIsComplex(const mxArray* arr);
+bool mxIsSparse(const mxArray* arr);
+bool mxIsEmpty(const mxArray* arr);
+bool mxIsScalar(const mxArray* arr);
+bool mxIsClass(const mxArray* arr, const char* classname);
+bool mxIsInf(double value);
+bool mxIsNaN(double value);
+double mxGetInf(void);
+double mxGetNaN(void);
+
+/* Array data access */
+double* mxGetPr(const mxArray* arr);
+double* mxGetDoubles(const mxArray* arr);
+void* mxGetData(const mxArray* arr);
+mxLogical* mxGetLogicals(const mxArray* arr);
+double mxGetScalar(const mxArray* arr);
+mwIndex* mxGetIr(const mxArray* arr);
+mwIndex* mxGetJc(const mxArray* arr);
+mwSize mxGetNzmax(const mxArray* arr);
+int mxGetString(const mxArray* arr, char* buf, mwSize buflen);
+
+/* Cell and struct access */
+mxArray* mxGetCell(const mxArray* arr, mwIndex i);
+void mxSetCell(mxArray* arr, mwIndex i, mxArray* value);
+int mxGetNumberOfFields(const mxArray* arr);
+const char* mxGetFieldNameByNumber(const mxArray* arr, int n);
+int mxGetFieldNumber(const mxArray* arr, const char* name);
+mxArray* mxGetField(const mxArray* arr, mwIndex i, const char* name);
+mxArray* mxGetFieldByNumber(const mxArray* arr, mwIndex i, int n);
+void mxSetField(mxArray* arr, mwIndex i, const char* name, mxArray* value);
+void mxSetFieldByNumber(mxArray* arr, mwIndex i, int n, mxArray* value);
+int mxAddField(mxArray* arr, const char* name);
+void mxRemoveField(mxArray* arr, int n);
+
+/* MEX functions */
+int mexPrintf(const char* fmt, ...);
+void mexErrMsgIdAndTxt(const char* errid, const char* fmt, ...);
+int mexEvalString(const char* cmd);
+int mexAtExit(void (*func)(void));
+void mexMakeArrayPersistent(mxArray* arr);
+int mexCallMATLAB(int nlhs, mxArray* plhs[], int nrhs, mxArray* prhs[], const char* fcn);
+mxArray* mexCallMATLABWithTrap(int nlhs, mxArray* plhs[], int nrhs, mxArray* prhs[], const char* fcn);
+
+/* Entry of MEX file */
+void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+
+/* Shim only: call MEX function, return nonzero if it raised an error */
+int MEXSHIM_call(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+/* Shim only: message of the last error raised */
+const char* MEXSHIM_getError(void);
+/* Shim only: suppress output of mexPrintf */
+void MEXSHIM_setQuiet(int isQuiet);
+/* Shim only: run exit functions registered by mexAtExit */
+void MEXSHIM_exit(void);
+/* Shim only: create function handle calling the given C function */
+mxArray* MEXSHIM_createFunction(mexshim_func func);
+/* Shim only: peak bytes of array data and mxCalloc memory held since last reset */
+size_t MEXSHIM_getPeakBytes(void);
+/* Shim only: restart peak tracking, return bytes currently held */
+size_t MEXSHIM_resetPeakBytes(void);
+
+#endif
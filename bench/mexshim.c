@@ -0,0 +1,950 @@
+/* Expose clock_gettime and strdup declarations under -std=c99 */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "mex.h"
+
+#include <math.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct mxArray_tag
+{
+  mxClassID classID;
+  int isSparse;
+  mwSize dims[2];
+
+  /* Numeric, logical and char data, or mxArray* elements of cell and struct */
+  void* data;
+
+  /* Sparse structure */
+  mwSize nzmax;
+  mwIndex* ir;
+  mwIndex* jc;
+
+  /* Struct fields, elements are stored as data[i * nField + j] */
+  int nField;
+  char** fieldNames;
+};
+
+static jmp_buf* MEXSHIM_errJump = NULL;
+static char MEXSHIM_errMsg[4096];
+static int MEXSHIM_isQuiet = 0;
+static void (*MEXSHIM_exitFunc)(void) = NULL;
+
+/* Bytes of array data and mxCalloc memory currently held, and their peak */
+static size_t MEXSHIM_nLiveBytes = 0;
+static size_t MEXSHIM_nPeakBytes = 0;
+
+/* Header in front of every block, keeping its size for accounting */
+typedef union mexshim_head_u
+{
+  size_t size;
+  long double align;
+  void* ptr;
+} mexshim_head;
+
+static void* MEXSHIM_calloc(size_t n, size_t size)
+{
+  size_t nbytes = (n > 0 ? n : 1) * (size > 0 ? size : 1);
+  mexshim_head* head = (mexshim_head*) calloc(1, sizeof(mexshim_head) + nbytes);
+
+  if (!head)
+  {
+    return NULL;
+  }
+
+  head->size = nbytes;
+  MEXSHIM_nLiveBytes += nbytes;
+  if (MEXSHIM_nLiveBytes > MEXSHIM_nPeakBytes)
+  {
+    MEXSHIM_nPeakBytes = MEXSHIM_nLiveBytes;
+  }
+
+  return head + 1;
+}
+
+static void MEXSHIM_free(void* ptr)
+{
+  if (ptr != NULL)
+  {
+    mexshim_head* head = (mexshim_head*) ptr - 1;
+    MEXSHIM_nLiveBytes -= head->size;
+    free(head);
+  }
+}
+
+static void* MEXSHIM_realloc(void* ptr, size_t size)
+{
+  void* nptr = NULL;
+  size_t nold = 0;
+
+  if (ptr == NULL)
+  {
+    return MEXSHIM_calloc(1, size);
+  }
+
+  nold = ((mexshim_head*) ptr - 1)->size;
+  nptr = MEXSHIM_calloc(1, size);
+  if (nptr != NULL)
+  {
+    memcpy(nptr, ptr, nold < size ? nold : size);
+    MEXSHIM_free(ptr);
+  }
+
+  return nptr;
+}
+
+/* Memory management */
+void* mxCalloc(size_t n, size_t size)
+{
+  return MEXSHIM_calloc(n, size);
+}
+
+void* mxMalloc(size_t size)
+{
+  return MEXSHIM_calloc(1, size);
+}
+
+void* mxRealloc(void* ptr, size_t size)
+{
+  return MEXSHIM_realloc(ptr, size);
+}
+
+void mxFree(void* ptr)
+{
+  MEXSHIM_free(ptr);
+}
+
+/* Array creation and destruction */
+static size_t MEXSHIM_classSize(mxClassID classid)
+{
+  switch (classid)
+  {
+  case mxCELL_CLASS:
+  case mxSTRUCT_CLASS:
+    return sizeof(mxArray*);
+  case mxLOGICAL_CLASS:
+    return sizeof(mxLogical);
+  case mxCHAR_CLASS:
+    return sizeof(mxChar);
+  case mxDOUBLE_CLASS:
+    return sizeof(double);
+  case mxSINGLE_CLASS:
+    return sizeof(float);
+  case mxINT8_CLASS:
+  case mxUINT8_CLASS:
+    return 1;
+  case mxINT16_CLASS:
+  case mxUINT16_CLASS:
+    return 2;
+  case mxINT32_CLASS:
+  case mxUINT32_CLASS:
+    return 4;
+  case mxINT64_CLASS:
+  case mxUINT64_CLASS:
+    return 8;
+  case mxFUNCTION_CLASS:
+    return sizeof(mexshim_func);
+  default:
+    return 0;
+  }
+}
+
+static mxArray* MEXSHIM_create(mwSize m, mwSize n, mxClassID classid)
+{
+  mxArray* arr = (mxArray*) MEXSHIM_calloc(1, sizeof(mxArray));
+  if (!arr)
+  {
+    return NULL;
+  }
+
+  arr->classID = classid;
+  arr->dims[0] = m;
+  arr->dims[1] = n;
+  arr->data = MEXSHIM_calloc(m * n > 0 ? m * n : 1, MEXSHIM_classSize(classid));
+  if (!arr->data)
+  {
+    MEXSHIM_free(arr);
+    return NULL;
+  }
+
+  return arr;
+}
+
+mxArray* mxCreateDoubleMatrix(mwSize m, mwSize n, mxComplexity flag)
+{
+  return MEXSHIM_create(m, n, mxDOUBLE_CLASS);
+}
+
+mxArray* mxCreateDoubleScalar(double value)
+{
+  mxArray* arr = MEXSHIM_create(1, 1, mxDOUBLE_CLASS);
+  if (arr)
+  {
+    *(double*) arr->data = value;
+  }
+  return arr;
+}
+
+mxArray* mxCreateNumericMatrix(mwSize m, mwSize n, mxClassID classid, mxComplexity flag)
+{
+  return MEXSHIM_create(m, n, classid);
+}
+
+mxArray* mxCreateLogicalMatrix(mwSize m, mwSize n)
+{
+  return MEXSHIM_create(m, n, mxLOGICAL_CLASS);
+}
+
+mxArray* mxCreateSparse(mwSize m, mwSize n, mwSize nzmax, mxComplexity flag)
+{
+  mxArray* arr = (mxArray*) MEXSHIM_calloc(1, sizeof(mxArray));
+  if (!arr)
+  {
+    return NULL;
+  }
+
+  nzmax = nzmax > 0 ? nzmax : 1;
+  arr->classID = mxDOUBLE_CLASS;
+  arr->isSparse = 1;
+  arr->dims[0] = m;
+  arr->dims[1] = n;
+  arr->nzmax = nzmax;
+  arr->data = MEXSHIM_calloc(nzmax, sizeof(double));
+  arr->ir = (mwIndex*) MEXSHIM_calloc(nzmax, sizeof(mwIndex));
+  arr->jc = (mwIndex*) MEXSHIM_calloc(n + 1, sizeof(mwIndex));
+  if (!arr->data || !arr->ir || !arr->jc)
+  {
+    mxDestroyArray(arr);
+    return NULL;
+  }
+
+  return arr;
+}
+
+mxArray* mxCreateString(const char* str)
+{
+  size_t len = strlen(str);
+  mxArray* arr = MEXSHIM_create(len > 0 ? 1 : 0, len, mxCHAR_CLASS);
+  if (arr)
+  {
+    for (size_t i = 0; i < len; ++i)
+    {
+      ((mxChar*) arr->data)[i] = (unsigned char) str[i];
+    }
+  }
+  return arr;
+}
+
+mxArray* mxCreateCharMatrixFromStrings(mwSize m, const char** str)
+{
+  size_t maxlen = 0;
+  mxArray* arr = NULL;
+
+  for (mwSize i = 0; i < m; ++i)
+  {
+    size_t len = strlen(str[i]);
+    maxlen = len > maxlen ? len : maxlen;
+  }
+
+  arr = MEXSHIM_create(m, maxlen, mxCHAR_CLASS);
+  if (arr)
+  {
+    for (mwSize i = 0; i < m; ++i)
+    {
+      size_t len = strlen(str[i]);
+      for (size_t j = 0; j < maxlen; ++j)
+      {
+        ((mxChar*) arr->data)[j * m + i] = j < len ? (unsigned char) str[i][j] : ' ';
+      }
+    }
+  }
+  return arr;
+}
+
+mxArray* mxCreateCellMatrix(mwSize m, mwSize n)
+{
+  return MEXSHIM_create(m, n, mxCELL_CLASS);
+}
+
+mxArray* mxCreateStructMatrix(mwSize m, mwSize n, int nfields, const char** fieldnames)
+{
+  mxArray* arr = (mxArray*) MEXSHIM_calloc(1, sizeof(mxArray));
+  if (!arr)
+  {
+    return NULL;
+  }
+
+  arr->classID = mxSTRUCT_CLASS;
+  arr->dims[0] = m;
+  arr->dims[1] = n;
+  arr->data = MEXSHIM_calloc(m * n * nfields > 0 ? m * n * nfields : 1, sizeof(mxArray*));
+  arr->fieldNames = (char**) MEXSHIM_calloc(nfields > 0 ? nfields : 1, sizeof(char*));
+  if (!arr->data || !arr->fieldNames)
+  {
+    mxDestroyArray(arr);
+    return NULL;
+  }
+
+  for (int j = 0; j < nfields; ++j)
+  {
+    arr->fieldNames[j] = strdup(fieldnames[j]);
+  }
+  arr->nField = nfields;
+
+  return arr;
+}
+
+mxArray* mxCreateStructArray(mwSize ndim, const mwSize* dims, int nfields, const char** fieldnames)
+{
+  mwSize n = 1;
+  for (mwSize i = 1; i < ndim; ++i)
+  {
+    n *= dims[i];
+  }
+  return mxCreateStructMatrix(ndim > 0 ? dims[0] : 0, n, nfields, fieldnames);
+}
+
+mxArray* mxDuplicateArray(const mxArray* arr)
+{
+  mxArray* dup = NULL;
+  size_t nelem = 0;
+
+  if (arr == NULL)
+  {
+    return NULL;
+  }
+
+  if (arr->isSparse)
+  {
+    dup = mxCreateSparse(arr->dims[0], arr->dims[1], arr->nzmax, mxREAL);
+    if (dup)
+    {
+      memcpy(dup->data, arr->data, arr->nzmax * sizeof(double));
+      memcpy(dup->ir, arr->ir, arr->nzmax * sizeof(mwIndex));
+      memcpy(dup->jc, arr->jc, (arr->dims[1] + 1) * sizeof(mwIndex));
+    }
+    return dup;
+  }
+
+  nelem = arr->dims[0] * arr->dims[1];
+  if (arr->classID == mxSTRUCT_CLASS)
+  {
+    dup = mxCreateStructMatrix(arr->dims[0], arr->dims[1], arr->nField, (const char**) arr->fieldNames);
+    if (dup)
+    {
+      for (size_t i = 0; i < nelem * arr->nField; ++i)
+      {
+        ((mxArray**) dup->data)[i] = mxDuplicateArray(((mxArray**) arr->data)[i]);
+      }
+    }
+  }
+  else if (arr->classID == mxCELL_CLASS)
+  {
+    dup = mxCreateCellMatrix(arr->dims[0], arr->dims[1]);
+    if (dup)
+    {
+      for (size_t i = 0; i < nelem; ++i)
+      {
+        ((mxArray**) dup->data)[i] = mxDuplicateArray(((mxArray**) arr->data)[i]);
+      }
+    }
+  }
+  else
+  {
+    dup = MEXSHIM_create(arr->dims[0], arr->dims[1], arr->classID);
+    if (dup)
+    {
+      memcpy(dup->data, arr->data, nelem * MEXSHIM_classSize(arr->classID));
+    }
+  }
+
+  return dup;
+}
+
+void mxDestroyArray(mxArray* arr)
+{
+  size_t nelem = 0;
+
+  if (arr == NULL)
+  {
+    return;
+  }
+
+  nelem = arr->dims[0] * arr->dims[1];
+  if (arr->classID == mxSTRUCT_CLASS && arr->data != NULL)
+  {
+    for (size_t i = 0; i < nelem * arr->nField; ++i)
+    {
+      mxDestroyArray(((mxArray**) arr->data)[i]);
+    }
+  }
+  else if (arr->classID == mxCELL_CLASS && arr->data != NULL)
+  {
+    for (size_t i = 0; i < nelem; ++i)
+    {
+      mxDestroyArray(((mxArray**) arr->data)[i]);
+    }
+  }
+
+  if (arr->fieldNames != NULL)
+  {
+    for (int j = 0; j < arr->nField; ++j)
+    {
+      free(arr->fieldNames[j]);
+    }
+    MEXSHIM_free(arr->fieldNames);
+  }
+
+  MEXSHIM_free(arr->data);
+  MEXSHIM_free(arr->ir);
+  MEXSHIM_free(arr->jc);
+  MEXSHIM_free(arr);
+}
+
+/* Array inspection */
+mxClassID mxGetClassID(const mxArray* arr)
+{
+  return arr->classID;
+}
+
+size_t mxGetElementSize(const mxArray* arr)
+{
+  return MEXSHIM_classSize(arr->classID);
+}
+
+size_t mxGetM(const mxArray* arr)
+{
+  return arr->dims[0];
+}
+
+size_t mxGetN(const mxArray* arr)
+{
+  return arr->dims[1];
+}
+
+size_t mxGetNumberOfElements(const mxArray* arr)
+{
+  return arr->dims[0] * arr->dims[1];
+}
+
+mwSize mxGetNumberOfDimensions(const mxArray* arr)
+{
+  return 2;
+}
+
+const mwSize* mxGetDimensions(const mxArray* arr)
+{
+  return arr->dims;
+}
+
+bool mxIsDouble(const mxArray* arr)
+{
+  return arr->classID == mxDOUBLE_CLASS;
+}
+
+bool mxIsUint8(const mxArray* arr)
+{
+  return arr->classID == mxUINT8_CLASS;
+}
+
+bool mxIsUint64(const mxArray* arr)
+{
+  return arr->classID == mxUINT64_CLASS;
+}
+
+bool mxIsLogical(const mxArray* arr)
+{
+  return arr->classID == mxLOGICAL_CLASS;
+}
+
+bool mxIsChar(const mxArray* arr)
+{
+  return arr->classID == mxCHAR_CLASS;
+}
+
+bool mxIsCell(const mxArray* arr)
+{
+  return arr->classID == mxCELL_CLASS;
+}
+
+bool mxIsStruct(const mxArray* arr)
+{
+  return arr->classID == mxSTRUCT_CLASS;
+}
+
+bool mxIsNumeric(const mxArray* arr)
+{
+  return arr->classID >= mxDOUBLE_CLASS && arr->classID <= mxUINT64_CLASS;
+}
+
+bool mxIsComplex(const mxArray* arr)
+{
+  return false;
+}
+
+bool mxIsSparse(const mxArray* arr)
+{
+  return arr->isSparse != 0;
+}
+
+bool mxIsEmpty(const mxArray* arr)
+{
+  return arr->dims[0] * arr->dims[1] == 0;
+}
+
+bool mxIsScalar(const mxArray* arr)
+{
+  return arr->dims[0] == 1 && arr->dims[1] == 1;
+}
+
+bool mxIsClass(const mxArray* arr, const char* classname)
+{
+  static const struct
+  {
+    mxClassID classID;
+    const char* name;
+  } classNames[] = {{mxCELL_CLASS, "cell"},        {mxSTRUCT_CLASS, "struct"},   {mxLOGICAL_CLASS, "logical"},
+                    {mxCHAR_CLASS, "char"},        {mxDOUBLE_CLASS, "double"},   {mxSINGLE_CLASS, "single"},
+                    {mxINT8_CLASS, "int8"},        {mxUINT8_CLASS, "uint8"},     {mxINT16_CLASS, "int16"},
+                    {mxUINT16_CLASS, "uint16"},    {mxINT32_CLASS, "int32"},     {mxUINT32_CLASS, "uint32"},
+                    {mxINT64_CLASS, "int64"},      {mxUINT64_CLASS, "uint64"},
+                    {mxFUNCTION_CLASS, "function_handle"}};
+
+  for (size_t i = 0; i < sizeof(classNames) / sizeof(classNames[0]); ++i)
+  {
+    if (strcmp(classNames[i].name, classname) == 0)
+    {
+      return arr->classID == classNames[i].classID;
+    }
+  }
+
+  return false;
+}
+
+bool mxIsInf(double value)
+{
+  return isinf(value) != 0;
+}
+
+bool mxIsNaN(double value)
+{
+  return isnan(value) != 0;
+}
+
+double mxGetInf(void)
+{
+  return INFINITY;
+}
+
+double mxGetNaN(void)
+{
+  return NAN;
+}
+
+/* Array data access */
+double* mxGetPr(const mxArray* arr)
+{
+  return (double*) arr->data;
+}
+
+double* mxGetDoubles(const mxArray* arr)
+{
+  return arr->classID == mxDOUBLE_CLASS ? (double*) arr->data : NULL;
+}
+
+void* mxGetData(const mxArray* arr)
+{
+  return arr->data;
+}
+
+mxLogical* mxGetLogicals(const mxArray* arr)
+{
+  return arr->classID == mxLOGICAL_CLASS ? (mxLogical*) arr->data : NULL;
+}
+
+double mxGetScalar(const mxArray* arr)
+{
+  if (arr->dims[0] * arr->dims[1] == 0 || (arr->isSparse && arr->jc[1] == 0))
+  {
+    return 0.0;
+  }
+
+  switch (arr->classID)
+  {
+  case mxDOUBLE_CLASS:
+    return ((double*) arr->data)[0];
+  case mxSINGLE_CLASS:
+    return ((float*) arr->data)[0];
+  case mxLOGICAL_CLASS:
+    return ((mxLogical*) arr->data)[0];
+  case mxCHAR_CLASS:
+    return ((mxChar*) arr->data)[0];
+  case mxINT8_CLASS:
+    return ((int8_t*) arr->data)[0];
+  case mxUINT8_CLASS:
+    return ((uint8_t*) arr->data)[0];
+  case mxINT16_CLASS:
+    return ((int16_t*) arr->data)[0];
+  case mxUINT16_CLASS:
+    return ((uint16_t*) arr->data)[0];
+  case mxINT32_CLASS:
+    return ((int32_t*) arr->data)[0];
+  case mxUINT32_CLASS:
+    return ((uint32_t*) arr->data)[0];
+  case mxINT64_CLASS:
+    return (double) ((int64_t*) arr->data)[0];
+  case mxUINT64_CLASS:
+    return (double) ((uint64_t*) arr->data)[0];
+  default:
+    return 0.0;
+  }
+}
+
+mwIndex* mxGetIr(const mxArray* arr)
+{
+  return arr->ir;
+}
+
+mwIndex* mxGetJc(const mxArray* arr)
+{
+  return arr->jc;
+}
+
+mwSize mxGetNzmax(const mxArray* arr)
+{
+  return arr->nzmax;
+}
+
+int mxGetString(const mxArray* arr, char* buf, mwSize buflen)
+{
+  size_t nelem = arr->dims[0] * arr->dims[1];
+  size_t i = 0;
+
+  if (arr->classID != mxCHAR_CLASS || buflen == 0)
+  {
+    return 1;
+  }
+
+  for (i = 0; i < nelem && i + 1 < buflen; ++i)
+  {
+    buf[i] = (char) ((mxChar*) arr->data)[i];
+  }
+  buf[i] = '\0';
+
+  return i < nelem ? 1 : 0;
+}
+
+/* Cell and struct access */
+mxArray* mxGetCell(const mxArray* arr, mwIndex i)
+{
+  return ((mxArray**) arr->data)[i];
+}
+
+void mxSetCell(mxArray* arr, mwIndex i, mxArray* value)
+{
+  ((mxArray**) arr->data)[i] = value;
+}
+
+int mxGetNumberOfFields(const mxArray* arr)
+{
+  return arr->nField;
+}
+
+const char* mxGetFieldNameByNumber(const mxArray* arr, int n)
+{
+  return n >= 0 && n < arr->nField ? arr->fieldNames[n] : NULL;
+}
+
+int mxGetFieldNumber(const mxArray* arr, const char* name)
+{
+  for (int j = 0; j < arr->nField; ++j)
+  {
+    if (strcmp(arr->fieldNames[j], name) == 0)
+    {
+      return j;
+    }
+  }
+  return -1;
+}
+
+mxArray* mxGetFieldByNumber(const mxArray* arr, mwIndex i, int n)
+{
+  return ((mxArray**) arr->data)[i * arr->nField + n];
+}
+
+mxArray* mxGetField(const mxArray* arr, mwIndex i, const char* name)
+{
+  int n = 0;
+
+  if (arr == NULL || arr->classID != mxSTRUCT_CLASS)
+  {
+    return NULL;
+  }
+
+  n = mxGetFieldNumber(arr, name);
+  return n >= 0 ? mxGetFieldByNumber(arr, i, n) : NULL;
+}
+
+void mxSetFieldByNumber(mxArray* arr, mwIndex i, int n, mxArray* value)
+{
+  ((mxArray**) arr->data)[i * arr->nField + n] = value;
+}
+
+void mxSetField(mxArray* arr, mwIndex i, const char* name, mxArray* value)
+{
+  int n = mxGetFieldNumber(arr, name);
+  if (n >= 0)
+  {
+    mxSetFieldByNumber(arr, i, n, value);
+  }
+}
+
+int mxAddField(mxArray* arr, const char* name)
+{
+  size_t nelem = arr->dims[0] * arr->dims[1];
+  int n = mxGetFieldNumber(arr, name);
+  mxArray** data = NULL;
+  char** names = NULL;
+
+  if (n >= 0)
+  {
+    return n;
+  }
+
+  data = (mxArray**) MEXSHIM_calloc(nelem * (arr->nField + 1) > 0 ? nelem * (arr->nField + 1) : 1, sizeof(mxArray*));
+  names = (char**) MEXSHIM_calloc(arr->nField + 1, sizeof(char*));
+  if (!data || !names)
+  {
+    MEXSHIM_free(data);
+    MEXSHIM_free(names);
+    return -1;
+  }
+
+  for (size_t i = 0; i < nelem; ++i)
+  {
+    for (int j = 0; j < arr->nField; ++j)
+    {
+      data[i * (arr->nField + 1) + j] = ((mxArray**) arr->data)[i * arr->nField + j];
+    }
+  }
+  if (arr->nField > 0)
+  {
+    memcpy(names, arr->fieldNames, arr->nField * sizeof(char*));
+  }
+  names[arr->nField] = strdup(name);
+
+  MEXSHIM_free(arr->data);
+  MEXSHIM_free(arr->fieldNames);
+  arr->data = data;
+  arr->fieldNames = names;
+
+  return arr->nField++;
+}
+
+void mxRemoveField(mxArray* arr, int n)
+{
+  size_t nelem = arr->dims[0] * arr->dims[1];
+  mxArray** data = (mxArray**) arr->data;
+  size_t k = 0;
+
+  if (n < 0 || n >= arr->nField)
+  {
+    return;
+  }
+
+  for (size_t i = 0; i < nelem; ++i)
+  {
+    for (int j = 0; j < arr->nField; ++j)
+    {
+      if (j == n)
+      {
+        mxDestroyArray(data[i * arr->nField + j]);
+      }
+      else
+      {
+        data[k++] = data[i * arr->nField + j];
+      }
+    }
+  }
+
+  free(arr->fieldNames[n]);
+  memmove(arr->fieldNames + n, arr->fieldNames + n + 1, (arr->nField - n - 1) * sizeof(char*));
+  arr->nField--;
+}
+
+/* MEX functions */
+int mexPrintf(const char* fmt, ...)
+{
+  int nchar = 0;
+  va_list args;
+
+  if (MEXSHIM_isQuiet)
+  {
+    return 0;
+  }
+
+  va_start(args, fmt);
+  nchar = vprintf(fmt, args);
+  va_end(args);
+
+  return nchar;
+}
+
+void mexErrMsgIdAndTxt(const char* errid, const char* fmt, ...)
+{
+  int nchar = 0;
+  va_list args;
+
+  nchar = snprintf(MEXSHIM_errMsg, sizeof(MEXSHIM_errMsg), "%s: ", errid);
+  va_start(args, fmt);
+  vsnprintf(MEXSHIM_errMsg + nchar, sizeof(MEXSHIM_errMsg) - nchar, fmt, args);
+  va_end(args);
+
+  if (MEXSHIM_errJump == NULL)
+  {
+    fprintf(stderr, "%s\n", MEXSHIM_errMsg);
+    abort();
+  }
+
+  longjmp(*MEXSHIM_errJump, 1);
+}
+
+int mexEvalString(const char* cmd)
+{
+  fflush(stdout);
+  return 0;
+}
+
+int mexAtExit(void (*func)(void))
+{
+  MEXSHIM_exitFunc = func;
+  return 0;
+}
+
+void mexMakeArrayPersistent(mxArray* arr)
+{
+}
+
+/* Only feval of function handles created by MEXSHIM_createFunction, and rethrow of trapped errors */
+mxArray* mexCallMATLABWithTrap(int nlhs, mxArray* plhs[], int nrhs, mxArray* prhs[], const char* fcn)
+{
+  mexshim_func func = NULL;
+
+  if (strcmp(fcn, "feval") != 0 || nrhs < 1 || prhs[0]->classID != mxFUNCTION_CLASS)
+  {
+    return mxCreateString("MEXSHIM:call: unsupported call");
+  }
+
+  func = *(mexshim_func*) prhs[0]->data;
+  if (func(nlhs, plhs, nrhs - 1, prhs + 1) != 0)
+  {
+    return mxCreateString("MEXSHIM:call: function handle raised an error");
+  }
+
+  return NULL;
+}
+
+/* Errors are plain messages outside MATLAB, created by MException and raised by rethrow */
+int mexCallMATLAB(int nlhs, mxArray* plhs[], int nrhs, mxArray* prhs[], const char* fcn)
+{
+  char msg[1024];
+  mxArray* except = NULL;
+
+  if (strcmp(fcn, "rethrow") == 0 && nrhs == 1 && prhs[0]->classID == mxCHAR_CLASS)
+  {
+    mxGetString(prhs[0], msg, sizeof(msg));
+    mexErrMsgIdAndTxt("MEXSHIM:rethrow", "%s", msg);
+  }
+  if (strcmp(fcn, "MException") == 0 && nlhs == 1 && nrhs == 3 && prhs[2]->classID == mxCHAR_CLASS)
+  {
+    mxGetString(prhs[2], msg, sizeof(msg));
+    plhs[0] = mxCreateString(msg);
+    return 0;
+  }
+
+  except = mexCallMATLABWithTrap(nlhs, plhs, nrhs, prhs, fcn);
+  if (except != NULL)
+  {
+    mxGetString(except, msg, sizeof(msg));
+    mxDestroyArray(except);
+    mexErrMsgIdAndTxt("MEXSHIM:call", "%s", msg);
+  }
+
+  return 0;
+}
+
+/* Ctrl-C is never pending outside MATLAB */
+int utIsInterruptPending(void)
+{
+  return 0;
+}
+
+void utSetInterruptPending(int isPending)
+{
+}
+
+/* Shim only functions */
+int MEXSHIM_call(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+{
+  jmp_buf errJump;
+  jmp_buf* prevJump = MEXSHIM_errJump;
+
+  MEXSHIM_errMsg[0] = '\0';
+  MEXSHIM_errJump = &errJump;
+  if (setjmp(errJump) != 0)
+  {
+    MEXSHIM_errJump = prevJump;
+    return 1;
+  }
+
+  mexFunction(nlhs, plhs, nrhs, prhs);
+
+  MEXSHIM_errJump = prevJump;
+  return 0;
+}
+
+const char* MEXSHIM_getError(void)
+{
+  return MEXSHIM_errMsg;
+}
+
+void MEXSHIM_setQuiet(int isQuiet)
+{
+  MEXSHIM_isQuiet = isQuiet;
+}
+
+void MEXSHIM_exit(void)
+{
+  if (MEXSHIM_exitFunc != NULL)
+  {
+    MEXSHIM_exitFunc();
+    MEXSHIM_exitFunc = NULL;
+  }
+}
+
+mxArray* MEXSHIM_createFunction(mexshim_func func)
+{
+  mxArray* arr = MEXSHIM_create(1, 1, mxFUNCTION_CLASS);
+  if (arr)
+  {
+    *(mexshim_func*) arr->data = func;
+  }
+  return arr;
+}
+
+size_t MEXSHIM_getPeakBytes(void)
+{
+  return MEXSHIM_nPeakBytes;
+}
+
+size_t MEXSHIM_resetPeakBytes(void)
+{
+  MEXSHIM_nPeakBytes = MEXSHIM_nLiveBytes;
+  return MEXSHIM_nLiveBytes;
+}
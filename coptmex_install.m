@@ -23,6 +23,12 @@ addpath(coptmex_path)
 savepath;
 fprintf('Add and save path %s to MATLAB search path.\n', coptmex_path);
 
+% Remove MEX files of earlier versions, which would shadow the M files
+coptmex_old = dir(fullfile(coptmex_path, ['copt_*.' mexext]));
+for i = 1:numel(coptmex_old)
+  delete(fullfile(coptmex_path, coptmex_old(i).name));
+end
+
 coptmex_ver = copt_solve();
 fprintf('MATLAB interface for COPT v%d.%d.%d was installed.\n', coptmex_ver.major, coptmex_ver.minor, coptmex_ver.technical);
 
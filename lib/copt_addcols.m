@@ -0,0 +1,46 @@
+function varargout = copt_addcols(varargin)
+% copt_addcols
+%
+% solution = copt_addcols(handle, obj, A)
+% solution = copt_addcols(handle, obj, A, lb)
+% solution = copt_addcols(handle, obj, A, lb, ub)
+%
+% This function appends columns to a problem kept by copt_solve and re-solves
+% it from the basis of the previous solve, as in each iteration of column
+% generation. Only the new columns are passed to COPT, and only the status,
+% objective value and duals are returned.
+%
+% Input arguments:
+% -----------------
+% handle:
+%   A uint64 scalar returned as the second output of copt_solve.
+%
+% obj:
+%   A vector of objective costs of the new columns.
+%
+% A:
+%   A sparse or dense matrix with one column per new column and one row per
+%   constraint of the problem.
+%
+% lb (optional):
+%   A vector of lower bounds of the new columns (default: 0).
+%
+% ub (optional):
+%   A vector of upper bounds of the new columns (default: inf).
+%
+% Output arguments:
+% ------------------
+% solution (optional):
+%   A MATLAB struct with fields 'status', 'objval' and 'pi'.
+%
+% Examples usages:
+% -----------------
+%   [solution, handle] = copt_solve(master);
+%   [obj, A] = pricing(solution.pi);
+%   while ~isempty(obj)
+%     solution = copt_addcols(handle, obj, A);
+%     [obj, A] = pricing(solution.pi);
+%   end
+%   copt_free(handle);
+
+[varargout{1:nargout}] = coptmex('addcols', varargin{:});
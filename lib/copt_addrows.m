@@ -0,0 +1,42 @@
+function varargout = copt_addrows(varargin)
+% copt_addrows
+%
+% solution = copt_addrows(handle, A, sense, rhs)
+%
+% This function appends rows to a problem kept by copt_solve and re-solves it
+% from the basis of the previous solve with dual simplex, as in each iteration
+% of a cutting plane or Benders loop. Only the new rows are passed to COPT,
+% and only the status, objective value, primal values and slacks are
+% returned.
+%
+% Input arguments:
+% -----------------
+% handle:
+%   A uint64 scalar returned as the second output of copt_solve.
+%
+% A:
+%   A sparse or dense matrix with one row per new row and one column per
+%   column of the problem.
+%
+% sense:
+%   A char vector of senses of the new rows, each of 'L', 'G' or 'E'.
+%
+% rhs:
+%   A vector of right hand sides of the new rows.
+%
+% Output arguments:
+% ------------------
+% solution (optional):
+%   A MATLAB struct with fields 'status', 'objval', 'x' and 'slack'.
+%
+% Examples usages:
+% -----------------
+%   [solution, handle] = copt_solve(master);
+%   [A, sense, rhs] = separate(solution.x);
+%   while ~isempty(rhs)
+%     solution = copt_addrows(handle, A, sense, rhs);
+%     [A, sense, rhs] = separate(solution.x);
+%   end
+%   copt_free(handle);
+
+[varargout{1:nargout}] = coptmex('addrows', varargin{:});
@@ -0,0 +1,40 @@
+function varargout = copt_cache(varargin)
+% copt_cache
+%
+% info = copt_cache()
+% info = copt_cache('info')
+% copt_cache('clear')
+% nremoved = copt_cache('clear')
+%
+% This function inspects or clears the binary model cache. The cache is
+% enabled by setting the environment variable 'COPTMEX_CACHEDIR' to an
+% existing directory. Models read from MPS, LP, SDPA or CBF files by
+% copt_read, copt_solve, copt_computeiis and copt_tune are then saved there
+% in COPT binary format, keyed by file path, size, modification time and
+% content, and later reads of the same file load the binary copy instead.
+% The total size is limited by 'COPTMEX_CACHESIZE' in megabytes (4096 by
+% default), and least recently used models are removed first.
+%
+% Input arguments:
+% -----------------
+% cmd (optional):
+%   'info' (default) or 'clear'.
+%
+% Output arguments:
+% ------------------
+% info:
+%   A MATLAB struct with fields 'dir', 'nfiles', 'size' and 'maxsize', where
+%   sizes are in bytes.
+%
+% nremoved (optional):
+%   Number of cached models removed.
+%
+% Example usages:
+% ----------------
+%   setenv('COPTMEX_CACHEDIR', tempdir);
+%   problem = copt_read('huge.mps.gz');   % parse and save binary copy
+%   problem = copt_read('huge.mps.gz');   % load binary copy
+%   info = copt_cache();
+%   copt_cache('clear');
+
+[varargout{1:nargout}] = coptmex('cache', varargin{:});
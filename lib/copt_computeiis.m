@@ -1,12 +1,17 @@
+function varargout = copt_computeiis(varargin)
 % copt_computeiis
 %
 % iisinfo = copt_computeiis(probfile)
 % iisinfo = copt_computeiis(probfile, parameter)
 % iisinfo = copt_computeiis(problem)
 % iisinfo = copt_computeiis(problem, parameter)
+% iisinfo = copt_computeiis(probfiles, parameter)
+% iisinfo = copt_computeiis(problems, parameter)
 %
 % This function computes Irreducible Inconsistent Subsystem (IIS) for an
-% infeasible problem. 
+% infeasible problem. Given a cell array of files or a struct array of
+% problems, IIS are computed concurrently, using parameter.BatchThreads
+% threads (default: number of logical processors).
 %
 % Input arguments:
 % ------------------
@@ -16,13 +21,24 @@
 % problem (optional):
 %   A MATLAB struct that specify a valid COPT problem.
 %
+% probfiles (optional):
+%   A cell array of problem file names.
+%
+% problems (optional):
+%   A MATLAB struct array of valid COPT problems.
+%
 % parameter (optional):
 %   A MATLAB struct that specify customized parameters.
 %
 % Output arguments:
 % -------------------
 % iisinfo (optional):
-%   A MATLAB struct that represent IIS information.
+%   A MATLAB struct that represent IIS information. If stopped by
+%   parameter.TimeLimit or Ctrl-C, the conflict set found so far is returned
+%   with 'iscomplete' set to 0. In batch mode, a struct
+%   array with an extra field 'iistime' for seconds spent on each problem,
+%   where the time limit applies to the whole batch and 'iscomplete' tells
+%   whether each problem finished before the batch was stopped.
 %
 % Examples usages:
 % ------------------
@@ -38,3 +54,7 @@
 %   problem = copt_read('inf_lp.mps')
 %   iisinfo = copt_computeiis(problem, parameter);
 %
+%   parameter.BatchThreads = 4;
+%   iisinfo = copt_computeiis({'inf_lp.mps', 'inf_mip.mps'}, parameter);
+
+[varargout{1:nargout}] = coptmex('computeiis', varargin{:});
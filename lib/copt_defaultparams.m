@@ -1,6 +1,25 @@
+function varargout = copt_defaultparams(varargin)
 % copt_defaultparams
 %
 % params = copt_defaultparams()
+% [params, info] = copt_defaultparams()
 %
 % This function generates default parameter settings of COPT as a MATLAB struct.
-%
\ No newline at end of file
+%
+% Output arguments:
+% ------------------
+% params:
+%   A MATLAB struct with one field per parameter set to its default value.
+%
+% info (optional):
+%   A MATLAB struct that describes the same parameters in column vectors,
+%   with fields 'name' and 'type' (cell arrays, type is 'double' or
+%   'integer'), and 'min', 'max' and 'default' (double vectors).
+%
+% Example usages:
+% ----------------
+%   [params, info] = copt_defaultparams();
+%   isint = strcmp(info.type, 'integer');
+%   disp(table(info.name(isint), info.min(isint), info.max(isint)));
+
+[varargout{1:nargout}] = coptmex('defaultparams', varargin{:});
@@ -0,0 +1,23 @@
+function copt_delrows(handle, rows)
+% copt_delrows
+%
+% copt_delrows(handle, rows)
+%
+% This function deletes rows of a problem kept by copt_solve, such as cuts
+% that are no longer active. The remaining rows keep their order and are
+% renumbered. The problem is re-solved by the next call of copt_addrows.
+%
+% Input arguments:
+% -----------------
+% handle:
+%   A uint64 scalar returned as the second output of copt_solve.
+%
+% rows:
+%   A vector of 1-based indices of the rows to delete.
+%
+% Examples usages:
+% -----------------
+%   solution = copt_addrows(handle, A, sense, rhs);
+%   copt_delrows(handle, ncons + find(solution.slack(ncons+1:end) > 1e-6));
+
+coptmex('delrows', handle, rows);
@@ -1,9 +1,12 @@
+function varargout = copt_feasrelax(varargin)
 % copt_feasrelax
 %
 % relaxinfo = copt_feasrelax(problem, penalties)
 % relaxinfo = copt_feasrelax(problem, penalties, parameter)
+% [relaxinfo, relaxproblem] = copt_feasrelax(...)
 %
 % This function computes feasibility relaxation for an infeasible problem. 
+% The relaxed problem is written to file only when parameter.RelaxFile is set.
 %
 % Input arguments:
 % ------------------
@@ -11,15 +14,24 @@
 %   A MATLAB struct that specify a valid COPT problem.
 %
 % penalties:
-%   A MATLAB struct that specify penalties.
+%   A MATLAB struct that specify penalties. Fields may be matrices with one
+%   column per weighting, or a struct array gives one weighting per element.
+%   The problem is loaded once and relaxed for each weighting in turn.
 %
 % parameter (optional):
-%   A MATLAB struct that specify customized parameters.
+%   A MATLAB struct that specify customized parameters. The 'RelaxFile'
+%   field gives the name of file to write the relaxed problem.
 %
 % Output arguments:
 % -------------------
 % relaxinfo (optional):
-%   A MATLAB struct that represent feasibility relaxation information.
+%   A MATLAB struct that represent feasibility relaxation information. For
+%   multiple weightings, 'relaxobj' is a row vector and the other fields
+%   are matrices with one column per weighting.
+%
+% relaxproblem (optional):
+%   A MATLAB struct that represent the relaxed problem (of the last
+%   weighting).
 %
 % Examples usages:
 % ------------------
@@ -35,3 +47,10 @@
 %   parameter.feasrelaxmode = 1;
 %   relaxinfo = copt_feasrelax(problem, penalties, parameter);
 %
+%   parameter.RelaxFile = 'inf_lp.relax';
+%   [relaxinfo, relaxproblem] = copt_feasrelax(problem, penalties, parameter);
+%
+%   penalties.lbpen = [ones(length(problem.lb), 1), 10 * ones(length(problem.lb), 1)];
+%   relaxinfo = copt_feasrelax(problem, penalties);
+
+[varargout{1:nargout}] = coptmex('feasrelax', varargin{:});
@@ -0,0 +1,19 @@
+function copt_free(handle)
+% copt_free
+%
+% copt_free(handle)
+%
+% This function deletes a problem kept by copt_solve. The handle can not be
+% used afterwards.
+%
+% Input arguments:
+% -----------------
+% handle:
+%   A uint64 scalar returned as the second output of copt_solve.
+%
+% Examples usages:
+% -----------------
+%   [solution, handle] = copt_solve('diet.mps');
+%   copt_free(handle);
+
+coptmex('free', handle);
@@ -123,31 +123,20 @@ else
 end
 
 %% Construct COPT problem
-problem.A = [sparse(A); sparse(Aeq)];
-ncol = size(problem.A, 2);
-
+% Blocks are stacked and defaults are filled by 'copt_solveprog'
 if isprobonly == 1
-  problem.obj = fcost;
-else
-  problem.obj = f;
-end
-if ~isempty(lb)
-  problem.lb = lb;
-else
-  problem.lb = -inf(ncol, 1);
-end
-if ~isempty(ub)
-  problem.ub = ub;
+  problem.f = fcost;
 else
-  problem.ub = inf(ncol, 1);
-end
-problem.vtype = repmat('C', ncol, 1);
-problem.vtype(intcon) = 'I';
-problem.sense = [repmat('L', size(A, 1), 1); repmat('E', size(Aeq, 1), 1)];
-problem.rhs = full([b(:); beq(:)]);
-if ~isempty(x0)
-  problem.start = x0;
+  problem.f = f;
 end
+problem.intcon = intcon;
+problem.Aineq = A;
+problem.bineq = b;
+problem.Aeq = Aeq;
+problem.beq = beq;
+problem.lb = lb;
+problem.ub = ub;
+problem.x0 = x0;
 
 %% Constuct optimization parameters
 parameter = struct();
@@ -223,7 +212,7 @@ if isfield(options, 'IntegerTolerance') || ismexoptim == 1
 end
 
 %% Solve the problem
-solution = copt_solve(problem, parameter);
+solution = coptmex('solveprog', problem, parameter);
 
 %% Construct the MIP solution
 % 'x'
@@ -268,17 +257,8 @@ else
   output.numfeaspoints = 0;
 end
 output.numnodes = solution.nodecnt;
-if isfield(solution, 'x')
-  slack = problem.A * solution.x - problem.rhs;
-  vio_A = slack(1:size(A, 1));
-  vio_Aeq = norm(slack((size(A, 1) + 1):end), inf);
-  vio_lb = problem.lb(:) - solution.x;
-  if isfield(problem, 'ub')
-    vio_ub = solution.x - problem.ub(:);
-  else
-    vio_ub = 0;
-  end
-  output.constrviolation = max([0; vio_A; vio_Aeq; vio_lb; vio_ub]);
+if isfield(solution, 'primalviol')
+  output.constrviolation = solution.primalviol;
 else
   output.constrviolation = [];
 end
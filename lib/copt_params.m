@@ -0,0 +1,31 @@
+function varargout = copt_params(varargin)
+% copt_params
+%
+% handle = copt_params(parameter)
+%
+% This function validates a parameter struct and resolves the parameter
+% names and types once into a handle. Passing the handle to copt_solve or
+% copt_solveprog applies the parameters without looking them up again,
+% which saves time when the same parameters are used for many solves.
+%
+% Input arguments:
+% -----------------
+% parameter:
+%   A MATLAB struct that specify customized parameters. Of the parameters
+%   handled by the interface, only 'LogFile', 'Logging' and 'Timing' are
+%   accepted.
+%
+% Output arguments:
+% ------------------
+% handle:
+%   A uint8 vector that holds the resolved parameters. Its content should not
+%   be modified.
+%
+% Example usages:
+% ----------------
+%   parameter.timelimit = 10;
+%   parameter.logging   = 0;
+%   handle   = copt_params(parameter);
+%   solution = copt_solve('diet.mps', handle);
+
+[varargout{1:nargout}] = coptmex('params', varargin{:});
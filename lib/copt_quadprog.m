@@ -123,28 +123,20 @@ else
 end
 
 %% Construct COPT problem
-problem.A = [sparse(A); sparse(Aeq)];
-ncol = size(problem.A, 2);
-
+% Blocks are stacked and defaults are filled by 'copt_solveprog'
 if isprobonly == 1
-  problem.Q = 0.5 * sparse(Hcost);
-  problem.obj = fcost;
-else
-  problem.Q = 0.5 * sparse(H);
-  problem.obj = f;
-end
-if ~isempty(lb)
-  problem.lb = lb;
-else
-  problem.lb = -inf(ncol, 1);
-end
-if ~isempty(ub)
-  problem.ub = ub;
+  problem.H = Hcost;
+  problem.f = fcost;
 else
-  problem.ub = inf(ncol, 1);
-end
-problem.sense = [repmat('L', size(A, 1), 1); repmat('E', size(Aeq, 1), 1)];
-problem.rhs = full([b(:); beq(:)]);
+  problem.H = H;
+  problem.f = f;
+end
+problem.Aineq = A;
+problem.bineq = b;
+problem.Aeq = Aeq;
+problem.beq = beq;
+problem.lb = lb;
+problem.ub = ub;
 
 %% Construct optimization parameters
 parameter = struct();
@@ -178,7 +170,7 @@ if isfield(options, 'OptimalityTolerance') || ismexoptim == 1
 end
 
 %% Solve the problem
-solution = copt_solve(problem, parameter);
+solution = coptmex('solveprog', problem, parameter);
 
 %% Construct the LP solution
 % 'x'
@@ -206,18 +198,10 @@ end
 % 'output'
 output.iterations = solution.barrieriter;
 output.message = solution.status;
-output.constrviolation = [];
-if isfield(solution, 'x')
-  slack = problem.A * solution.x - problem.rhs;
-  vio_A = slack(1:size(A, 1));
-  vio_Aeq = norm(slack((size(A, 1) + 1):end), inf);
-  vio_lb = problem.lb(:) - solution.x;
-  if isfield(problem, 'ub')
-    vio_ub = solution.x - problem.ub(:);
-  else
-    vio_ub = 0;
-  end
-  output.constrviolation = max([0; vio_A; vio_Aeq; vio_lb; vio_ub]);
+if isfield(solution, 'primalviol')
+  output.constrviolation = solution.primalviol;
+else
+  output.constrviolation = [];
 end
 % 'lambda'
 lambda.lower   = [];
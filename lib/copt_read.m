@@ -1,10 +1,14 @@
+function varargout = copt_read(varargin)
 % copt_read
 %
 % problem = copt_read(probfile)
 % problem = copt_read(probfile, infofile)
+% problem = copt_read(buffer, format)
 %
 % This function reads a problem from file, and optionally reads a start basis
-% for the problem (LP only).
+% for the problem (LP only). The problem can also be read from a uint8 buffer
+% holding the file content. Only the start basis of info files is returned in
+% problem, see copt_solve to use MIP starts and parameters read from files.
 %
 % Input arguments:
 % -----------------
@@ -12,7 +16,15 @@
 %   Name of the problem file to read.
 %
 % infofile (optional):
-%   Name of start basis file to read.
+%   Name of info file, or cell array of names of info files, to read. The
+%   types '.bas', '.sol', '.mst', '.par' and '.tune' are supported.
+%
+% buffer (optional):
+%   A uint8 vector that holds the content of a problem file.
+%
+% format (optional):
+%   Format of the content in buffer: 'mps', 'lp', 'bin', 'dat-s' or 'cbf',
+%   with '.gz' appended for gzip compressed content.
 %
 % Output arguments:
 % ------------------
@@ -27,3 +39,7 @@
 %   problem  = copt_read('diet.mps', 'diet.bas');
 %   solution = copt_solve(problem);
 %
+%   fid = fopen('diet.mps.gz'); buffer = fread(fid, '*uint8'); fclose(fid);
+%   problem  = copt_read(buffer, 'mps.gz');
+
+[varargout{1:nargout}] = coptmex('read', varargin{:});
@@ -1,3 +1,4 @@
+function varargout = copt_solve(varargin)
 % copt_solve
 %
 % version  = copt_solve()
@@ -5,6 +6,12 @@
 % solution = copt_solve(probfile, parameter)
 % solution = copt_solve(problem)
 % solution = copt_solve(problem, parameter)
+% solution = copt_solve(buffer, format)
+% solution = copt_solve(buffer, format, parameter)
+% solution = copt_solve(probfile, parameter, infofile)
+% solution = copt_solve(problem, parameter, infofile)
+% solution = copt_solve(buffer, format, parameter, infofile)
+% [solution, handle] = copt_solve(...)
 %
 % This function solves a given problem with customized optimization parameters.
 % The LP or MIP solver will be called depends on the type of the given problem,
@@ -19,14 +26,30 @@
 % problem (optional):
 %   A MATLAB struct that specify a valid COPT problem.
 %
+% buffer (optional):
+%   A uint8 vector that holds the content of a problem file.
+%
+% format (optional):
+%   Format of the content in buffer, see copt_read.
+%
 % parameter (optional):
-%   A MATLAB struct that specify customized parameters.
+%   A MATLAB struct that specify customized parameters, or a parameter handle
+%   returned by copt_params.
+%
+% infofile (optional):
+%   Name of info file, or cell array of names of info files, to read after
+%   the problem is loaded: start basis ('.bas'), MIP start ('.sol' or '.mst'),
+%   parameters ('.par') or tuning parameters ('.tune').
 %
 % Output arguments:
 % ------------------
 % solution (optional):
 %   A MATLAB struct that represent LP/MIP solution.
 %
+% handle (optional):
+%   A uint64 scalar that refers to the solved problem, which is kept for
+%   copt_addcols, copt_addrows and copt_delrows until released by copt_free.
+%
 % version (optional):
 %   A MATLAB struct that represent COPT version
 %
@@ -47,3 +70,9 @@
 %   problem  = copt_read('diet.mps');
 %   solution = copt_solve(problem, parameter);
 %
+%   buffer   = copt_write(copt_read('diet.mps'), 'bin');
+%   solution = copt_solve(buffer, 'bin', parameter);
+%
+%   solution = copt_solve('diet.mps', struct(), {'diet.sol', 'diet.par'});
+
+[varargout{1:nargout}] = coptmex('solve', varargin{:});
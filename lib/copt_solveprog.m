@@ -0,0 +1,39 @@
+function varargout = copt_solveprog(varargin)
+% copt_solveprog
+%
+% solution = copt_solveprog(problem)
+% solution = copt_solveprog(problem, parameter)
+%
+% This function solves a problem given by separate 'linprog', 'quadprog' or
+% 'intlinprog' style blocks. The blocks are stacked and default bounds are
+% filled natively, so no temporary MATLAB matrices are built around the call.
+%
+% Input arguments:
+% ------------------
+% problem:
+%   A MATLAB struct with optional fields 'f', 'H', 'intcon', 'Aineq', 'bineq',
+%   'Aeq', 'beq', 'lb', 'ub' and 'x0'. Empty fields are ignored, 'lb' defaults
+%   to -inf and 'ub' defaults to inf.
+%
+% parameter (optional):
+%   A MATLAB struct that specify customized parameters, or a parameter handle
+%   returned by copt_params.
+%
+% Output arguments:
+% ------------------
+% solution (optional):
+%   A MATLAB struct that represent LP/MIP solution.
+%
+% Examples usages:
+% -----------------
+%   problem.f = [-1; -2];
+%   problem.Aineq = [1, 1];
+%   problem.bineq = 4;
+%   problem.ub = [3; 3];
+%   solution = copt_solveprog(problem);
+%
+%   problem.intcon = 2;
+%   parameter.timelimit = 10;
+%   solution = copt_solveprog(problem, parameter);
+
+[varargout{1:nargout}] = coptmex('solveprog', varargin{:});
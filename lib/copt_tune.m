@@ -1,11 +1,16 @@
+function varargout = copt_tune(varargin)
 % copt_tune
 %
 % copt_tune(probfile)
 % copt_tune(probfile, parameter)
 % copt_tune(problem)
 % copt_tune(problem, parameter)
+% tuneresults = copt_tune(problems, parameter)
 %
-% This function tune the performance of a given problem.
+% This function tune the performance of a given problem, or of a set of
+% problems given as a cell array of files or a struct array. If an output is
+% requested, each tuned parameter set is solved on all problems and the sets
+% are returned fastest first.
 %
 % Input arguments:
 % ------------------
@@ -15,9 +20,18 @@
 % problem (optional):
 %   A MATLAB struct that specify a valid COPT problem.
 %
+% problems (optional):
+%   A cell array of problem files or a MATLAB struct array of problems.
+%
 % parameter (optional):
 %   A MATLAB struct that specify customized parameters.
 %
+% Output arguments:
+% ------------------
+% tuneresults (optional):
+%   A MATLAB struct array with fields 'params' (parameter struct usable by
+%   copt_solve), 'time' and 'gap' (solving time and MIP gap per problem).
+%
 % Examples usages:
 % -----------------
 %   copt_tune('diet.mps');
@@ -32,3 +46,7 @@
 %   problem  = copt_read('diet.mps');
 %   copt_tune(problem, parameter);
 %
+%   tuneresults = copt_tune({'mip1.mps', 'mip2.mps'});
+%   solution = copt_solve('mip3.mps', tuneresults(1).params);
+
+[varargout{1:nargout}] = coptmex('tune', varargin{:});
@@ -1,8 +1,11 @@
+function varargout = copt_write(varargin)
 % copt_write
 %
 % copt_write(problem, probfile)
+% buffer = copt_write(problem, format)
 %
-% This function writes a valid COPT problem to file.
+% This function writes a valid COPT problem to file, or to a uint8 buffer if
+% an output is requested.
 %
 % Input arguments:
 % -----------------
@@ -12,8 +15,18 @@
 % probfile:
 %   Name of file to write.
 %
+% format:
+%   Format of the buffer to return: 'mps', 'lp', 'bin' or 'cbf'.
+%
+% Output arguments:
+% ------------------
+% buffer (optional):
+%   A uint8 vector that holds the content of the written problem.
+%
 % Examples usages:
 % -----------------
 % problem = copt_read('diet.mps');
 % copt_write(problem, 'diet_out.mps');
-%
+% buffer = copt_write(problem, 'bin');
+
+[varargout{1:nargout}] = coptmex('write', varargin{:});
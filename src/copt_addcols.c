@@ -0,0 +1,54 @@
+#include "coptmex.h"
+
+void COPTMEX_cmdAddCols(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+{
+  int retcode = COPT_RETCODE_OK;
+  copt_prob* prob = NULL;
+  int retResult = 1;
+  mxArray* except = NULL;
+
+  // Check if inputs/outputs are valid
+  if (nlhs != 1 && nlhs != 0)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "outputs");
+    goto exit_cleanup;
+  }
+  if (nlhs == 0)
+  {
+    retResult = 0;
+  }
+  if (nrhs < 3 || nrhs > 5)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "inputs");
+    goto exit_cleanup;
+  }
+
+  // Get problem kept by copt_solve
+  COPTMEX_CALL(COPTMEX_getHandle(prhs[0], &prob));
+
+  // Timing, progress and user callbacks of previous calls do not apply to re-solve
+  COPTMEX_CALL(COPTMEX_startTiming(NULL));
+  COPTMEX_CALL(COPTMEX_startProgress(NULL));
+  COPTMEX_CALL(COPTMEX_startUserCallback(NULL));
+
+  // Append columns and re-solve the problem
+  COPTMEX_CALL(COPTMEX_addCols(prob, prhs[1], prhs[2], nrhs > 3 ? prhs[3] : NULL, nrhs > 4 ? prhs[4] : NULL,
+                               &plhs[0], retResult));
+
+  COPTMEX_CALL(COPTMEX_stopUserCallback(&except));
+  COPTMEX_CALL(COPTMEX_stopProgress(NULL, &except));
+
+exit_cleanup:
+  if (retcode != COPT_RETCODE_OK && except == NULL)
+  {
+    char errmsg[COPT_BUFFSIZE];
+    char msgbuf[COPT_BUFFSIZE * 2];
+    COPT_GetRetcodeMsg(retcode, errmsg, COPT_BUFFSIZE);
+    snprintf(msgbuf, COPT_BUFFSIZE * 2, "COPT Error %d: %s", retcode, errmsg);
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
+  }
+
+  // Raise error of user functions, problem stays alive until freed by copt_free
+  COPTMEX_rethrow(except);
+  return;
+}
@@ -0,0 +1,66 @@
+#include "coptmex.h"
+
+void COPTMEX_cmdCache(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+{
+  int retcode = COPT_RETCODE_OK;
+  char cmd[COPT_BUFFSIZE];
+  int nremoved = 0;
+
+  // Check if inputs/outputs are valid
+  if (nlhs != 0 && nlhs != 1)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "outputs");
+    goto exit_cleanup;
+  }
+
+  if (nrhs == 0)
+  {
+    snprintf(cmd, COPT_BUFFSIZE, "info");
+  }
+  else if (nrhs == 1)
+  {
+    if (!mxIsChar(prhs[0]) || mxGetString(prhs[0], cmd, COPT_BUFFSIZE) != 0)
+    {
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "cmd");
+      goto exit_cleanup;
+    }
+  }
+  else
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "inputs");
+    goto exit_cleanup;
+  }
+
+  // Processing the command
+  //  1. 'info': return cache directory, number of files and sizes;
+  //  2. 'clear': remove all cached models.
+  if (mystrcmp(cmd, "info") == 0)
+  {
+    COPTMEX_CALL(COPTMEX_getCacheInfo(&plhs[0]));
+  }
+  else if (mystrcmp(cmd, "clear") == 0)
+  {
+    COPTMEX_CALL(COPTMEX_clearCache(&nremoved));
+    if (nlhs == 1)
+    {
+      plhs[0] = mxCreateDoubleScalar(nremoved);
+    }
+  }
+  else
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, "cmd");
+    goto exit_cleanup;
+  }
+
+exit_cleanup:
+  if (retcode != COPT_RETCODE_OK)
+  {
+    char errmsg[COPT_BUFFSIZE];
+    char msgbuf[COPT_BUFFSIZE * 2];
+    COPT_GetRetcodeMsg(retcode, errmsg, COPT_BUFFSIZE);
+    snprintf(msgbuf, COPT_BUFFSIZE * 2, "COPT Error %d: %s", retcode, errmsg);
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
+  }
+
+  return;
+}
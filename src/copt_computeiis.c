@@ -1,6 +1,6 @@
 #include "coptmex.h"
 
-void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+void COPTMEX_cmdComputeIIS(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
 {
   int retcode = COPT_RETCODE_OK;
   copt_env* env = NULL;
@@ -20,7 +20,7 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
 
   if (nrhs == 1 || nrhs == 2)
   {
-    if (!mxIsChar(prhs[0]) && !mxIsStruct(prhs[0]))
+    if (!mxIsChar(prhs[0]) && !mxIsStruct(prhs[0]) && !mxIsCell(prhs[0]))
     {
       COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "problem/probfile");
       goto exit_cleanup;
@@ -40,10 +40,28 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     goto exit_cleanup;
   }
 
-  // Create COPT environment and problem
-  COPTMEX_CALL(COPT_CreateEnv(&env));
+  // Get shared COPT environment
+  COPTMEX_CALL(COPTMEX_getEnv(&env));
+
+  // Compute IIS for a cell array of problem files or a struct array of problems
+  if (mxIsCell(prhs[0]) || (mxIsStruct(prhs[0]) && mxGetNumberOfElements(prhs[0]) != 1))
+  {
+    if (nrhs == 1)
+    {
+      COPTMEX_CALL(COPTMEX_dispBanner());
+    }
+
+    COPTMEX_CALL(COPTMEX_computeIISBatch(env, prhs[0], nrhs == 2 ? prhs[1] : NULL, &plhs[0], retResult));
+    goto exit_cleanup;
+  }
+
+  // Create COPT problem
   COPTMEX_CALL(COPT_CreateProb(env, &prob));
 
+  // Start timing if requested by parameter
+  COPTMEX_CALL(COPTMEX_startTiming(nrhs == 2 ? prhs[1] : NULL));
+  COPTMEX_switchPhase(COPTMEX_PHASE_PARAM);
+
   // Processing the second argument, if exists.
   if (nrhs == 2)
   {
@@ -61,6 +79,7 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
   if (mxIsChar(prhs[0]))
   {
     // Read the problem from file
+    COPTMEX_switchPhase(COPTMEX_PHASE_READ);
     COPTMEX_CALL(COPTMEX_readModel(prob, prhs[0]));
   }
   else if (mxIsStruct(prhs[0]))
@@ -72,6 +91,12 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
   // Compute IIS for infeasible problem and save result
   COPTMEX_CALL(COPTMEX_computeIIS(prob, &plhs[0], retResult));
 
+  // Add timing info to result
+  if (retResult)
+  {
+    COPTMEX_CALL(COPTMEX_stopTiming(plhs[0]));
+  }
+
 exit_cleanup:
   if (retcode != COPT_RETCODE_OK)
   {
@@ -82,9 +107,8 @@ exit_cleanup:
     COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
   }
 
-  // Delete COPT problem and environment
+  // Delete COPT problem
   COPT_DeleteProb(&prob);
-  COPT_DeleteEnv(&env);
 
   return;
 }
@@ -1,13 +1,13 @@
 #include "coptmex.h"
 
-void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+void COPTMEX_cmdDefaultParams(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
 {
   int retcode = COPT_RETCODE_OK;
   copt_env* env = NULL;
   copt_prob* prob = NULL;
 
   // Check if arguments are valid
-  if (nlhs > 1)
+  if (nlhs > 2)
   {
     COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "outputs");
     goto exit_cleanup;
@@ -18,14 +18,18 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     goto exit_cleanup;
   }
 
-  // Create COPT environment and problem
-  COPTMEX_CALL(COPT_CreateEnv(&env));
+  // Get shared COPT environment and create problem
+  COPTMEX_CALL(COPTMEX_getEnv(&env));
   COPTMEX_CALL(COPT_CreateProb(env, &prob));
 
-  // Generate default parameters
+  // Generate default parameters, and description of parameters if requested
   if (nlhs == 1)
   {
-    COPTMEX_CALL(COPTMEX_getDefaultParams(prob, &plhs[0]));
+    COPTMEX_CALL(COPTMEX_getDefaultParams(prob, &plhs[0], NULL));
+  }
+  else if (nlhs == 2)
+  {
+    COPTMEX_CALL(COPTMEX_getDefaultParams(prob, &plhs[0], &plhs[1]));
   }
 
 exit_cleanup:
@@ -38,9 +42,8 @@ exit_cleanup:
     COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
   }
 
-  // Delete COPT problem and environment
+  // Delete COPT problem
   COPT_DeleteProb(&prob);
-  COPT_DeleteEnv(&env);
 
   return;
 }
@@ -0,0 +1,35 @@
+#include "coptmex.h"
+
+void COPTMEX_cmdDelRows(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+{
+  int retcode = COPT_RETCODE_OK;
+  copt_prob* prob = NULL;
+
+  // Check if arguments are valid
+  if (nlhs != 0)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "outputs");
+    goto exit_cleanup;
+  }
+  if (nrhs != 2)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "inputs");
+    goto exit_cleanup;
+  }
+
+  // Get problem kept by copt_solve and delete rows from it
+  COPTMEX_CALL(COPTMEX_getHandle(prhs[0], &prob));
+  COPTMEX_CALL(COPTMEX_delRows(prob, prhs[1]));
+
+exit_cleanup:
+  if (retcode != COPT_RETCODE_OK)
+  {
+    char errmsg[COPT_BUFFSIZE];
+    char msgbuf[COPT_BUFFSIZE * 2];
+    COPT_GetRetcodeMsg(retcode, errmsg, COPT_BUFFSIZE);
+    snprintf(msgbuf, COPT_BUFFSIZE * 2, "COPT Error %d: %s", retcode, errmsg);
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
+  }
+
+  return;
+}
@@ -1,6 +1,6 @@
 #include "coptmex.h"
 
-void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+void COPTMEX_cmdFeasRelax(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
 {
   int retcode = COPT_RETCODE_OK;
   copt_env* env = NULL;
@@ -8,7 +8,7 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
   int retResult = 1;
 
   // Check if inputs/outputs are valid
-  if (nlhs != 0 && nlhs != 1)
+  if (nlhs < 0 || nlhs > 2)
   {
     COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "outputs");
     goto exit_cleanup;
@@ -45,8 +45,8 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     goto exit_cleanup;
   }
 
-  // Create COPT environment and problem
-  COPTMEX_CALL(COPT_CreateEnv(&env));
+  // Get shared COPT environment and create problem
+  COPTMEX_CALL(COPTMEX_getEnv(&env));
   COPTMEX_CALL(COPT_CreateProb(env, &prob));
 
   // Processing the third argument, if exists.
@@ -64,7 +64,13 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
   COPTMEX_CALL(COPTMEX_loadModel(prob, prhs[0]));
 
   // Compute feasibility relaxation and save result
-  COPTMEX_CALL(COPTMEX_feasRelax(prob, prhs[1], &plhs[0], retResult));
+  COPTMEX_CALL(COPTMEX_feasRelax(prob, prhs[1], nrhs == 3 ? prhs[2] : NULL, &plhs[0], retResult));
+
+  // Extract feasibility relaxation problem, if requested
+  if (nlhs == 2)
+  {
+    COPTMEX_CALL(COPTMEX_getRelaxModel(env, prob, &plhs[1]));
+  }
 
 exit_cleanup:
   if (retcode != COPT_RETCODE_OK)
@@ -76,9 +82,8 @@ exit_cleanup:
     COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
   }
 
-  // Delete COPT problem and environment
+  // Delete COPT problem
   COPT_DeleteProb(&prob);
-  COPT_DeleteEnv(&env);
 
   return;
 }
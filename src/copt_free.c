@@ -0,0 +1,33 @@
+#include "coptmex.h"
+
+void COPTMEX_cmdFree(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+{
+  int retcode = COPT_RETCODE_OK;
+
+  // Check if arguments are valid
+  if (nlhs != 0)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "outputs");
+    goto exit_cleanup;
+  }
+  if (nrhs != 1)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "inputs");
+    goto exit_cleanup;
+  }
+
+  // Delete problem kept by copt_solve
+  COPTMEX_CALL(COPTMEX_freeHandle(prhs[0]));
+
+exit_cleanup:
+  if (retcode != COPT_RETCODE_OK)
+  {
+    char errmsg[COPT_BUFFSIZE];
+    char msgbuf[COPT_BUFFSIZE * 2];
+    COPT_GetRetcodeMsg(retcode, errmsg, COPT_BUFFSIZE);
+    snprintf(msgbuf, COPT_BUFFSIZE * 2, "COPT Error %d: %s", retcode, errmsg);
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
+  }
+
+  return;
+}
@@ -0,0 +1,47 @@
+#include "coptmex.h"
+
+void COPTMEX_cmdParams(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+{
+  int retcode = COPT_RETCODE_OK;
+  copt_env* env = NULL;
+  copt_prob* prob = NULL;
+
+  // Check if arguments are valid
+  if (nlhs > 1)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "outputs");
+    goto exit_cleanup;
+  }
+  if (nrhs != 1)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "inputs");
+    goto exit_cleanup;
+  }
+  if (!mxIsStruct(prhs[0]))
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "parameter");
+    goto exit_cleanup;
+  }
+
+  // Get shared COPT environment and create problem
+  COPTMEX_CALL(COPTMEX_getEnv(&env));
+  COPTMEX_CALL(COPT_CreateProb(env, &prob));
+
+  // Validate parameters and resolve them into handle
+  COPTMEX_CALL(COPTMEX_compileParam(prob, prhs[0], &plhs[0]));
+
+exit_cleanup:
+  if (retcode != COPT_RETCODE_OK)
+  {
+    char errmsg[COPT_BUFFSIZE];
+    char msgbuf[COPT_BUFFSIZE * 2];
+    COPT_GetRetcodeMsg(retcode, errmsg, COPT_BUFFSIZE);
+    snprintf(msgbuf, COPT_BUFFSIZE * 2, "COPT Error %d: %s", retcode, errmsg);
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
+  }
+
+  // Delete COPT problem
+  COPT_DeleteProb(&prob);
+
+  return;
+}
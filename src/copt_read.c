@@ -1,6 +1,6 @@
 #include "coptmex.h"
 
-void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+void COPTMEX_cmdRead(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
 {
   int retcode = COPT_RETCODE_OK;
   copt_env* env = NULL;
@@ -13,7 +13,15 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     goto exit_cleanup;
   }
 
-  if (nrhs == 1 || nrhs == 2)
+  if (nrhs == 2 && mxIsUint8(prhs[0]))
+  {
+    if (!mxIsChar(prhs[1]))
+    {
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "format");
+      goto exit_cleanup;
+    }
+  }
+  else if (nrhs == 1 || nrhs == 2)
   {
     if (!mxIsChar(prhs[0]))
     {
@@ -22,7 +30,7 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     }
     if (nrhs == 2)
     {
-      if (!mxIsChar(prhs[1]))
+      if (!mxIsChar(prhs[1]) && !mxIsCell(prhs[1]))
       {
         COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "infofile");
         goto exit_cleanup;
@@ -35,12 +43,20 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     goto exit_cleanup;
   }
 
-  // Create COPT environment and problem
-  COPTMEX_CALL(COPT_CreateEnv(&env));
+  // Get shared COPT environment and create problem
+  COPTMEX_CALL(COPTMEX_getEnv(&env));
   COPTMEX_CALL(COPT_CreateProb(env, &prob));
 
-  // Extract model data from file
-  COPTMEX_CALL(COPTMEX_getModel(prob, nrhs, prhs, &plhs[0]));
+  // Extract model data from buffer or file
+  if (mxIsUint8(prhs[0]))
+  {
+    COPTMEX_CALL(COPTMEX_readModelBuffer(prob, prhs[0], prhs[1]));
+    COPTMEX_CALL(COPTMEX_getModel(prob, 0, NULL, &plhs[0]));
+  }
+  else
+  {
+    COPTMEX_CALL(COPTMEX_getModel(prob, nrhs, prhs, &plhs[0]));
+  }
 
 exit_cleanup:
   if (retcode != COPT_RETCODE_OK)
@@ -52,9 +68,8 @@ exit_cleanup:
     COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
   }
 
-  // Delete COPT problem and environment
+  // Delete COPT problem
   COPT_DeleteProb(&prob);
-  COPT_DeleteEnv(&env);
 
   return;
 }
@@ -1,15 +1,19 @@
 #include "coptmex.h"
 
-void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+void COPTMEX_cmdSolve(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
 {
   int retcode = COPT_RETCODE_OK;
   copt_env* env = NULL;
   copt_prob* prob = NULL;
   int retResult = 1;
+  mxArray* except = NULL;
   int ifConeData = 0;
+  int iparam = 1;
+  const mxArray* param = NULL;
+  const mxArray* infofile = NULL;
 
   // Check if inputs/outputs are valid
-  if (nlhs != 1 && nlhs != 0)
+  if (nlhs > 2 || (nlhs == 2 && nrhs == 0))
   {
     COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "outputs");
     goto exit_cleanup;
@@ -24,16 +28,33 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     COPTMEX_CALL(COPTMEX_getVersion(&plhs[0]));
     return;
   }
-  else if (nrhs == 1 || nrhs == 2)
+  else if (nrhs >= 2 && nrhs <= 4 && mxIsUint8(prhs[0]))
+  {
+    if (!mxIsChar(prhs[1]))
+    {
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "format");
+      goto exit_cleanup;
+    }
+    iparam = 2;
+    if (nrhs >= 3)
+    {
+      if (!mxIsStruct(prhs[2]) && !mxIsUint8(prhs[2]))
+      {
+        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "parameter");
+        goto exit_cleanup;
+      }
+    }
+  }
+  else if (nrhs >= 1 && nrhs <= 3)
   {
     if (!mxIsChar(prhs[0]) && !mxIsStruct(prhs[0]))
     {
       COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "problem/probfile");
       goto exit_cleanup;
     }
-    if (nrhs == 2)
+    if (nrhs >= 2)
     {
-      if (!mxIsStruct(prhs[1]))
+      if (!mxIsStruct(prhs[1]) && !mxIsUint8(prhs[1]))
       {
         COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "parameter");
         goto exit_cleanup;
@@ -46,15 +67,38 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     goto exit_cleanup;
   }
 
-  // Create COPT environment and problem
-  COPTMEX_CALL(COPT_CreateEnv(&env));
+  // Parameter and info files to read after the problem is loaded, if given
+  if (nrhs > iparam)
+  {
+    param = prhs[iparam];
+  }
+  if (nrhs > iparam + 1)
+  {
+    infofile = prhs[iparam + 1];
+    if (!mxIsChar(infofile) && !mxIsCell(infofile))
+    {
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "infofile");
+      goto exit_cleanup;
+    }
+  }
+
+  // Get shared COPT environment and create problem
+  COPTMEX_CALL(COPTMEX_getEnv(&env));
   COPTMEX_CALL(COPT_CreateProb(env, &prob));
 
-  // Processing the second argument, if exists.
-  if (nrhs == 2)
+  // Start timing if requested by parameter
+  COPTMEX_CALL(COPTMEX_startTiming(nrhs > iparam ? prhs[iparam] : NULL));
+  COPTMEX_switchPhase(COPTMEX_PHASE_PARAM);
+
+  // Start recording progress and user callbacks, if requested by parameter
+  COPTMEX_CALL(COPTMEX_startProgress(nrhs > iparam ? prhs[iparam] : NULL));
+  COPTMEX_CALL(COPTMEX_startUserCallback(nrhs > iparam ? prhs[iparam] : NULL));
+
+  // Processing the parameter argument, if exists.
+  if (nrhs > iparam)
   {
     // Load and set parameters to problem
-    COPTMEX_CALL(COPTMEX_setParam(prob, prhs[1]));
+    COPTMEX_CALL(COPTMEX_setParam(prob, prhs[iparam]));
   }
   else
   {
@@ -63,11 +107,19 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
 
   // Processing the first argument
   //  1. 'string': a valid problem file;
-  //  2. 'struct': a struct that specify the problem data.
-  if (mxIsChar(prhs[0]))
+  //  2. 'struct': a struct that specify the problem data;
+  //  3. 'uint8': a buffer holding problem file content in the given format.
+  if (mxIsUint8(prhs[0]))
+  {
+    // Read the problem from buffer and solve it
+    COPTMEX_switchPhase(COPTMEX_PHASE_READ);
+    COPTMEX_CALL(COPTMEX_readModelBuffer(prob, prhs[0], prhs[1]));
+    COPTMEX_CALL(COPTMEX_solveModel(prob, NULL, 1, infofile, param, &plhs[0], retResult));
+  }
+  else if (mxIsChar(prhs[0]))
   {
     // Read and solve the problem from file
-    COPTMEX_CALL(COPTMEX_solveModel(prob, prhs[0], 1, &plhs[0], retResult));
+    COPTMEX_CALL(COPTMEX_solveModel(prob, prhs[0], 1, infofile, param, &plhs[0], retResult));
   }
   else if (mxIsStruct(prhs[0]))
   {
@@ -75,16 +127,39 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     ifConeData = COPTMEX_isConeModel(prhs[0]);
     if (ifConeData)
     {
-      COPTMEX_CALL(COPTMEX_solveConeModel(prob, prhs[0], &plhs[0], retResult));
+      // Rows of cone data are reordered when loaded, so columns can not be added to them later
+      if (nlhs == 2)
+      {
+        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "outputs");
+        goto exit_cleanup;
+      }
+      COPTMEX_CALL(COPTMEX_solveConeModel(prob, prhs[0], infofile, param, &plhs[0], retResult));
     }
     else
     {
-      COPTMEX_CALL(COPTMEX_solveModel(prob, prhs[0], 0, &plhs[0], retResult));
+      COPTMEX_CALL(COPTMEX_solveModel(prob, prhs[0], 0, infofile, param, &plhs[0], retResult));
     }
   }
 
+  // Stop user callbacks, report remaining progress and add timeline to result
+  COPTMEX_CALL(COPTMEX_stopUserCallback(&except));
+  COPTMEX_CALL(COPTMEX_stopProgress(retResult ? plhs[0] : NULL, &except));
+
+  // Add timing info to result
+  if (retResult)
+  {
+    COPTMEX_CALL(COPTMEX_stopTiming(plhs[0]));
+  }
+
+  // Keep problem for later calls such as copt_addcols
+  if (nlhs == 2)
+  {
+    COPTMEX_CALL(COPTMEX_addHandle(prob, &plhs[1]));
+    prob = NULL;
+  }
+
 exit_cleanup:
-  if (retcode != COPT_RETCODE_OK)
+  if (retcode != COPT_RETCODE_OK && except == NULL)
   {
     char errmsg[COPT_BUFFSIZE];
     char msgbuf[COPT_BUFFSIZE * 2];
@@ -93,9 +168,11 @@ exit_cleanup:
     COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
   }
 
-  // Delete COPT problem and environment
+  // Delete COPT problem
   COPT_DeleteProb(&prob);
-  COPT_DeleteEnv(&env);
+
+  // Raise error of user functions once cleaned up
+  COPTMEX_rethrow(except);
 
   return;
 }
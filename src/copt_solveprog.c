@@ -0,0 +1,97 @@
+#include "coptmex.h"
+
+void COPTMEX_cmdSolveProg(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+{
+  int retcode = COPT_RETCODE_OK;
+  copt_env* env = NULL;
+  copt_prob* prob = NULL;
+  int retResult = 1;
+  mxArray* except = NULL;
+
+  // Check if inputs/outputs are valid
+  if (nlhs != 1 && nlhs != 0)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "outputs");
+    goto exit_cleanup;
+  }
+  if (nlhs == 0)
+  {
+    retResult = 0;
+  }
+
+  if (nrhs == 1 || nrhs == 2)
+  {
+    if (!mxIsStruct(prhs[0]))
+    {
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "problem");
+      goto exit_cleanup;
+    }
+    if (nrhs == 2)
+    {
+      if (!mxIsStruct(prhs[1]) && !mxIsUint8(prhs[1]))
+      {
+        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "parameter");
+        goto exit_cleanup;
+      }
+    }
+  }
+  else
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "inputs");
+    goto exit_cleanup;
+  }
+
+  // Get shared COPT environment and create problem
+  COPTMEX_CALL(COPTMEX_getEnv(&env));
+  COPTMEX_CALL(COPT_CreateProb(env, &prob));
+
+  // Start timing if requested by parameter
+  COPTMEX_CALL(COPTMEX_startTiming(nrhs == 2 ? prhs[1] : NULL));
+  COPTMEX_switchPhase(COPTMEX_PHASE_PARAM);
+
+  // Start recording progress and user callbacks, if requested by parameter
+  COPTMEX_CALL(COPTMEX_startProgress(nrhs == 2 ? prhs[1] : NULL));
+  COPTMEX_CALL(COPTMEX_startUserCallback(nrhs == 2 ? prhs[1] : NULL));
+
+  // Processing the second argument, if exists.
+  if (nrhs == 2)
+  {
+    // Load and set parameters to problem
+    COPTMEX_CALL(COPTMEX_setParam(prob, prhs[1]));
+  }
+  else
+  {
+    COPTMEX_CALL(COPTMEX_dispBanner());
+  }
+
+  // Stack the blocks, solve the problem and compute violation
+  COPTMEX_CALL(COPTMEX_solveProg(prob, prhs[0], &plhs[0], retResult));
+
+  // Stop user callbacks, report remaining progress and add timeline to result
+  COPTMEX_CALL(COPTMEX_stopUserCallback(&except));
+  COPTMEX_CALL(COPTMEX_stopProgress(retResult ? plhs[0] : NULL, &except));
+
+  // Add timing info to result
+  if (retResult)
+  {
+    COPTMEX_CALL(COPTMEX_stopTiming(plhs[0]));
+  }
+
+exit_cleanup:
+  if (retcode != COPT_RETCODE_OK && except == NULL)
+  {
+    char errmsg[COPT_BUFFSIZE];
+    char msgbuf[COPT_BUFFSIZE * 2];
+    COPT_GetRetcodeMsg(retcode, errmsg, COPT_BUFFSIZE);
+    snprintf(msgbuf, COPT_BUFFSIZE * 2, "COPT Error %d: %s", retcode, errmsg);
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
+  }
+
+  // Delete COPT problem
+  COPT_DeleteProb(&prob);
+
+  // Raise error of user functions once cleaned up
+  COPTMEX_rethrow(except);
+
+  return;
+}
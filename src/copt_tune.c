@@ -1,13 +1,12 @@
 #include "coptmex.h"
 
-void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+void COPTMEX_cmdTune(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
 {
   int retcode = COPT_RETCODE_OK;
   copt_env* env = NULL;
-  copt_prob* prob = NULL;
 
   // Check if inputs/outputs are valid
-  if (nlhs != 0)
+  if (nlhs != 0 && nlhs != 1)
   {
     COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "outputs");
     goto exit_cleanup;
@@ -15,7 +14,7 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
 
   if (nrhs == 1 || nrhs == 2)
   {
-    if (!mxIsChar(prhs[0]) && !mxIsStruct(prhs[0]))
+    if (!mxIsChar(prhs[0]) && !mxIsStruct(prhs[0]) && !mxIsCell(prhs[0]))
     {
       COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "problem/probfile");
       goto exit_cleanup;
@@ -35,37 +34,20 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     goto exit_cleanup;
   }
 
-  // Create COPT environment and problem
-  COPTMEX_CALL(COPT_CreateEnv(&env));
-  COPTMEX_CALL(COPT_CreateProb(env, &prob));
+  // Get shared COPT environment
+  COPTMEX_CALL(COPTMEX_getEnv(&env));
 
-  // Processing the second argument, if exists.
-  if (nrhs == 2)
-  {
-    // Load and set parameters to problem
-    COPTMEX_CALL(COPTMEX_setParam(prob, prhs[1]));
-  }
-  else
+  if (nrhs == 1)
   {
     COPTMEX_CALL(COPTMEX_dispBanner());
   }
 
   // Processing the first argument
   //  1. 'string': a valid problem file;
-  //  2. 'struct': a struct that specify the problem data.
-  if (mxIsChar(prhs[0]))
-  {
-    // Read the problem from file
-    COPTMEX_CALL(COPTMEX_readModel(prob, prhs[0]));
-  }
-  else if (mxIsStruct(prhs[0]))
-  {
-    // Extract and load data to problem
-    COPTMEX_CALL(COPTMEX_loadModel(prob, prhs[0]));
-  }
-
-  // Tune the problem
-  COPTMEX_CALL(COPT_Tune(prob));
+  //  2. 'struct': a struct or struct array that specify the problem data;
+  //  3. 'cell': a cell array of valid problem files.
+  // Tune the problems, and evaluate tuned parameter sets if requested
+  COPTMEX_CALL(COPTMEX_tuneModels(env, prhs[0], nrhs == 2 ? prhs[1] : NULL, &plhs[0], nlhs == 1));
 
 exit_cleanup:
   if (retcode != COPT_RETCODE_OK)
@@ -77,9 +59,5 @@ exit_cleanup:
     COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
   }
 
-  // Delete COPT problem and environment
-  COPT_DeleteProb(&prob);
-  COPT_DeleteEnv(&env);
-
   return;
 }
@@ -1,13 +1,13 @@
 #include "coptmex.h"
 
-void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+void COPTMEX_cmdWrite(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
 {
   int retcode = COPT_RETCODE_OK;
   copt_env* env = NULL;
   copt_prob* prob = NULL;
 
   // Check if arguments are valid
-  if (nlhs != 0)
+  if (nlhs != 0 && nlhs != 1)
   {
     COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "outputs");
     goto exit_cleanup;
@@ -22,7 +22,7 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     }
     if (!mxIsChar(prhs[1]))
     {
-      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "probfile");
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, nlhs == 1 ? "format" : "probfile");
       goto exit_cleanup;
     }
   }
@@ -32,8 +32,8 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     goto exit_cleanup;
   }
 
-  // Create COPT environment and problem
-  COPTMEX_CALL(COPT_CreateEnv(&env));
+  // Get shared COPT environment and create problem
+  COPTMEX_CALL(COPTMEX_getEnv(&env));
   COPTMEX_CALL(COPT_CreateProb(env, &prob));
 
   // Extract and load problem data
@@ -47,8 +47,15 @@ void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
     COPTMEX_CALL(COPTMEX_loadModel(prob, prhs[0]));
   }
 
-  // Write problem to file
-  COPTMEX_CALL(COPTMEX_writeModel(prob, prhs[1]));
+  // Write problem to buffer or file
+  if (nlhs == 1)
+  {
+    COPTMEX_CALL(COPTMEX_writeModelBuffer(prob, prhs[1], &plhs[0]));
+  }
+  else
+  {
+    COPTMEX_CALL(COPTMEX_writeModel(prob, prhs[1]));
+  }
 
 exit_cleanup:
   if (retcode != COPT_RETCODE_OK)
@@ -60,9 +67,8 @@ exit_cleanup:
     COPTMEX_errorMsg(COPTMEX_ERROR_BAD_API, msgbuf);
   }
 
-  // Delete COPT problem and environment
+  // Delete COPT problem
   COPT_DeleteProb(&prob);
-  COPT_DeleteEnv(&env);
 
   return;
 }
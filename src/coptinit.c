@@ -133,6 +133,22 @@ static void COPTMEX_initMProb(coptmex_mprob* mprob)
   return;
 }
 
+/* Initialize MEX-style linprog/quadprog/intlinprog problem */
+static void COPTMEX_initMProg(coptmex_mprog* mprog)
+{
+  mprog->f = NULL;
+  mprog->H = NULL;
+  mprog->intcon = NULL;
+  mprog->Aineq = NULL;
+  mprog->bineq = NULL;
+  mprog->Aeq = NULL;
+  mprog->beq = NULL;
+  mprog->lb = NULL;
+  mprog->ub = NULL;
+  mprog->x0 = NULL;
+  return;
+}
+
 /* Initialize C-style cone problem */
 static void COPTMEX_initCConeProb(coptmex_cconeprob* cconeprob)
 {
@@ -275,6 +291,17 @@ static void COPTMEX_initCRelaxInfo(coptmex_crelaxinfo* crelaxinfo)
   return;
 }
 
+/* Initialize solution output settings */
+static void COPTMEX_initOutput(coptmex_output* output)
+{
+  output->nFieldMask = COPTMEX_FIELD_ALL;
+  output->ifResidual = 0;
+  output->solFile = NULL;
+  output->basFile = NULL;
+  output->mstFile = NULL;
+  return;
+}
+
 /* Initialize MEX-style LP solution */
 static void COPTMEX_initMLpSol(coptmex_mlpsol* mlpsol)
 {
@@ -319,6 +346,7 @@ static void COPTMEX_initMMipSol(coptmex_mmipsol* mmipsol)
 static void COPTMEX_initMIISInfo(coptmex_miisinfo* miisinfo)
 {
   miisinfo->isminiis = NULL;
+  miisinfo->iscomplete = NULL;
   miisinfo->varlb = NULL;
   miisinfo->varub = NULL;
   miisinfo->constrlb = NULL;
@@ -340,103 +368,71 @@ static void COPTMEX_initMRelaxInfo(coptmex_mrelaxinfo* mrelaxinfo)
   return;
 }
 
-/* Check parts of penalty */
-static int COPTMEX_checkPenalty(copt_prob* prob, const mxArray* penalty)
+/* Check penalty field of one weighting, a vector or a matrix with one column per weighting */
+static int COPTMEX_checkPenaltyField(const mxArray* penalty, int idx, const char* name, int nelem, int* p_nWeight)
 {
   int isvalid = 1;
   char msgbuf[COPT_BUFFSIZE];
+  mxArray* pen = mxGetField(penalty, idx, name);
 
-  mxArray* lbpen = NULL;
-  mxArray* ubpen = NULL;
-  mxArray* rhspen = NULL;
-  mxArray* upppen = NULL;
-
-  int nCol = 0, nRow = 0;
-
-  COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &nCol);
-  COPT_GetIntAttr(prob, COPT_INTATTR_ROWS, &nRow);
-
-  lbpen = mxGetField(penalty, 0, COPTMEX_PENALTY_LBPEN);
-  ubpen = mxGetField(penalty, 0, COPTMEX_PENALTY_UBPEN);
-  rhspen = mxGetField(penalty, 0, COPTMEX_PENALTY_RHSPEN);
-  upppen = mxGetField(penalty, 0, COPTMEX_PENALTY_UPPPEN);
-
-  if (lbpen != NULL)
+  if (pen == NULL)
   {
-    if (!mxIsDouble(lbpen))
-    {
-      isvalid = 0;
-      snprintf(msgbuf, COPT_BUFFSIZE, "penalty.%s", COPTMEX_PENALTY_LBPEN);
-      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
-      goto exit_cleanup;
-    }
-    if (mxGetNumberOfElements(lbpen) != nCol)
-    {
-      isvalid = 0;
-      snprintf(msgbuf, COPT_BUFFSIZE, "penalty.%s", COPTMEX_PENALTY_LBPEN);
-      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
-      goto exit_cleanup;
-    }
+    goto exit_cleanup;
   }
 
-  if (ubpen != NULL)
+  if (!mxIsDouble(pen))
   {
-    if (!mxIsDouble(ubpen))
-    {
-      isvalid = 0;
-      snprintf(msgbuf, COPT_BUFFSIZE, "penalty.%s", COPTMEX_PENALTY_UBPEN);
-      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
-      goto exit_cleanup;
-    }
-    if (mxGetNumberOfElements(ubpen) != nCol)
-    {
-      isvalid = 0;
-      snprintf(msgbuf, COPT_BUFFSIZE, "penalty.%s", COPTMEX_PENALTY_UBPEN);
-      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
-      goto exit_cleanup;
-    }
+    isvalid = 0;
+    snprintf(msgbuf, COPT_BUFFSIZE, "penalty.%s", name);
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+    goto exit_cleanup;
   }
 
-  if (rhspen != NULL)
+  if (mxGetNumberOfElements(pen) == nelem)
   {
-    if (!mxIsDouble(rhspen))
-    {
-      isvalid = 0;
-      snprintf(msgbuf, COPT_BUFFSIZE, "penalty.%s", COPTMEX_PENALTY_RHSPEN);
-      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
-      goto exit_cleanup;
-    }
-    if (mxGetNumberOfElements(rhspen) != nRow)
-    {
-      isvalid = 0;
-      snprintf(msgbuf, COPT_BUFFSIZE, "penalty.%s", COPTMEX_PENALTY_RHSPEN);
-      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
-      goto exit_cleanup;
-    }
+    goto exit_cleanup;
   }
 
-  if (upppen != NULL)
+  // Matrix penalties are only allowed in a scalar penalty struct
+  if (mxGetNumberOfElements(penalty) != 1 || nelem == 0 || mxGetM(pen) != nelem ||
+      (*p_nWeight > 1 && mxGetN(pen) != *p_nWeight))
   {
-    if (!mxIsDouble(upppen))
-    {
-      isvalid = 0;
-      snprintf(msgbuf, COPT_BUFFSIZE, "penalty.%s", COPTMEX_PENALTY_UPPPEN);
-      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
-      goto exit_cleanup;
-    }
-    if (mxGetNumberOfElements(upppen) != nRow)
-    {
-      isvalid = 0;
-      snprintf(msgbuf, COPT_BUFFSIZE, "penalty.%s", COPTMEX_PENALTY_UPPPEN);
-      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
-      goto exit_cleanup;
-    }
+    isvalid = 0;
+    snprintf(msgbuf, COPT_BUFFSIZE, "penalty.%s", name);
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+    goto exit_cleanup;
   }
 
+  *p_nWeight = (int) mxGetN(pen);
+
 exit_cleanup:
   return isvalid;
 }
 
+/* Check parts of penalty */
+static int COPTMEX_checkPenalty(copt_prob* prob, const mxArray* penalty, int* p_nWeight)
+{
+  int isvalid = 1;
+  int nCol = 0, nRow = 0;
+  int nElem = (int) mxGetNumberOfElements(penalty);
+
+  COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &nCol);
+  COPT_GetIntAttr(prob, COPT_INTATTR_ROWS, &nRow);
+
+  // A struct array gives one weighting per element
+  *p_nWeight = (nElem > 1 ? nElem : 1);
+
+  for (int i = 0; i < nElem && isvalid; ++i)
+  {
+    isvalid = COPTMEX_checkPenaltyField(penalty, i, COPTMEX_PENALTY_LBPEN, nCol, p_nWeight) &&
+              COPTMEX_checkPenaltyField(penalty, i, COPTMEX_PENALTY_UBPEN, nCol, p_nWeight) &&
+              COPTMEX_checkPenaltyField(penalty, i, COPTMEX_PENALTY_RHSPEN, nRow, p_nWeight) &&
+              COPTMEX_checkPenaltyField(penalty, i, COPTMEX_PENALTY_UPPPEN, nRow, p_nWeight);
+  }
+
+  return isvalid;
+}
+
 /* Check all parts of a cone problem */
 static int COPTMEX_checkConeModel(mxArray* conedata)
 {
@@ -726,6 +722,27 @@ exit_cleanup:
   return isvalid;
 }
 
+/* Number of MIP starts given by a vector or by an n-by-K matrix, or -1 if the size does not match */
+static int COPTMEX_getNumStart(const mxArray* mipstart, int ncol)
+{
+  // A dense vector of full length is a single start, whatever its orientation
+  if (!mxIsSparse(mipstart) && mxGetNumberOfElements(mipstart) == ncol)
+  {
+    return 1;
+  }
+  if (mxGetM(mipstart) == ncol)
+  {
+    return (int)mxGetN(mipstart);
+  }
+  return -1;
+}
+
+/* Check if array holds real numeric or logical data */
+static int COPTMEX_isNumData(const mxArray* arr)
+{
+  return (mxIsNumeric(arr) || mxIsLogical(arr)) && !mxIsComplex(arr);
+}
+
 /* Check all parts of a problem */
 static int COPTMEX_checkModel(coptmex_mprob* mprob)
 {
@@ -781,7 +798,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
   // 'obj'
   if (mprob->obj != NULL)
   {
-    if (!mxIsDouble(mprob->obj))
+    if (!COPTMEX_isNumData(mprob->obj))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_MODEL_OBJ);
@@ -799,7 +816,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
   // 'lb'
   if (mprob->lb != NULL)
   {
-    if (!mxIsDouble(mprob->lb))
+    if (!COPTMEX_isNumData(mprob->lb))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_MODEL_LB);
@@ -817,7 +834,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
   // 'ub'
   if (mprob->ub != NULL)
   {
-    if (!mxIsDouble(mprob->ub))
+    if (!COPTMEX_isNumData(mprob->ub))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_MODEL_UB);
@@ -854,7 +871,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
   if (mprob->sense == NULL)
   {
     // 'lhs'
-    if (!mxIsDouble(mprob->lhs))
+    if (!COPTMEX_isNumData(mprob->lhs))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_MODEL_LHS);
@@ -870,7 +887,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
     }
 
     // 'rhs'
-    if (!mxIsDouble(mprob->rhs))
+    if (!COPTMEX_isNumData(mprob->rhs))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_MODEL_RHS);
@@ -904,7 +921,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
     }
 
     // 'rhs'
-    if (!mxIsDouble(mprob->rhs))
+    if (!COPTMEX_isNumData(mprob->rhs))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_MODEL_RHS);
@@ -1022,7 +1039,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
       }
       else
       {
-        if (!mxIsDouble(sosvars) || mxIsScalar(sosvars) || mxIsSparse(sosvars))
+        if (!COPTMEX_isNumData(sosvars) || mxIsScalar(sosvars) || mxIsSparse(sosvars))
         {
           isvalid = 0;
           snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s(%d).%s", COPTMEX_MODEL_SOS, i, COPTMEX_MODEL_SOSVARS);
@@ -1033,7 +1050,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
 
       if (soswght != NULL)
       {
-        if (!mxIsDouble(soswght) || mxIsScalar(soswght) || mxIsSparse(soswght))
+        if (!COPTMEX_isNumData(soswght) || mxIsScalar(soswght) || mxIsSparse(soswght))
         {
           isvalid = 0;
           snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s(%d).%s", COPTMEX_MODEL_SOS, i, COPTMEX_MODEL_SOSWEIGHT);
@@ -1117,7 +1134,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
       }
       else
       {
-        if (!mxIsDouble(indicA))
+        if (!COPTMEX_isNumData(indicA))
         {
           isvalid = 0;
           snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s(%d).%s", COPTMEX_MODEL_INDICATOR, i, COPTMEX_MODEL_INDICROW);
@@ -1227,7 +1244,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
       }
       else
       {
-        if (!mxIsDouble(conevars) || mxIsScalar(conevars) || mxIsSparse(conevars))
+        if (!COPTMEX_isNumData(conevars) || mxIsScalar(conevars) || mxIsSparse(conevars))
         {
           isvalid = 0;
           snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s(%d).%s", COPTMEX_MODEL_CONE, i, COPTMEX_MODEL_CONEVARS);
@@ -1281,7 +1298,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
       }
       else
       {
-        if (!mxIsDouble(conevars) || mxIsScalar(conevars) || mxIsSparse(conevars))
+        if (!COPTMEX_isNumData(conevars) || mxIsScalar(conevars) || mxIsSparse(conevars))
         {
           isvalid = 0;
           snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s(%d).%s", COPTMEX_MODEL_EXPCONE, i, COPTMEX_MODEL_EXPCONEVARS);
@@ -1348,7 +1365,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
 
       if (coneB != NULL)
       {
-        if (!mxIsDouble(coneB))
+        if (!COPTMEX_isNumData(coneB))
         {
           isvalid = 0;
           snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s(%d).%s", COPTMEX_MODEL_AFFCONE, i, COPTMEX_MODEL_AFFCONEB);
@@ -1439,21 +1456,21 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
       {
         if (QcRow != NULL && QcCol != NULL && QcVal != NULL)
         {
-          if (!mxIsDouble(QcRow))
+          if (!COPTMEX_isNumData(QcRow))
           {
             isvalid = 0;
             snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s(%d).%s", COPTMEX_MODEL_QUADCON, i, COPTMEX_MODEL_QCROW);
             COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
             goto exit_cleanup;
           }
-          if (!mxIsDouble(QcCol))
+          if (!COPTMEX_isNumData(QcCol))
           {
             isvalid = 0;
             snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s(%d).%s", COPTMEX_MODEL_QUADCON, i, COPTMEX_MODEL_QCCOL);
             COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
             goto exit_cleanup;
           }
-          if (!mxIsDouble(QcVal))
+          if (!COPTMEX_isNumData(QcVal))
           {
             isvalid = 0;
             snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s(%d).%s", COPTMEX_MODEL_QUADCON, i, COPTMEX_MODEL_QCVAL);
@@ -1481,7 +1498,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
 
       if (QcLinear != NULL)
       {
-        if (!mxIsDouble(QcLinear))
+        if (!COPTMEX_isNumData(QcLinear))
         {
           isvalid = 0;
           snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s(%d).%s", COPTMEX_MODEL_QUADCON, i, COPTMEX_MODEL_QCLINEAR);
@@ -1563,7 +1580,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
   // 'varbasis'
   if (mprob->varbasis != NULL)
   {
-    if (!mxIsDouble(mprob->varbasis) || mxIsScalar(mprob->varbasis) || mxIsSparse(mprob->varbasis))
+    if (!COPTMEX_isNumData(mprob->varbasis) || mxIsScalar(mprob->varbasis) || mxIsSparse(mprob->varbasis))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_RESULT_VARBASIS);
@@ -1581,7 +1598,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
   // 'constrbasis'
   if (mprob->constrbasis != NULL)
   {
-    if (!mxIsDouble(mprob->constrbasis) || mxIsScalar(mprob->constrbasis) || mxIsSparse(mprob->constrbasis))
+    if (!COPTMEX_isNumData(mprob->constrbasis) || mxIsScalar(mprob->constrbasis) || mxIsSparse(mprob->constrbasis))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_RESULT_CONBASIS);
@@ -1599,7 +1616,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
   // 'x'
   if (mprob->value != NULL)
   {
-    if (!mxIsDouble(mprob->value) || mxIsScalar(mprob->value) || mxIsSparse(mprob->value))
+    if (!COPTMEX_isNumData(mprob->value) || mxIsScalar(mprob->value) || mxIsSparse(mprob->value))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_RESULT_VALUE);
@@ -1617,7 +1634,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
   // 'rc'
   if (mprob->redcost != NULL)
   {
-    if (!mxIsDouble(mprob->redcost) || mxIsScalar(mprob->redcost) || mxIsSparse(mprob->redcost))
+    if (!COPTMEX_isNumData(mprob->redcost) || mxIsScalar(mprob->redcost) || mxIsSparse(mprob->redcost))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_RESULT_REDCOST);
@@ -1635,7 +1652,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
   // 'slack'
   if (mprob->slack != NULL)
   {
-    if (!mxIsDouble(mprob->slack) || mxIsScalar(mprob->slack) || mxIsSparse(mprob->slack))
+    if (!COPTMEX_isNumData(mprob->slack) || mxIsScalar(mprob->slack) || mxIsSparse(mprob->slack))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_RESULT_SLACK);
@@ -1653,7 +1670,7 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
   // 'pi'
   if (mprob->dual != NULL)
   {
-    if (!mxIsDouble(mprob->dual) || mxIsScalar(mprob->dual) || mxIsSparse(mprob->dual))
+    if (!COPTMEX_isNumData(mprob->dual) || mxIsScalar(mprob->dual) || mxIsSparse(mprob->dual))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_RESULT_DUAL);
@@ -1671,35 +1688,308 @@ static int COPTMEX_checkModel(coptmex_mprob* mprob)
   // 'start'
   if (mprob->mipstart != NULL)
   {
-    if (!mxIsDouble(mprob->mipstart))
+    if (!COPTMEX_isNumData(mprob->mipstart))
     {
       isvalid = 0;
       snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_ADVINFO_MIPSTART);
       COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
       goto exit_cleanup;
     }
-    if (!mxIsSparse(mprob->mipstart))
+    if (COPTMEX_getNumStart(mprob->mipstart, ncol) < 0)
     {
-      if (mxGetNumberOfElements(mprob->mipstart) != ncol)
-      {
-        isvalid = 0;
-        snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_ADVINFO_MIPSTART);
-        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
-        goto exit_cleanup;
-      }
+      isvalid = 0;
+      snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_ADVINFO_MIPSTART);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+      goto exit_cleanup;
     }
-    else
+  }
+
+exit_cleanup:
+  return isvalid;
+}
+
+/* Check all parts of a linprog/quadprog/intlinprog problem */
+static int COPTMEX_checkProg(coptmex_mprog* mprog, int* p_ncol)
+{
+  int ncol = -1;
+  int isvalid = 1;
+  char msgbuf[COPT_BUFFSIZE];
+
+  const char* names[] = {COPTMEX_PROG_F, COPTMEX_PROG_H, COPTMEX_PROG_INTCON, COPTMEX_PROG_AINEQ, COPTMEX_PROG_BINEQ,
+    COPTMEX_PROG_AEQ, COPTMEX_PROG_BEQ, COPTMEX_PROG_LB, COPTMEX_PROG_UB, COPTMEX_PROG_X0};
+  mxArray* fields[] = {mprog->f, mprog->H, mprog->intcon, mprog->Aineq, mprog->bineq, mprog->Aeq, mprog->beq, mprog->lb,
+    mprog->ub, mprog->x0};
+
+  for (int i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i)
+  {
+    if (fields[i] != NULL && !COPTMEX_isNumData(fields[i]))
     {
-      if (mxGetN(mprob->mipstart) != 1)
-      {
-        isvalid = 0;
-        snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_ADVINFO_MIPSTART);
-        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, msgbuf);
-        goto exit_cleanup;
-      }
+      isvalid = 0;
+      snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", names[i]);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+      goto exit_cleanup;
+    }
+  }
+
+  // Number of columns is given by 'f', or by any matrix block
+  if (mprog->f != NULL)
+  {
+    ncol = (int)mxGetNumberOfElements(mprog->f);
+  }
+  else if (mprog->Aineq != NULL)
+  {
+    ncol = (int)mxGetN(mprog->Aineq);
+  }
+  else if (mprog->Aeq != NULL)
+  {
+    ncol = (int)mxGetN(mprog->Aeq);
+  }
+  else if (mprog->H != NULL)
+  {
+    ncol = (int)mxGetN(mprog->H);
+  }
+  else
+  {
+    isvalid = 0;
+    snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_F);
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, msgbuf);
+    goto exit_cleanup;
+  }
+
+  // 'H'
+  if (mprog->H != NULL)
+  {
+    if (mxGetM(mprog->H) != ncol || mxGetN(mprog->H) != ncol)
+    {
+      isvalid = 0;
+      snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_H);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+      goto exit_cleanup;
+    }
+  }
+  // 'Aineq' and 'bineq'
+  if (mprog->Aineq != NULL)
+  {
+    if (mxGetN(mprog->Aineq) != ncol)
+    {
+      isvalid = 0;
+      snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_AINEQ);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+      goto exit_cleanup;
+    }
+    if (mprog->bineq == NULL || mxIsSparse(mprog->bineq) ||
+        mxGetNumberOfElements(mprog->bineq) != mxGetM(mprog->Aineq))
+    {
+      isvalid = 0;
+      snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_BINEQ);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+      goto exit_cleanup;
+    }
+  }
+  else if (mprog->bineq != NULL)
+  {
+    isvalid = 0;
+    snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_BINEQ);
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+    goto exit_cleanup;
+  }
+  // 'Aeq' and 'beq'
+  if (mprog->Aeq != NULL)
+  {
+    if (mxGetN(mprog->Aeq) != ncol)
+    {
+      isvalid = 0;
+      snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_AEQ);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+      goto exit_cleanup;
+    }
+    if (mprog->beq == NULL || mxIsSparse(mprog->beq) || mxGetNumberOfElements(mprog->beq) != mxGetM(mprog->Aeq))
+    {
+      isvalid = 0;
+      snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_BEQ);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+      goto exit_cleanup;
+    }
+  }
+  else if (mprog->beq != NULL)
+  {
+    isvalid = 0;
+    snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_BEQ);
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+    goto exit_cleanup;
+  }
+  // 'lb', 'ub' and 'x0'
+  if (mprog->lb != NULL)
+  {
+    if (mxIsSparse(mprog->lb) || mxGetNumberOfElements(mprog->lb) != ncol)
+    {
+      isvalid = 0;
+      snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_LB);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+      goto exit_cleanup;
+    }
+  }
+  if (mprog->ub != NULL)
+  {
+    if (mxIsSparse(mprog->ub) || mxGetNumberOfElements(mprog->ub) != ncol)
+    {
+      isvalid = 0;
+      snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_UB);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+      goto exit_cleanup;
+    }
+  }
+  if (mprog->x0 != NULL)
+  {
+    if (mxIsSparse(mprog->x0) || mxGetNumberOfElements(mprog->x0) != ncol)
+    {
+      isvalid = 0;
+      snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_X0);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+      goto exit_cleanup;
+    }
+  }
+  // 'intcon'
+  if (mprog->intcon != NULL)
+  {
+    if (mxIsSparse(mprog->intcon) || mxGetNumberOfElements(mprog->intcon) > ncol)
+    {
+      isvalid = 0;
+      snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_INTCON);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, msgbuf);
+      goto exit_cleanup;
+    }
+  }
+
+  *p_ncol = ncol;
+
+exit_cleanup:
+  return isvalid;
+}
+
+/* Check columns appended to a kept problem */
+static int COPTMEX_checkAddCols(copt_prob* prob, const mxArray* in_obj, const mxArray* in_A, const mxArray* in_lb,
+                                const mxArray* in_ub, int* p_ncol)
+{
+  int isvalid = 1;
+  int nRow = 0;
+  int ncol = 0;
+
+  COPT_GetIntAttr(prob, COPT_INTATTR_ROWS, &nRow);
+
+  if (!COPTMEX_isNumData(in_obj))
+  {
+    isvalid = 0;
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "obj");
+    goto exit_cleanup;
+  }
+  ncol = (int)mxGetNumberOfElements(in_obj);
+
+  // 'A' holds one column per new variable over all existing rows
+  if (!COPTMEX_isNumData(in_A))
+  {
+    isvalid = 0;
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "A");
+    goto exit_cleanup;
+  }
+  if (mxGetM(in_A) != nRow || mxGetN(in_A) != ncol)
+  {
+    isvalid = 0;
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "A");
+    goto exit_cleanup;
+  }
+
+  // 'lb' and 'ub' are optional
+  if (in_lb != NULL && !mxIsEmpty(in_lb))
+  {
+    if (!COPTMEX_isNumData(in_lb) || mxIsSparse(in_lb))
+    {
+      isvalid = 0;
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "lb");
+      goto exit_cleanup;
+    }
+    if (mxGetNumberOfElements(in_lb) != ncol)
+    {
+      isvalid = 0;
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "lb");
+      goto exit_cleanup;
+    }
+  }
+  if (in_ub != NULL && !mxIsEmpty(in_ub))
+  {
+    if (!COPTMEX_isNumData(in_ub) || mxIsSparse(in_ub))
+    {
+      isvalid = 0;
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "ub");
+      goto exit_cleanup;
+    }
+    if (mxGetNumberOfElements(in_ub) != ncol)
+    {
+      isvalid = 0;
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "ub");
+      goto exit_cleanup;
     }
   }
 
+  *p_ncol = ncol;
+
+exit_cleanup:
+  return isvalid;
+}
+
+/* Check rows appended to a kept problem */
+static int COPTMEX_checkAddRows(copt_prob* prob, const mxArray* in_A, const mxArray* in_sense, const mxArray* in_rhs,
+                                int* p_nrow)
+{
+  int isvalid = 1;
+  int nCol = 0;
+  int nrow = 0;
+
+  COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &nCol);
+
+  // 'A' holds one row per new constraint over all existing columns
+  if (!COPTMEX_isNumData(in_A))
+  {
+    isvalid = 0;
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "A");
+    goto exit_cleanup;
+  }
+  if (mxGetN(in_A) != nCol)
+  {
+    isvalid = 0;
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "A");
+    goto exit_cleanup;
+  }
+  nrow = (int)mxGetM(in_A);
+
+  if (!mxIsChar(in_sense))
+  {
+    isvalid = 0;
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "sense");
+    goto exit_cleanup;
+  }
+  if (mxGetNumberOfElements(in_sense) != nrow)
+  {
+    isvalid = 0;
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "sense");
+    goto exit_cleanup;
+  }
+
+  if (!COPTMEX_isNumData(in_rhs) || mxIsSparse(in_rhs))
+  {
+    isvalid = 0;
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "rhs");
+    goto exit_cleanup;
+  }
+  if (mxGetNumberOfElements(in_rhs) != nrow)
+  {
+    isvalid = 0;
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "rhs");
+    goto exit_cleanup;
+  }
+
+  *p_nrow = nrow;
+
 exit_cleanup:
   return isvalid;
 }
@@ -1,5 +1,53 @@
+/* Expose mkstemps and memfd syscall declarations on glibc */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include "coptmex.h"
 
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#define COPTMEX_fdWrite _write
+#define COPTMEX_fdRead _read
+#define COPTMEX_fdSeek _lseeki64
+#define COPTMEX_fdClose _close
+#define COPTMEX_unlink _unlink
+#define COPTMEX_statbuf struct _stat64
+#define COPTMEX_stat _stat64
+#define COPTMEX_utime(path) _utime(path, NULL)
+#define COPTMEX_getpid _getpid
+#include <sys/utime.h>
+#include <process.h>
+#define COPTMEX_sleepMs(ms) Sleep(ms)
+typedef HANDLE coptmex_thread;
+typedef CRITICAL_SECTION coptmex_mutex;
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <utime.h>
+#define COPTMEX_statbuf struct stat
+#define COPTMEX_stat stat
+#define COPTMEX_utime(path) utime(path, NULL)
+#define COPTMEX_getpid getpid
+#include <sys/syscall.h>
+#define COPTMEX_fdWrite write
+#define COPTMEX_fdRead read
+#define COPTMEX_fdSeek lseek
+#define COPTMEX_fdClose close
+#define COPTMEX_unlink unlink
+#include <pthread.h>
+#include <time.h>
+#define COPTMEX_sleepMs(ms) usleep((ms) * 1000)
+typedef pthread_t coptmex_thread;
+typedef pthread_mutex_t coptmex_mutex;
+#endif
+
 /* Uncomment the following line for use with legacy MEX APIs */
 // #define COPTMEX_USE_LEGACYMEX
 #ifdef COPTMEX_USE_LEGACYMEX
@@ -75,6 +123,262 @@ static void COPT_CALL COPTMEX_printLog(char* msg, void* userdata)
   }
 }
 
+/* Wall clock time in seconds */
+static double COPTMEX_getWallTime(void)
+{
+#ifdef _WIN32
+  LARGE_INTEGER freq, count;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&count);
+  return (double) count.QuadPart / (double) freq.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + 1e-9 * (double) ts.tv_nsec;
+#endif
+}
+
+/* Bytes requested through COPTMEX_alloc, reported in timing info */
+static size_t COPTMEX_nAllocBytes = 0;
+
+/* Allocate memory for model and result data, counted in timing info */
+static void* COPTMEX_alloc(size_t n, size_t size)
+{
+  COPTMEX_nAllocBytes += n * size;
+  return mxCalloc(n, size);
+}
+
+/* Number of logical processors */
+static int COPTMEX_getNumProcs(void)
+{
+#ifdef _WIN32
+  SYSTEM_INFO sysinfo;
+  GetSystemInfo(&sysinfo);
+  return (int) sysinfo.dwNumberOfProcessors;
+#else
+  long nprocs = sysconf(_SC_NPROCESSORS_ONLN);
+  return nprocs > 0 ? (int) nprocs : 1;
+#endif
+}
+
+/* Work queue shared by threads of COPTMEX_runParallel */
+typedef struct coptmex_workqueue_s
+{
+  int nTask;
+  int iNext;
+  void (*task)(void* data, int iTask);
+  void* data;
+  coptmex_mutex lock;
+} coptmex_workqueue;
+
+#ifdef _WIN32
+static DWORD WINAPI COPTMEX_runWorker(LPVOID arg)
+#else
+static void* COPTMEX_runWorker(void* arg)
+#endif
+{
+  coptmex_workqueue* queue = (coptmex_workqueue*) arg;
+
+  for (;;)
+  {
+    int iTask = 0;
+
+#ifdef _WIN32
+    EnterCriticalSection(&queue->lock);
+    iTask = queue->iNext++;
+    LeaveCriticalSection(&queue->lock);
+#else
+    pthread_mutex_lock(&queue->lock);
+    iTask = queue->iNext++;
+    pthread_mutex_unlock(&queue->lock);
+#endif
+
+    if (iTask >= queue->nTask)
+    {
+      break;
+    }
+    queue->task(queue->data, iTask);
+  }
+
+#ifdef _WIN32
+  return 0;
+#else
+  return NULL;
+#endif
+}
+
+/* Run tasks on a pool of threads, tasks must not call MATLAB APIs */
+static int COPTMEX_runParallel(int nTask, int nThread, void (*task)(void* data, int iTask), void* data)
+{
+  int retcode = COPT_RETCODE_OK;
+  int nStarted = 0;
+  coptmex_thread* threads = NULL;
+  coptmex_workqueue queue;
+
+  queue.nTask = nTask;
+  queue.iNext = 0;
+  queue.task = task;
+  queue.data = data;
+
+  nThread = COPTMEX_MAX(1, COPTMEX_MIN(nThread, nTask));
+  threads = (coptmex_thread*) mxCalloc(nThread, sizeof(coptmex_thread));
+  if (!threads)
+  {
+    return COPT_RETCODE_MEMORY;
+  }
+
+#ifdef _WIN32
+  InitializeCriticalSection(&queue.lock);
+  for (int i = 0; i < nThread; ++i)
+  {
+    threads[i] = CreateThread(NULL, 0, COPTMEX_runWorker, &queue, 0, NULL);
+    if (threads[i] == NULL)
+    {
+      break;
+    }
+    nStarted++;
+  }
+#else
+  pthread_mutex_init(&queue.lock, NULL);
+  for (int i = 0; i < nThread; ++i)
+  {
+    if (pthread_create(&threads[i], NULL, COPTMEX_runWorker, &queue) != 0)
+    {
+      break;
+    }
+    nStarted++;
+  }
+#endif
+
+  // Fall back to the calling thread if no worker could be started
+  if (nStarted == 0)
+  {
+    COPTMEX_runWorker(&queue);
+  }
+
+#ifdef _WIN32
+  for (int i = 0; i < nStarted; ++i)
+  {
+    WaitForSingleObject(threads[i], INFINITE);
+    CloseHandle(threads[i]);
+  }
+  DeleteCriticalSection(&queue.lock);
+#else
+  for (int i = 0; i < nStarted; ++i)
+  {
+    pthread_join(threads[i], NULL);
+  }
+  pthread_mutex_destroy(&queue.lock);
+#endif
+
+  mxFree(threads);
+  return retcode;
+}
+
+/* Watchdog stopping problems on time limit or MATLAB interruption */
+typedef struct coptmex_watchdog_s
+{
+  copt_prob** probs;
+  int nProb;
+  double deadline;
+  volatile int done;
+  volatile int stopped;
+  int started;
+  coptmex_thread thread;
+} coptmex_watchdog;
+
+#ifdef _WIN32
+static DWORD WINAPI COPTMEX_runWatchdog(LPVOID arg)
+#else
+static void* COPTMEX_runWatchdog(void* arg)
+#endif
+{
+  coptmex_watchdog* watchdog = (coptmex_watchdog*) arg;
+
+  while (!watchdog->done)
+  {
+    if (utIsInterruptPending())
+    {
+      utSetInterruptPending(0);
+      watchdog->stopped = COPTMEX_WATCHDOG_INTERRUPT;
+    }
+    else if (watchdog->deadline > 0.0 && COPTMEX_getWallTime() >= watchdog->deadline)
+    {
+      watchdog->stopped = COPTMEX_WATCHDOG_TIMEOUT;
+    }
+
+    if (watchdog->stopped)
+    {
+      for (int i = 0; i < watchdog->nProb; ++i)
+      {
+        COPT_Interrupt(watchdog->probs[i]);
+      }
+      break;
+    }
+
+    COPTMEX_sleepMs(50);
+  }
+
+#ifdef _WIN32
+  return 0;
+#else
+  return NULL;
+#endif
+}
+
+/* Start watchdog for problems, timelimit <= 0 only watches interruption */
+static void COPTMEX_startWatchdog(coptmex_watchdog* watchdog, copt_prob** probs, int nProb, double timelimit)
+{
+  watchdog->probs = probs;
+  watchdog->nProb = nProb;
+  watchdog->deadline = (timelimit > 0.0 ? COPTMEX_getWallTime() + timelimit : 0.0);
+  watchdog->done = 0;
+  watchdog->stopped = 0;
+
+#ifdef _WIN32
+  watchdog->thread = CreateThread(NULL, 0, COPTMEX_runWatchdog, watchdog, 0, NULL);
+  watchdog->started = (watchdog->thread != NULL);
+#else
+  watchdog->started = (pthread_create(&watchdog->thread, NULL, COPTMEX_runWatchdog, watchdog) == 0);
+#endif
+}
+
+/* Stop watchdog and report why problems were stopped, if any */
+static int COPTMEX_stopWatchdog(coptmex_watchdog* watchdog)
+{
+  watchdog->done = 1;
+  if (watchdog->started)
+  {
+#ifdef _WIN32
+    WaitForSingleObject(watchdog->thread, INFINITE);
+    CloseHandle(watchdog->thread);
+#else
+    pthread_join(watchdog->thread, NULL);
+#endif
+    watchdog->started = 0;
+  }
+
+  if (watchdog->stopped == COPTMEX_WATCHDOG_INTERRUPT)
+  {
+    mexPrintf("User interruption detected in MATLAB, stopping...\n");
+  }
+
+  return watchdog->stopped;
+}
+
+/* Solve problem under watchdog, since the interrupt callback is only reached at MIP nodes */
+static int COPTMEX_solveWatched(copt_prob* prob)
+{
+  int retcode = COPT_RETCODE_OK;
+  coptmex_watchdog watchdog;
+
+  COPTMEX_startWatchdog(&watchdog, &prob, 1, 0.0);
+  retcode = COPT_Solve(prob);
+  COPTMEX_stopWatchdog(&watchdog);
+
+  return retcode;
+}
+
 /* Convert status code from integer to string */
 static const char* COPTMEX_statusInt2Str(int status)
 {
@@ -133,7 +437,7 @@ static int COPTMEX_getString(const mxArray* in_array, char** out_str)
   int retcode = 0;
 
   int bufflen = mxGetNumberOfElements(in_array) + 1;
-  char* buffer = (char*)mxCalloc(bufflen, sizeof(char));
+  char* buffer = (char*)COPTMEX_alloc(bufflen, sizeof(char));
   if (!buffer)
   {
     retcode = COPT_RETCODE_MEMORY;
@@ -157,11 +461,11 @@ static void COPTMEX_freeString(char** in_str)
   return;
 }
 
-/* Display error message */
-void COPTMEX_errorMsg(int errcode, const char* errinfo)
+/* Get identifier and message format of error, return 0 if unknown */
+static int COPTMEX_getErrorText(int errcode, const char** p_errid, const char** p_errtxt)
 {
-  char* errid = NULL;
-  char* errtxt = NULL;
+  const char* errid = NULL;
+  const char* errtxt = NULL;
 
   switch (errcode)
   {
@@ -186,12 +490,65 @@ void COPTMEX_errorMsg(int errcode, const char* errinfo)
     errtxt = "%s.";
     break;
   default:
+    return 0;
+  }
+
+  *p_errid = errid;
+  *p_errtxt = errtxt;
+  return 1;
+}
+
+/* Display error message */
+void COPTMEX_errorMsg(int errcode, const char* errinfo)
+{
+  const char* errid = NULL;
+  const char* errtxt = NULL;
+
+  if (!COPTMEX_getErrorText(errcode, &errid, &errtxt))
+  {
     return;
   }
 
   mexErrMsgIdAndTxt(errid, errtxt, errinfo);
 }
 
+/* Create error as MException, to be raised after cleanup */
+static mxArray* COPTMEX_createError(int errcode, const char* errinfo)
+{
+  const char* errid = NULL;
+  const char* errtxt = NULL;
+  char msgbuf[COPT_BUFFSIZE];
+  mxArray* rhs[3];
+  mxArray* except = NULL;
+
+  if (!COPTMEX_getErrorText(errcode, &errid, &errtxt))
+  {
+    return NULL;
+  }
+
+  snprintf(msgbuf, COPT_BUFFSIZE, errtxt, errinfo);
+  rhs[0] = mxCreateString(errid);
+  rhs[1] = mxCreateString("%s");
+  rhs[2] = mxCreateString(msgbuf);
+  mexCallMATLAB(1, &except, 3, rhs, "MException");
+  for (int i = 0; i < 3; ++i)
+  {
+    mxDestroyArray(rhs[i]);
+  }
+
+  return except;
+}
+
+/* Raise error kept by COPTMEX_stopUserCallback or COPTMEX_stopProgress, if any */
+void COPTMEX_rethrow(mxArray* except)
+{
+  if (except != NULL)
+  {
+    mexCallMATLAB(0, NULL, 1, &except, "rethrow");
+  }
+  return;
+}
+
 /* Convert CSR matrix to CSC matrix */
 int COPTMEX_csr2csc(int* matBeg, int* matCnt, int* matIdx, double* matElem, mxArray* mat)
 {
@@ -354,134 +711,441 @@ int COPTMEX_coo2csc(int nQElem, int* qMatRow, int* qMatCol, double* qMatElem, mx
   return COPT_RETCODE_OK;
 }
 
-#include "coptinit.c"
+#define COPTMEX_COPYDATA(srctype, src, dsttype, dst, nelem, offset) \
+  do                                                              \
+  {                                                               \
+    const srctype* src_data = (const srctype*)(src);              \
+    for (size_t k = 0; k < (nelem); ++k)                          \
+    {                                                             \
+      (dst)[k] = (dsttype)src_data[k] - (offset);                 \
+    }                                                             \
+  } while (0)
+
+/* Get number of stored elements of dense or sparse array */
+static size_t COPTMEX_getNumData(const mxArray* arr)
+{
+  return mxIsSparse(arr) ? (size_t)mxGetNzmax(arr) : mxGetNumberOfElements(arr);
+}
 
-/* Display banner */
-int COPTMEX_dispBanner(void)
+/* Copy numeric or logical array to double buffer */
+static void COPTMEX_copyDoubles(const mxArray* arr, size_t nelem, double* data)
 {
-  int retcode = 0;
-  char msgbuf[COPT_BUFFSIZE];
+  void* src = mxGetData(arr);
 
-  COPTMEX_CALL(COPT_GetBanner(msgbuf, COPT_BUFFSIZE));
-  mexPrintf("%s\n", msgbuf);
-  mexEvalString("drawnow;");
+  switch (mxGetClassID(arr))
+  {
+  case mxDOUBLE_CLASS:
+    COPTMEX_COPYDATA(double, src, double, data, nelem, 0);
+    break;
+  case mxSINGLE_CLASS:
+    COPTMEX_COPYDATA(float, src, double, data, nelem, 0);
+    break;
+  case mxINT8_CLASS:
+    COPTMEX_COPYDATA(int8_T, src, double, data, nelem, 0);
+    break;
+  case mxUINT8_CLASS:
+    COPTMEX_COPYDATA(uint8_T, src, double, data, nelem, 0);
+    break;
+  case mxINT16_CLASS:
+    COPTMEX_COPYDATA(int16_T, src, double, data, nelem, 0);
+    break;
+  case mxUINT16_CLASS:
+    COPTMEX_COPYDATA(uint16_T, src, double, data, nelem, 0);
+    break;
+  case mxINT32_CLASS:
+    COPTMEX_COPYDATA(int32_T, src, double, data, nelem, 0);
+    break;
+  case mxUINT32_CLASS:
+    COPTMEX_COPYDATA(uint32_T, src, double, data, nelem, 0);
+    break;
+  case mxINT64_CLASS:
+    COPTMEX_COPYDATA(int64_T, src, double, data, nelem, 0);
+    break;
+  case mxUINT64_CLASS:
+    COPTMEX_COPYDATA(uint64_T, src, double, data, nelem, 0);
+    break;
+  case mxLOGICAL_CLASS:
+    COPTMEX_COPYDATA(mxLogical, src, double, data, nelem, 0);
+    break;
+  default:
+    break;
+  }
 
-exit_cleanup:
-  return retcode;
+  return;
 }
 
-/* Extract version of COPT */
-int COPTMEX_getVersion(mxArray** out_version)
+/* Copy numeric or logical array to int buffer, minus offset */
+static void COPTMEX_copyInts(const mxArray* arr, size_t nelem, int offset, int* data)
 {
-  int retcode = COPT_RETCODE_OK;
-  mxArray* retver = NULL;
-  coptmex_mversion coptver;
+  void* src = mxGetData(arr);
 
-  COPTMEX_initVersion(&coptver);
+  switch (mxGetClassID(arr))
+  {
+  case mxDOUBLE_CLASS:
+    COPTMEX_COPYDATA(double, src, int, data, nelem, offset);
+    break;
+  case mxSINGLE_CLASS:
+    COPTMEX_COPYDATA(float, src, int, data, nelem, offset);
+    break;
+  case mxINT8_CLASS:
+    COPTMEX_COPYDATA(int8_T, src, int, data, nelem, offset);
+    break;
+  case mxUINT8_CLASS:
+    COPTMEX_COPYDATA(uint8_T, src, int, data, nelem, offset);
+    break;
+  case mxINT16_CLASS:
+    COPTMEX_COPYDATA(int16_T, src, int, data, nelem, offset);
+    break;
+  case mxUINT16_CLASS:
+    COPTMEX_COPYDATA(uint16_T, src, int, data, nelem, offset);
+    break;
+  case mxINT32_CLASS:
+    COPTMEX_COPYDATA(int32_T, src, int, data, nelem, offset);
+    break;
+  case mxUINT32_CLASS:
+    COPTMEX_COPYDATA(uint32_T, src, int, data, nelem, offset);
+    break;
+  case mxINT64_CLASS:
+    COPTMEX_COPYDATA(int64_T, src, int, data, nelem, offset);
+    break;
+  case mxUINT64_CLASS:
+    COPTMEX_COPYDATA(uint64_T, src, int, data, nelem, offset);
+    break;
+  case mxLOGICAL_CLASS:
+    COPTMEX_COPYDATA(mxLogical, src, int, data, nelem, offset);
+    break;
+  default:
+    break;
+  }
 
-  coptver.major = mxCreateDoubleMatrix(1, 1, mxREAL);
-  coptver.minor = mxCreateDoubleMatrix(1, 1, mxREAL);
-  coptver.technical = mxCreateDoubleMatrix(1, 1, mxREAL);
-  if (!coptver.major || !coptver.minor || !coptver.technical)
+  return;
+}
+
+/* Get double data of array, converted to a new buffer if not of double type */
+static double* COPTMEX_getDoubles(const mxArray* arr)
+{
+  if (mxIsDouble(arr))
   {
-    retcode = COPT_RETCODE_MEMORY;
-    goto exit_cleanup;
+    return mxGetDoubles(arr);
   }
 
-  *mxGetDoubles(coptver.major) = COPT_VERSION_MAJOR;
-  *mxGetDoubles(coptver.minor) = COPT_VERSION_MINOR;
-  *mxGetDoubles(coptver.technical) = COPT_VERSION_TECHNICAL;
+  size_t nelem = COPTMEX_getNumData(arr);
+  double* data = (double*)COPTMEX_alloc(COPTMEX_MAX(nelem, 1), sizeof(double));
+  if (data != NULL)
+  {
+    COPTMEX_copyDoubles(arr, nelem, data);
+  }
 
-  retver = mxCreateStructMatrix(1, 1, 0, NULL);
-  if (!retver)
+  return data;
+}
+
+/* Free double data returned by COPTMEX_getDoubles */
+static void COPTMEX_freeDoubles(const mxArray* arr, double* data)
+{
+  if (data != NULL && !mxIsDouble(arr))
   {
-    retcode = COPT_RETCODE_MEMORY;
-    goto exit_cleanup;
+    mxFree(data);
   }
+  return;
+}
 
-  // 'major'
-  mxAddField(retver, COPTMEX_VERSION_MAJOR);
-  mxSetField(retver, 0, COPTMEX_VERSION_MAJOR, coptver.major);
-  // 'minor'
-  mxAddField(retver, COPTMEX_VERSION_MINOR);
-  mxSetField(retver, 0, COPTMEX_VERSION_MINOR, coptver.minor);
-  // 'technical'
-  mxAddField(retver, COPTMEX_VERSION_TECHNICAL);
-  mxSetField(retver, 0, COPTMEX_VERSION_TECHNICAL, coptver.technical);
+#include "coptinit.c"
 
-  *out_version = retver;
+/* The process-wide state shared by all commands of coptmex */
+static coptmex_registry COPTMEX_registry = {NULL};
 
-exit_cleanup:
-  if (retcode != COPT_RETCODE_OK)
+/* Release the shared state when MEX file is cleared */
+static void COPTMEX_freeRegistry(void)
+{
+  // Problems kept by handles must go before the environment owning them
+  for (int i = 0; i < COPTMEX_registry.nHandle; ++i)
   {
-    *out_version = NULL;
+    COPT_DeleteProb(&COPTMEX_registry.handles[i].prob);
   }
+  free(COPTMEX_registry.handles);
+  COPTMEX_registry.handles = NULL;
+  COPTMEX_registry.nHandle = 0;
 
-  return retcode;
+  COPT_DeleteEnv(&COPTMEX_registry.env);
 }
 
-/* Extract objective sense */
-int COPTMEX_getObjsen(const mxArray* in_objsen, int* out_objsen)
+/* Get the shared COPT environment, create it on first use */
+int COPTMEX_getEnv(copt_env** p_env)
 {
   int retcode = COPT_RETCODE_OK;
-  char* objsen = NULL;
 
-  COPTMEX_CALL(COPTMEX_getString(in_objsen, &objsen));
-  *out_objsen = COPTMEX_objsenStr2Int(objsen);
+  if (COPTMEX_registry.env == NULL)
+  {
+    COPTMEX_CALL(COPT_CreateEnv(&COPTMEX_registry.env));
+    mexAtExit(COPTMEX_freeRegistry);
+  }
+
+  *p_env = COPTMEX_registry.env;
 
 exit_cleanup:
-  COPTMEX_freeString(&objsen);
   return retcode;
 }
 
-/* Extract LP solution */
-static int COPTMEX_getLpResult(copt_prob* prob, mxArray** out_lpresult)
+/* Find position of handle in registry, or -1 if it is not a live handle */
+static int COPTMEX_findHandle(const mxArray* in_handle)
 {
-  int retcode = COPT_RETCODE_OK;
-  mxArray* lpResult = NULL;
-  coptmex_clpsol csol;
-  coptmex_mlpsol msol;
-
-  COPTMEX_initCLpSol(&csol);
-  COPTMEX_initMLpSol(&msol);
-
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ROWS, &csol.nRow));
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &csol.nCol));
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_PSDCOLS, &csol.nPSD));
-  COPTMEX_CALL(COPT_GetIntAttr(prob, "PSDLens", &csol.nPSDLen));
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_PSDCONSTRS, &csol.nPSDConstr));
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_QCONSTRS, &csol.nQConstr));
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_LPSTATUS, &csol.nStatus));
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_HASBASIS, &csol.hasBasis));
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_HASLPSOL, &csol.hasLpSol));
+  unsigned long long id = 0;
 
-  msol.status = mxCreateString(COPTMEX_statusInt2Str(csol.nStatus));
-  msol.simplexiter = mxCreateDoubleMatrix(1, 1, mxREAL);
-  msol.barrieriter = mxCreateDoubleMatrix(1, 1, mxREAL);
-  msol.solvingtime = mxCreateDoubleMatrix(1, 1, mxREAL);
-  if (!msol.status || !msol.simplexiter || !msol.barrieriter || !msol.solvingtime)
+  if (!mxIsUint64(in_handle) || mxIsComplex(in_handle) || mxGetNumberOfElements(in_handle) != 1)
   {
-    retcode = COPT_RETCODE_MEMORY;
-    goto exit_cleanup;
+    return -1;
   }
 
-  if (csol.hasLpSol)
+  id = *(const unsigned long long*) mxGetData(in_handle);
+  for (int i = 0; i < COPTMEX_registry.nHandle; ++i)
   {
-    msol.objval = mxCreateDoubleMatrix(1, 1, mxREAL);
-    msol.value = mxCreateDoubleMatrix(csol.nCol, 1, mxREAL);
-    msol.redcost = mxCreateDoubleMatrix(csol.nCol, 1, mxREAL);
-    msol.slack = mxCreateDoubleMatrix(csol.nRow, 1, mxREAL);
-    msol.dual = mxCreateDoubleMatrix(csol.nRow, 1, mxREAL);
-    if (!msol.objval || !msol.value || !msol.redcost || !msol.slack || !msol.dual)
+    if (COPTMEX_registry.handles[i].id == id)
     {
-      retcode = COPT_RETCODE_MEMORY;
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/* Keep problem alive across calls and return its handle */
+int COPTMEX_addHandle(copt_prob* prob, mxArray** out_handle)
+{
+  int retcode = 0;
+  coptmex_registry* registry = &COPTMEX_registry;
+  coptmex_handle* handles = NULL;
+
+  // Handles outlive the MEX call, so they are not allocated by MATLAB
+  handles = (coptmex_handle*) realloc(registry->handles, (registry->nHandle + 1) * sizeof(coptmex_handle));
+  if (!handles)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+  registry->handles = handles;
+
+  *out_handle = mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL);
+  if (!*out_handle)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  // Ids are never reused, so a freed handle can not reach a newer problem
+  registry->handles[registry->nHandle].id = ++registry->nLastId;
+  registry->handles[registry->nHandle].prob = prob;
+  registry->nHandle++;
+
+  *(unsigned long long*) mxGetData(*out_handle) = registry->nLastId;
+
+exit_cleanup:
+  return retcode;
+}
+
+/* Get problem kept by handle */
+int COPTMEX_getHandle(const mxArray* in_handle, copt_prob** p_prob)
+{
+  int retcode = 0;
+  int iHandle = COPTMEX_findHandle(in_handle);
+
+  if (iHandle < 0)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, "handle");
+    goto exit_cleanup;
+  }
+
+  *p_prob = COPTMEX_registry.handles[iHandle].prob;
+
+exit_cleanup:
+  return retcode;
+}
+
+/* Delete problem kept by handle */
+int COPTMEX_freeHandle(const mxArray* in_handle)
+{
+  int retcode = 0;
+  coptmex_registry* registry = &COPTMEX_registry;
+  int iHandle = COPTMEX_findHandle(in_handle);
+
+  if (iHandle < 0)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, "handle");
+    goto exit_cleanup;
+  }
+
+  COPTMEX_CALL(COPT_DeleteProb(&registry->handles[iHandle].prob));
+
+  registry->nHandle--;
+  registry->handles[iHandle] = registry->handles[registry->nHandle];
+
+exit_cleanup:
+  return retcode;
+}
+
+/* Display banner */
+int COPTMEX_dispBanner(void)
+{
+  int retcode = 0;
+  char msgbuf[COPT_BUFFSIZE];
+
+  COPTMEX_CALL(COPT_GetBanner(msgbuf, COPT_BUFFSIZE));
+  mexPrintf("%s\n", msgbuf);
+  mexEvalString("drawnow;");
+
+exit_cleanup:
+  return retcode;
+}
+
+/* Extract version of COPT */
+int COPTMEX_getVersion(mxArray** out_version)
+{
+  int retcode = COPT_RETCODE_OK;
+  mxArray* retver = NULL;
+  coptmex_mversion coptver;
+
+  COPTMEX_initVersion(&coptver);
+
+  coptver.major = mxCreateDoubleMatrix(1, 1, mxREAL);
+  coptver.minor = mxCreateDoubleMatrix(1, 1, mxREAL);
+  coptver.technical = mxCreateDoubleMatrix(1, 1, mxREAL);
+  if (!coptver.major || !coptver.minor || !coptver.technical)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  *mxGetDoubles(coptver.major) = COPT_VERSION_MAJOR;
+  *mxGetDoubles(coptver.minor) = COPT_VERSION_MINOR;
+  *mxGetDoubles(coptver.technical) = COPT_VERSION_TECHNICAL;
+
+  retver = mxCreateStructMatrix(1, 1, 0, NULL);
+  if (!retver)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  // 'major'
+  mxAddField(retver, COPTMEX_VERSION_MAJOR);
+  mxSetField(retver, 0, COPTMEX_VERSION_MAJOR, coptver.major);
+  // 'minor'
+  mxAddField(retver, COPTMEX_VERSION_MINOR);
+  mxSetField(retver, 0, COPTMEX_VERSION_MINOR, coptver.minor);
+  // 'technical'
+  mxAddField(retver, COPTMEX_VERSION_TECHNICAL);
+  mxSetField(retver, 0, COPTMEX_VERSION_TECHNICAL, coptver.technical);
+
+  *out_version = retver;
+
+exit_cleanup:
+  if (retcode != COPT_RETCODE_OK)
+  {
+    *out_version = NULL;
+  }
+
+  return retcode;
+}
+
+/* Extract objective sense */
+int COPTMEX_getObjsen(const mxArray* in_objsen, int* out_objsen)
+{
+  int retcode = COPT_RETCODE_OK;
+  char* objsen = NULL;
+
+  COPTMEX_CALL(COPTMEX_getString(in_objsen, &objsen));
+  *out_objsen = COPTMEX_objsenStr2Int(objsen);
+
+exit_cleanup:
+  COPTMEX_freeString(&objsen);
+  return retcode;
+}
+
+/* Extract LP solution */
+static int COPTMEX_getLpResult(copt_prob* prob, int nFieldMask, mxArray** out_lpresult)
+{
+  int retcode = COPT_RETCODE_OK;
+  mxArray* lpResult = NULL;
+  coptmex_clpsol csol;
+  coptmex_mlpsol msol;
+
+  COPTMEX_initCLpSol(&csol);
+  COPTMEX_initMLpSol(&msol);
+
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ROWS, &csol.nRow));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &csol.nCol));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_PSDCOLS, &csol.nPSD));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, "PSDLens", &csol.nPSDLen));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_PSDCONSTRS, &csol.nPSDConstr));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_QCONSTRS, &csol.nQConstr));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_LPSTATUS, &csol.nStatus));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_HASBASIS, &csol.hasBasis));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_HASLPSOL, &csol.hasLpSol));
+
+  if (!(nFieldMask & (COPTMEX_FIELD_VARBASIS | COPTMEX_FIELD_CONBASIS)))
+  {
+    csol.hasBasis = 0;
+  }
+
+  msol.status = mxCreateString(COPTMEX_statusInt2Str(csol.nStatus));
+  msol.simplexiter = mxCreateDoubleMatrix(1, 1, mxREAL);
+  msol.barrieriter = mxCreateDoubleMatrix(1, 1, mxREAL);
+  msol.solvingtime = mxCreateDoubleMatrix(1, 1, mxREAL);
+  if (!msol.status || !msol.simplexiter || !msol.barrieriter || !msol.solvingtime)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  if (csol.hasLpSol)
+  {
+    msol.objval = mxCreateDoubleMatrix(1, 1, mxREAL);
+    if (!msol.objval)
+    {
+      retcode = COPT_RETCODE_MEMORY;
       goto exit_cleanup;
     }
 
-    csol.colValue = mxGetDoubles(msol.value);
-    csol.colDual = mxGetDoubles(msol.redcost);
-    csol.rowSlack = mxGetDoubles(msol.slack);
-    csol.rowDual = mxGetDoubles(msol.dual);
+    // Solution vectors left out by ResultFields parameter are not built
+    if (nFieldMask & COPTMEX_FIELD_VALUE)
+    {
+      msol.value = mxCreateDoubleMatrix(csol.nCol, 1, mxREAL);
+      if (!msol.value)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+      csol.colValue = mxGetDoubles(msol.value);
+    }
+    if (nFieldMask & COPTMEX_FIELD_REDCOST)
+    {
+      msol.redcost = mxCreateDoubleMatrix(csol.nCol, 1, mxREAL);
+      if (!msol.redcost)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+      csol.colDual = mxGetDoubles(msol.redcost);
+    }
+    if (nFieldMask & COPTMEX_FIELD_SLACK)
+    {
+      msol.slack = mxCreateDoubleMatrix(csol.nRow, 1, mxREAL);
+      if (!msol.slack)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+      csol.rowSlack = mxGetDoubles(msol.slack);
+    }
+    if (nFieldMask & COPTMEX_FIELD_DUAL)
+    {
+      msol.dual = mxCreateDoubleMatrix(csol.nRow, 1, mxREAL);
+      if (!msol.dual)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+      csol.rowDual = mxGetDoubles(msol.dual);
+    }
 
     if (csol.nQConstr > 0)
     {
@@ -557,16 +1221,23 @@ static int COPTMEX_getLpResult(copt_prob* prob, mxArray** out_lpresult)
 
   if (csol.hasBasis)
   {
-    msol.varbasis = mxCreateDoubleMatrix(csol.nCol, 1, mxREAL);
-    msol.constrbasis = mxCreateDoubleMatrix(csol.nRow, 1, mxREAL);
-    if (!msol.varbasis || !msol.constrbasis)
+    if (nFieldMask & COPTMEX_FIELD_VARBASIS)
+    {
+      msol.varbasis = mxCreateDoubleMatrix(csol.nCol, 1, mxREAL);
+    }
+    if (nFieldMask & COPTMEX_FIELD_CONBASIS)
+    {
+      msol.constrbasis = mxCreateDoubleMatrix(csol.nRow, 1, mxREAL);
+    }
+    if (((nFieldMask & COPTMEX_FIELD_VARBASIS) && !msol.varbasis) ||
+        ((nFieldMask & COPTMEX_FIELD_CONBASIS) && !msol.constrbasis))
     {
       retcode = COPT_RETCODE_MEMORY;
       goto exit_cleanup;
     }
 
-    csol.colBasis = (int*)mxCalloc(csol.nCol, sizeof(int));
-    csol.rowBasis = (int*)mxCalloc(csol.nRow, sizeof(int));
+    csol.colBasis = (int*)COPTMEX_alloc(csol.nCol, sizeof(int));
+    csol.rowBasis = (int*)COPTMEX_alloc(csol.nRow, sizeof(int));
     if (!csol.colBasis || !csol.rowBasis)
     {
       retcode = COPT_RETCODE_MEMORY;
@@ -625,15 +1296,21 @@ static int COPTMEX_getLpResult(copt_prob* prob, mxArray** out_lpresult)
 
   if (csol.hasBasis)
   {
-    double* colBasis_data = mxGetDoubles(msol.varbasis);
-    double* rowBasis_data = mxGetDoubles(msol.constrbasis);
-    for (int i = 0; i < csol.nCol; ++i)
+    if (msol.varbasis != NULL)
     {
-      colBasis_data[i] = csol.colBasis[i];
+      double* colBasis_data = mxGetDoubles(msol.varbasis);
+      for (int i = 0; i < csol.nCol; ++i)
+      {
+        colBasis_data[i] = csol.colBasis[i];
+      }
     }
-    for (int i = 0; i < csol.nRow; ++i)
+    if (msol.constrbasis != NULL)
     {
-      rowBasis_data[i] = csol.rowBasis[i];
+      double* rowBasis_data = mxGetDoubles(msol.constrbasis);
+      for (int i = 0; i < csol.nRow; ++i)
+      {
+        rowBasis_data[i] = csol.rowBasis[i];
+      }
     }
 
     mxFree(csol.colBasis);
@@ -666,17 +1343,29 @@ static int COPTMEX_getLpResult(copt_prob* prob, mxArray** out_lpresult)
     mxAddField(lpResult, COPTMEX_RESULT_OBJVAL);
     mxSetField(lpResult, 0, COPTMEX_RESULT_OBJVAL, msol.objval);
     // 'x'
-    mxAddField(lpResult, COPTMEX_RESULT_VALUE);
-    mxSetField(lpResult, 0, COPTMEX_RESULT_VALUE, msol.value);
+    if (msol.value != NULL)
+    {
+      mxAddField(lpResult, COPTMEX_RESULT_VALUE);
+      mxSetField(lpResult, 0, COPTMEX_RESULT_VALUE, msol.value);
+    }
     // 'rc'
-    mxAddField(lpResult, COPTMEX_RESULT_REDCOST);
-    mxSetField(lpResult, 0, COPTMEX_RESULT_REDCOST, msol.redcost);
+    if (msol.redcost != NULL)
+    {
+      mxAddField(lpResult, COPTMEX_RESULT_REDCOST);
+      mxSetField(lpResult, 0, COPTMEX_RESULT_REDCOST, msol.redcost);
+    }
     // 'slack;
-    mxAddField(lpResult, COPTMEX_RESULT_SLACK);
-    mxSetField(lpResult, 0, COPTMEX_RESULT_SLACK, msol.slack);
+    if (msol.slack != NULL)
+    {
+      mxAddField(lpResult, COPTMEX_RESULT_SLACK);
+      mxSetField(lpResult, 0, COPTMEX_RESULT_SLACK, msol.slack);
+    }
     // 'pi'
-    mxAddField(lpResult, COPTMEX_RESULT_DUAL);
-    mxSetField(lpResult, 0, COPTMEX_RESULT_DUAL, msol.dual);
+    if (msol.dual != NULL)
+    {
+      mxAddField(lpResult, COPTMEX_RESULT_DUAL);
+      mxSetField(lpResult, 0, COPTMEX_RESULT_DUAL, msol.dual);
+    }
 
     // 'qcslack'
     if (csol.nQConstr > 0)
@@ -722,12 +1411,15 @@ static int COPTMEX_getLpResult(copt_prob* prob, mxArray** out_lpresult)
     mxSetField(lpResult, 0, COPTMEX_RESULT_PRIMALRAY, msol.ray);
   }
 
-  if (csol.hasBasis)
+  // 'varbasis'
+  if (msol.varbasis != NULL)
   {
-    // 'varbasis'
     mxAddField(lpResult, COPTMEX_RESULT_VARBASIS);
     mxSetField(lpResult, 0, COPTMEX_RESULT_VARBASIS, msol.varbasis);
-    // 'constrbasis'
+  }
+  // 'constrbasis'
+  if (msol.constrbasis != NULL)
+  {
     mxAddField(lpResult, COPTMEX_RESULT_CONBASIS);
     mxSetField(lpResult, 0, COPTMEX_RESULT_CONBASIS, msol.constrbasis);
   }
@@ -744,7 +1436,7 @@ exit_cleanup:
 }
 
 /* Extract MIP solution */
-static int COPTMEX_getMipResult(copt_prob* prob, mxArray** out_mipresult)
+static int COPTMEX_getMipResult(copt_prob* prob, int nFieldMask, mxArray** out_mipresult)
 {
   int retcode = COPT_RETCODE_OK;
   mxArray* mipResult = NULL;
@@ -760,6 +1452,11 @@ static int COPTMEX_getMipResult(copt_prob* prob, mxArray** out_mipresult)
   COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_POOLSOLS, &csol.nSolPool));
   COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_MIPSTATUS, &csol.nStatus));
 
+  if (!(nFieldMask & COPTMEX_FIELD_POOL))
+  {
+    csol.nSolPool = 0;
+  }
+
   msol.status = mxCreateString(COPTMEX_statusInt2Str(csol.nStatus));
   msol.simplexiter = mxCreateDoubleMatrix(1, 1, mxREAL);
   msol.nodecnt = mxCreateDoubleMatrix(1, 1, mxREAL);
@@ -775,14 +1472,22 @@ static int COPTMEX_getMipResult(copt_prob* prob, mxArray** out_mipresult)
     msol.bestgap = mxCreateDoubleMatrix(1, 1, mxREAL);
     msol.objval = mxCreateDoubleMatrix(1, 1, mxREAL);
     msol.bestbnd = mxCreateDoubleMatrix(1, 1, mxREAL);
-    msol.value = mxCreateDoubleMatrix(csol.nCol, 1, mxREAL);
-    if (!msol.bestgap || !msol.objval || !msol.bestbnd || !msol.value)
+    if (!msol.bestgap || !msol.objval || !msol.bestbnd)
     {
       retcode = COPT_RETCODE_MEMORY;
       goto exit_cleanup;
     }
 
-    csol.colValue = mxGetDoubles(msol.value);
+    if (nFieldMask & COPTMEX_FIELD_VALUE)
+    {
+      msol.value = mxCreateDoubleMatrix(csol.nCol, 1, mxREAL);
+      if (!msol.value)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+      csol.colValue = mxGetDoubles(msol.value);
+    }
   }
 
   COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_SIMPLEXITER, &csol.nSimplexIter));
@@ -794,7 +1499,10 @@ static int COPTMEX_getMipResult(copt_prob* prob, mxArray** out_mipresult)
     COPTMEX_CALL(COPT_GetDblAttr(prob, COPT_DBLATTR_BESTGAP, &csol.dBestGap));
     COPTMEX_CALL(COPT_GetDblAttr(prob, COPT_DBLATTR_BESTOBJ, &csol.dObjVal));
     COPTMEX_CALL(COPT_GetDblAttr(prob, COPT_DBLATTR_BESTBND, &csol.dBestBnd));
-    COPTMEX_CALL(COPT_GetSolution(prob, csol.colValue));
+    if (csol.colValue != NULL)
+    {
+      COPTMEX_CALL(COPT_GetSolution(prob, csol.colValue));
+    }
   }
 
   if (csol.nSolPool > 0)
@@ -873,8 +1581,11 @@ static int COPTMEX_getMipResult(copt_prob* prob, mxArray** out_mipresult)
     mxAddField(mipResult, COPTMEX_RESULT_BESTBND);
     mxSetField(mipResult, 0, COPTMEX_RESULT_BESTBND, msol.bestbnd);
     // 'x'
-    mxAddField(mipResult, COPTMEX_RESULT_VALUE);
-    mxSetField(mipResult, 0, COPTMEX_RESULT_VALUE, msol.value);
+    if (msol.value != NULL)
+    {
+      mxAddField(mipResult, COPTMEX_RESULT_VALUE);
+      mxSetField(mipResult, 0, COPTMEX_RESULT_VALUE, msol.value);
+    }
   }
 
   if (csol.nSolPool > 0)
@@ -895,8 +1606,8 @@ exit_cleanup:
   return retcode;
 }
 
-/* Extract and save result */
-int COPTMEX_getResult(copt_prob* prob, mxArray** out_result)
+/* Extract and save result, leaving out the solution fields not in mask */
+static int COPTMEX_getResultFields(copt_prob* prob, int nFieldMask, mxArray** out_result)
 {
   int retcode = 0;
   int isMip = 0;
@@ -904,17 +1615,23 @@ int COPTMEX_getResult(copt_prob* prob, mxArray** out_result)
   COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ISMIP, &isMip));
   if (isMip)
   {
-    COPTMEX_CALL(COPTMEX_getMipResult(prob, out_result));
+    COPTMEX_CALL(COPTMEX_getMipResult(prob, nFieldMask, out_result));
   }
   else
   {
-    COPTMEX_CALL(COPTMEX_getLpResult(prob, out_result));
+    COPTMEX_CALL(COPTMEX_getLpResult(prob, nFieldMask, out_result));
   }
 
 exit_cleanup:
   return retcode;
 }
 
+/* Extract and save result */
+int COPTMEX_getResult(copt_prob* prob, mxArray** out_result)
+{
+  return COPTMEX_getResultFields(prob, COPTMEX_FIELD_ALL, out_result);
+}
+
 /* Extract model data */
 int COPTMEX_getModel(copt_prob* prob, int nfiles, const mxArray** in_files, mxArray** out_model)
 {
@@ -1684,33 +2401,137 @@ exit_cleanup:
   return retcode;
 }
 
-/* Load parameters to problem */
-int COPTMEX_setParam(copt_prob* prob, const mxArray* in_param)
+/* Check if parameter is handled by interface instead of COPT */
+static int COPTMEX_isMexParam(const char* parname)
 {
-  int retcode = 0;
-  char msgbuf[COPT_BUFFSIZE];
+  return mystrcmp(parname, COPTMEX_PARAM_LOGFILE) == 0 || mystrcmp(parname, COPTMEX_PARAM_RELAXFILE) == 0 ||
+         mystrcmp(parname, COPTMEX_PARAM_BATCHTHREADS) == 0 || mystrcmp(parname, COPTMEX_PARAM_TIMING) == 0 ||
+         mystrcmp(parname, COPTMEX_PARAM_PROGRESSFCN) == 0 || mystrcmp(parname, COPTMEX_PARAM_PROGRESSINTERVAL) == 0 ||
+         mystrcmp(parname, COPTMEX_PARAM_LAZYCONSTRFCN) == 0 || mystrcmp(parname, COPTMEX_PARAM_USERCUTFCN) == 0 ||
+         mystrcmp(parname, COPTMEX_PARAM_WRITESOL) == 0 || mystrcmp(parname, COPTMEX_PARAM_WRITEBASIS) == 0 ||
+         mystrcmp(parname, COPTMEX_PARAM_WRITEMIPSTART) == 0 || mystrcmp(parname, COPTMEX_PARAM_RESULTFIELDS) == 0 ||
+         mystrcmp(parname, COPTMEX_PARAM_RESIDUALS) == 0;
+}
+
+/* Extract interface parameter by case-insensitive name, or NULL if absent */
+static mxArray* COPTMEX_getMexParam(const mxArray* in_param, const char* name)
+{
+  if (in_param == NULL)
+  {
+    return NULL;
+  }
 
-  int islogging = 0;
-  char* logfilename = NULL;
-  mxArray* logging = NULL;
-  mxArray* logname = NULL;
   for (int i = 0; i < mxGetNumberOfFields(in_param); ++i)
   {
-    const char* loggingname = mxGetFieldNameByNumber(in_param, i);
-    if (mystrcmp(loggingname, "LogFile") == 0)
+    const char* parname = mxGetFieldNameByNumber(in_param, i);
+    if (mystrcmp(parname, name) == 0)
     {
-      logname = mxGetField(in_param, 0, loggingname);
-      if (!mxIsChar(logname))
-      {
-        snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", loggingname);
-        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
-        goto exit_cleanup;
-      }
-
-      COPTMEX_freeString(&logfilename);
-      COPTMEX_CALL(COPTMEX_getString(logname, &logfilename));
+      return mxGetField(in_param, 0, parname);
     }
-    if (mystrcmp(loggingname, COPT_INTPARAM_LOGGING) == 0)
+  }
+
+  return NULL;
+}
+
+/* Apply precompiled parameter handle without name lookups */
+static int COPTMEX_applyParam(copt_prob* prob, const mxArray* in_handle)
+{
+  int retcode = 0;
+  size_t nbytes = mxGetNumberOfElements(in_handle);
+  const char* data = (const char*) mxGetData(in_handle);
+  const coptmex_paramhead* head = NULL;
+  const coptmex_paramrec* recs = NULL;
+  const char* logfilename = NULL;
+
+  if (nbytes < sizeof(coptmex_paramhead) || memcmp(data, COPTMEX_PARAM_MAGIC, sizeof(head->magic)) != 0)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, "parameter");
+    goto exit_cleanup;
+  }
+
+  head = (const coptmex_paramhead*) data;
+  if (head->nParam < 0 || head->nLogFileLen < 0 ||
+      nbytes != sizeof(coptmex_paramhead) + head->nParam * sizeof(coptmex_paramrec) + head->nLogFileLen)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, "parameter");
+    goto exit_cleanup;
+  }
+
+  recs = (const coptmex_paramrec*) (data + sizeof(coptmex_paramhead));
+  if (head->nLogFileLen > 0)
+  {
+    logfilename = (const char*) (recs + head->nParam);
+    if (logfilename[head->nLogFileLen - 1] != '\0')
+    {
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, "parameter");
+      goto exit_cleanup;
+    }
+  }
+
+  if (head->nLogging == 1)
+  {
+    COPTMEX_CALL(COPTMEX_dispBanner());
+
+    COPTMEX_CALL(COPT_SetLogCallback(prob, COPTMEX_printLog, NULL));
+  }
+
+  if (head->nLogging >= 0)
+  {
+    COPTMEX_CALL(COPT_SetIntParam(prob, COPT_INTPARAM_LOGGING, head->nLogging));
+  }
+  if (logfilename != NULL)
+  {
+    COPTMEX_CALL(COPT_SetLogFile(prob, logfilename));
+  }
+
+  for (int i = 0; i < head->nParam; ++i)
+  {
+    if (recs[i].type == 0)
+    {
+      COPTMEX_CALL(COPT_SetDblParam(prob, recs[i].name, recs[i].dblval));
+    }
+    else
+    {
+      COPTMEX_CALL(COPT_SetIntParam(prob, recs[i].name, recs[i].intval));
+    }
+  }
+
+exit_cleanup:
+  return retcode;
+}
+
+/* Load parameters to problem */
+int COPTMEX_setParam(copt_prob* prob, const mxArray* in_param)
+{
+  int retcode = 0;
+  char msgbuf[COPT_BUFFSIZE];
+
+  if (mxIsUint8(in_param))
+  {
+    return COPTMEX_applyParam(prob, in_param);
+  }
+
+  int islogging = 0;
+  char* logfilename = NULL;
+  mxArray* logging = NULL;
+  mxArray* logname = NULL;
+  for (int i = 0; i < mxGetNumberOfFields(in_param); ++i)
+  {
+    const char* loggingname = mxGetFieldNameByNumber(in_param, i);
+    if (mystrcmp(loggingname, COPTMEX_PARAM_LOGFILE) == 0)
+    {
+      logname = mxGetField(in_param, 0, loggingname);
+      if (!mxIsChar(logname))
+      {
+        snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", loggingname);
+        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+        goto exit_cleanup;
+      }
+
+      COPTMEX_freeString(&logfilename);
+      COPTMEX_CALL(COPTMEX_getString(logname, &logfilename));
+    }
+    if (mystrcmp(loggingname, COPT_INTPARAM_LOGGING) == 0)
     {
       logging = mxGetField(in_param, 0, loggingname);
       if (!mxIsScalar(logging) || mxIsChar(logging))
@@ -1746,7 +2567,7 @@ int COPTMEX_setParam(copt_prob* prob, const mxArray* in_param)
     const char* parname = mxGetFieldNameByNumber(in_param, i);
     mxArray* pararray = mxGetField(in_param, 0, parname);
 
-    if (mystrcmp(parname, "LogFile") == 0)
+    if (COPTMEX_isMexParam(parname))
     {
       continue;
     }
@@ -1795,681 +2616,3746 @@ exit_cleanup:
   return retcode;
 }
 
-static char* COPTMEX_getFileExt(const char* filename)
+int COPTMEX_compileParam(copt_prob* prob, const mxArray* in_param, mxArray** out_handle)
 {
-  char* tmpfilename = NULL;
-  char* lastdot = NULL;
-  int lenfile = strlen(filename);
+  int retcode = 0;
+  char msgbuf[COPT_BUFFSIZE];
+  int nfield = mxGetNumberOfFields(in_param);
+  coptmex_paramhead head;
+  coptmex_paramrec* recs = NULL;
+  char* logfilename = NULL;
+  char* data = NULL;
+  size_t nbytes = 0;
 
-  tmpfilename = (char*)mxCalloc(lenfile + 1, sizeof(char));
-  memcpy(tmpfilename, filename, lenfile + 1);
+  memset(&head, 0, sizeof(coptmex_paramhead));
+  memcpy(head.magic, COPTMEX_PARAM_MAGIC, sizeof(head.magic));
+  head.nLogging = -1;
 
-  lastdot = strrchr(tmpfilename, '.');
-  if (!lastdot || lastdot == tmpfilename)
+  if (nfield > 0)
   {
-    return "";
+    recs = (coptmex_paramrec*) mxCalloc(nfield, sizeof(coptmex_paramrec));
+    if (!recs)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
   }
 
-  if (lastdot != NULL)
+  for (int i = 0; i < nfield; ++i)
   {
-    if (strcmp(lastdot, ".gz") == 0)
-    {
-      *lastdot = '\0';
+    int partype = -1;
+    const char* parname = mxGetFieldNameByNumber(in_param, i);
+    mxArray* pararray = mxGetField(in_param, 0, parname);
+    coptmex_paramrec* rec = recs + head.nParam;
 
-      lastdot = strrchr(tmpfilename, '.');
-      if (!lastdot || lastdot == tmpfilename)
+    if (mystrcmp(parname, COPTMEX_PARAM_LOGFILE) == 0)
+    {
+      if (!mxIsChar(pararray))
       {
-        return "";
+        snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", parname);
+        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+        goto exit_cleanup;
       }
-    }
-  }
 
-  return lastdot + 1;
-}
+      COPTMEX_freeString(&logfilename);
+      COPTMEX_CALL(COPTMEX_getString(pararray, &logfilename));
+      continue;
+    }
+    if (mystrcmp(parname, COPTMEX_PARAM_TIMING) == 0)
+    {
+      if (!mxIsScalar(pararray) || mxIsChar(pararray))
+      {
+        snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", parname);
+        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+        goto exit_cleanup;
+      }
 
-/* Read optional information from file */
-int COPTMEX_readInfo(copt_prob* prob, const mxArray* in_info)
-{
-  int retcode = 0;
-  char* filename = NULL;
-  char* fileext = NULL;
+      head.nTiming = (mxGetScalar(pararray) != 0.0 ? 1 : 0);
+      continue;
+    }
+    // Other interface parameters act on a single call and can not be kept in handle
+    if (COPTMEX_isMexParam(parname))
+    {
+      snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", parname);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NAME, msgbuf);
+      goto exit_cleanup;
+    }
+    if (mystrcmp(parname, COPT_INTPARAM_LOGGING) == 0)
+    {
+      if (!mxIsScalar(pararray) || mxIsChar(pararray))
+      {
+        snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", parname);
+        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+        goto exit_cleanup;
+      }
 
-  COPTMEX_CALL(COPTMEX_getString(in_info, &filename));
+      head.nLogging = ((int) mxGetScalar(pararray) == 1 ? 1 : 0);
+      continue;
+    }
 
-  fileext = COPTMEX_getFileExt(filename);
-  if (strcmp(fileext, "bas") == 0)
-  {
-    COPTMEX_CALL(COPT_ReadBasis(prob, filename));
-  }
-  else
-  {
-    retcode = COPT_RETCODE_INVALID;
-  }
+    if (strlen(parname) >= COPTMEX_PARAM_NAMELEN)
+    {
+      snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", parname);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NAME, msgbuf);
+      goto exit_cleanup;
+    }
 
-exit_cleanup:
-  COPTMEX_freeString(&filename);
-  return retcode;
-}
+    COPTMEX_CALL(COPT_SearchParamAttr(prob, parname, &partype));
+    if (partype != 0 && partype != 1)
+    {
+      snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", parname);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NAME, msgbuf);
+      goto exit_cleanup;
+    }
 
-/* Read model from file */
-int COPTMEX_readModel(copt_prob* prob, const mxArray* in_model)
-{
-  int retcode = 0;
-  char* filename = NULL;
-  char* fileext = NULL;
+    if (!mxIsScalar(pararray) || mxIsChar(pararray))
+    {
+      snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", parname);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+      goto exit_cleanup;
+    }
 
-  COPTMEX_CALL(COPTMEX_getString(in_model, &filename));
+    // Parameters at their default values need not be applied
+    if (partype == 0)
+    {
+      double dDefVal = 0.0;
+      COPTMEX_CALL(COPT_GetDblParamDef(prob, parname, &dDefVal));
+      if (dDefVal == mxGetScalar(pararray))
+      {
+        continue;
+      }
+      rec->dblval = mxGetScalar(pararray);
+    }
+    else
+    {
+      int nDefVal = 0;
+      COPTMEX_CALL(COPT_GetIntParamDef(prob, parname, &nDefVal));
+      if (nDefVal == (int) mxGetScalar(pararray))
+      {
+        continue;
+      }
+      rec->intval = (int) mxGetScalar(pararray);
+    }
 
-  fileext = COPTMEX_getFileExt(filename);
-  if (strcmp(fileext, "mps") == 0)
-  {
-    COPTMEX_CALL(COPT_ReadMps(prob, filename));
+    rec->type = partype;
+    strcpy(rec->name, parname);
+    head.nParam++;
   }
-  else if (strcmp(fileext, "lp") == 0)
+
+  if (logfilename != NULL)
   {
-    COPTMEX_CALL(COPT_ReadLp(prob, filename));
+    head.nLogFileLen = (int) strlen(logfilename) + 1;
   }
-  else if (strcmp(fileext, "bin") == 0)
+
+  nbytes = sizeof(coptmex_paramhead) + head.nParam * sizeof(coptmex_paramrec) + head.nLogFileLen;
+  *out_handle = mxCreateNumericMatrix(nbytes, 1, mxUINT8_CLASS, mxREAL);
+  if (!(*out_handle))
   {
-    COPTMEX_CALL(COPT_ReadBin(prob, filename));
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
   }
-  else if (strcmp(fileext, "dat-s") == 0)
+
+  data = (char*) mxGetData(*out_handle);
+  memcpy(data, &head, sizeof(coptmex_paramhead));
+  data += sizeof(coptmex_paramhead);
+  if (head.nParam > 0)
   {
-    COPTMEX_CALL(COPT_ReadSDPA(prob, filename));
+    memcpy(data, recs, head.nParam * sizeof(coptmex_paramrec));
+    data += head.nParam * sizeof(coptmex_paramrec);
   }
-  else if (strcmp(fileext, "cbf") == 0)
+  if (head.nLogFileLen > 0)
   {
-    COPTMEX_CALL(COPT_ReadCbf(prob, filename));
+    memcpy(data, logfilename, head.nLogFileLen);
   }
-  else
+
+exit_cleanup:
+  if (recs != NULL)
   {
-    retcode = COPT_RETCODE_INVALID;
+    mxFree(recs);
   }
+  COPTMEX_freeString(&logfilename);
 
-exit_cleanup:
-  COPTMEX_freeString(&filename);
   return retcode;
 }
 
-/* Write model to file */
-int COPTMEX_writeModel(copt_prob* prob, const mxArray* out_file)
-{
-  int retcode = 0;
-  char* filename = NULL;
-  char* fileext = NULL;
+/* The phase timer of solving, enabled by Timing parameter */
+static coptmex_timing COPTMEX_timing = {0};
 
-  COPTMEX_CALL(COPTMEX_getString(out_file, &filename));
+static const char* COPTMEX_phaseNames[COPTMEX_NPHASE] = {
+  "param", "read", "check", "convert", "load", "solve", "extract"};
 
-  fileext = COPTMEX_getFileExt(filename);
-  if (strcmp(fileext, "mps") == 0)
+/* Bytes held by the data of MATLAB array and its elements */
+static double COPTMEX_getArrayBytes(const mxArray* arr)
+{
+  double nbytes = 0.0;
+
+  if (arr == NULL)
   {
-    COPTMEX_CALL(COPT_WriteMps(prob, filename));
+    return 0.0;
   }
-  else if (strcmp(fileext, "lp") == 0)
+
+  if (mxIsStruct(arr))
   {
-    COPTMEX_CALL(COPT_WriteLp(prob, filename));
+    for (size_t i = 0; i < mxGetNumberOfElements(arr); ++i)
+    {
+      for (int j = 0; j < mxGetNumberOfFields(arr); ++j)
+      {
+        nbytes += COPTMEX_getArrayBytes(mxGetFieldByNumber(arr, i, j));
+      }
+    }
   }
-  else if (strcmp(fileext, "bin") == 0)
+  else if (mxIsCell(arr))
   {
-    COPTMEX_CALL(COPT_WriteBin(prob, filename));
+    for (size_t i = 0; i < mxGetNumberOfElements(arr); ++i)
+    {
+      nbytes += COPTMEX_getArrayBytes(mxGetCell(arr, i));
+    }
   }
-  else if (strcmp(fileext, "cbf") == 0)
+  else if (mxIsSparse(arr))
   {
-    COPTMEX_CALL(COPT_WriteCbf(prob, filename));
+    nbytes += (double) mxGetNzmax(arr) * (mxGetElementSize(arr) + sizeof(mwIndex));
+    nbytes += (double) (mxGetN(arr) + 1) * sizeof(mwIndex);
   }
   else
   {
-    retcode = COPT_RETCODE_INVALID;
+    nbytes += (double) mxGetNumberOfElements(arr) * mxGetElementSize(arr);
   }
 
-exit_cleanup:
-  COPTMEX_freeString(&filename);
-  return retcode;
+  return nbytes;
 }
 
-/* Solve problem */
-int COPTMEX_solveModel(copt_prob* prob, const mxArray* in_model, int ifRead, mxArray** out_result, int ifRetResult)
+int COPTMEX_startTiming(const mxArray* in_param)
 {
   int retcode = 0;
+  int isEnabled = 0;
+  char msgbuf[COPT_BUFFSIZE];
 
-  // Extract and load data to problem
-  if (ifRead)
+  if (in_param != NULL && mxIsUint8(in_param))
   {
-    COPTMEX_CALL(COPTMEX_readModel(prob, in_model));
+    // Parameter handle is checked when applied
+    if (mxGetNumberOfElements(in_param) >= sizeof(coptmex_paramhead))
+    {
+      isEnabled = ((const coptmex_paramhead*) mxGetData(in_param))->nTiming;
+    }
   }
   else
   {
-    COPTMEX_CALL(COPTMEX_loadModel(prob, in_model));
-  }
+    mxArray* timing = COPTMEX_getMexParam(in_param, COPTMEX_PARAM_TIMING);
+    if (timing != NULL)
+    {
+      if (!mxIsScalar(timing) || mxIsChar(timing))
+      {
+        snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", COPTMEX_PARAM_TIMING);
+        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+        goto exit_cleanup;
+      }
 
-  // Set interrupt callback (for MIP only)
-  COPTMEX_CALL(COPT_SetCallback(prob, COPTMEX_interruptCallback, COPT_CBCONTEXT_MIPNODE, NULL));
+      isEnabled = (mxGetScalar(timing) != 0.0 ? 1 : 0);
+    }
+  }
 
-  // Solve the problem
-  COPTMEX_CALL(COPT_Solve(prob));
-
-  // Extract and save result
-  if (ifRetResult)
+  memset(&COPTMEX_timing, 0, sizeof(coptmex_timing));
+  COPTMEX_timing.isEnabled = isEnabled;
+  COPTMEX_timing.iPhase = -1;
+  if (isEnabled)
   {
-    COPTMEX_CALL(COPTMEX_getResult(prob, out_result));
+    COPTMEX_timing.dStart = COPTMEX_getWallTime();
   }
 
 exit_cleanup:
   return retcode;
 }
 
-/* Check if solve problem via cone data */
-int COPTMEX_isConeModel(const mxArray* in_model)
+void COPTMEX_switchPhase(int iPhase)
 {
-  int ifConeData = 0;
-  mxArray* conedata = NULL;
+  double dNow = 0.0;
 
-  conedata = mxGetField(in_model, 0, COPTMEX_MODEL_CONEDATA);
-  if (conedata != NULL)
+  if (!COPTMEX_timing.isEnabled)
   {
-    if (COPTMEX_checkConeModel(conedata))
-    {
-      ifConeData = 1;
-    }
+    return;
   }
 
-  return ifConeData;
+  dNow = COPTMEX_getWallTime();
+  if (COPTMEX_timing.iPhase >= 0)
+  {
+    COPTMEX_timing.phaseTime[COPTMEX_timing.iPhase] += dNow - COPTMEX_timing.dPhaseStart;
+    COPTMEX_timing.phaseBytes[COPTMEX_timing.iPhase] += (double) (COPTMEX_nAllocBytes - COPTMEX_timing.nPhaseBytes);
+  }
+
+  COPTMEX_timing.iPhase = iPhase;
+  COPTMEX_timing.dPhaseStart = dNow;
+  COPTMEX_timing.nPhaseBytes = COPTMEX_nAllocBytes;
 }
 
-/* Load problem with cone data */
-int COPTMEX_loadConeModel(copt_prob* prob, const mxArray* in_model, int* p_nRow, int** p_outMap)
+int COPTMEX_stopTiming(mxArray* out_result)
 {
   int retcode = 0;
-  coptmex_cconeprob cconeprob;
-  coptmex_mconeprob mconeprob;
-  mxArray* conedata = NULL;
-  int* outRowMap = NULL;
+  mxArray* timing = NULL;
+  mxArray* bytes = NULL;
 
-  COPTMEX_initCConeProb(&cconeprob);
-  COPTMEX_initMConeProb(&mconeprob);
+  if (!COPTMEX_timing.isEnabled || out_result == NULL)
+  {
+    return retcode;
+  }
 
-  conedata = mxGetField(in_model, 0, COPTMEX_MODEL_CONEDATA);
+  // Close the last phase, and count the arrays returned as extracted data
+  COPTMEX_switchPhase(-1);
+  COPTMEX_timing.phaseBytes[COPTMEX_PHASE_EXTRACT] += COPTMEX_getArrayBytes(out_result);
 
-  mconeprob.c = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_C);
-  mconeprob.A = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_A);
-  mconeprob.b = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_B);
+  timing = mxCreateStructMatrix(1, 1, COPTMEX_NPHASE, COPTMEX_phaseNames);
+  bytes = mxCreateStructMatrix(1, 1, COPTMEX_NPHASE, COPTMEX_phaseNames);
+  if (!timing || !bytes)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
 
-  mconeprob.K = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_K);
-  mconeprob.f = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_F);
-  mconeprob.l = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_L);
-  mconeprob.q = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_Q);
-  mconeprob.r = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_R);
-  mconeprob.ep = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_EP);
-  mconeprob.ed = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_ED);
-  mconeprob.s = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_S);
+  for (int i = 0; i < COPTMEX_NPHASE; ++i)
+  {
+    mxSetFieldByNumber(timing, 0, i, mxCreateDoubleScalar(COPTMEX_timing.phaseTime[i]));
+    mxSetFieldByNumber(bytes, 0, i, mxCreateDoubleScalar(COPTMEX_timing.phaseBytes[i]));
+  }
 
-  mconeprob.objsen = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_OBJSEN);
-  mconeprob.objcon = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_OBJCON);
-  mconeprob.vtype = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_VTYPE);
-  mconeprob.Q = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_Q);
+  mxAddField(timing, COPTMEX_TIMING_TOTAL);
+  mxSetField(timing, 0, COPTMEX_TIMING_TOTAL, mxCreateDoubleScalar(COPTMEX_getWallTime() - COPTMEX_timing.dStart));
+  mxAddField(timing, COPTMEX_TIMING_BYTES);
+  mxSetField(timing, 0, COPTMEX_TIMING_BYTES, bytes);
+  bytes = NULL;
 
-  // 'c'
-  if (mconeprob.c != NULL)
+  mxAddField(out_result, COPTMEX_RESULT_TIMING);
+  mxSetField(out_result, 0, COPTMEX_RESULT_TIMING, timing);
+  timing = NULL;
+
+exit_cleanup:
+  if (timing != NULL)
   {
-    cconeprob.colObj = mxGetDoubles(mconeprob.c);
+    mxDestroyArray(timing);
   }
-  // 'A'
-  if (mconeprob.A != NULL)
+  if (bytes != NULL)
   {
-    cconeprob.nRow = mxGetM(mconeprob.A);
-    cconeprob.nCol = mxGetN(mconeprob.A);
-    cconeprob.nElem = mxGetNzmax(mconeprob.A);
-    cconeprob.colMatBeg = (int*)mxCalloc(cconeprob.nCol + 1, sizeof(int));
-    cconeprob.colMatIdx = (int*)mxCalloc(cconeprob.nElem, sizeof(int));
-    if (!cconeprob.colMatBeg || !cconeprob.colMatIdx)
+    mxDestroyArray(bytes);
+  }
+
+  COPTMEX_timing.isEnabled = 0;
+  return retcode;
+}
+
+/* The progress recorder of MIP solving, reported to ProgressFcn if given by parameter */
+static coptmex_progress COPTMEX_progress = {0};
+
+int COPTMEX_startProgress(const mxArray* in_param)
+{
+  int retcode = 0;
+  char msgbuf[COPT_BUFFSIZE];
+  mxArray* func = NULL;
+  mxArray* interval = NULL;
+
+  memset(&COPTMEX_progress, 0, sizeof(coptmex_progress));
+  COPTMEX_progress.dInterval = COPTMEX_PROGRESS_INTERVAL;
+
+  // Function handles can not be held by precompiled parameter handle
+  if (in_param == NULL || mxIsUint8(in_param))
+  {
+    return retcode;
+  }
+
+  func = COPTMEX_getMexParam(in_param, COPTMEX_PARAM_PROGRESSFCN);
+  if (func != NULL)
+  {
+    if (!mxIsClass(func, "function_handle"))
     {
-      retcode = COPT_RETCODE_MEMORY;
+      snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", COPTMEX_PARAM_PROGRESSFCN);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
       goto exit_cleanup;
     }
+  }
 
-    mwIndex* colMatBeg_data = mxGetJc(mconeprob.A);
-    mwIndex* colMatIdx_data = mxGetIr(mconeprob.A);
-    for (int i = 0; i < cconeprob.nCol + 1; ++i)
-    {
-      cconeprob.colMatBeg[i] = (int)colMatBeg_data[i];
-    }
-    for (int i = 0; i < cconeprob.nElem; ++i)
+  interval = COPTMEX_getMexParam(in_param, COPTMEX_PARAM_PROGRESSINTERVAL);
+  if (interval != NULL)
+  {
+    if (!mxIsScalar(interval) || mxIsChar(interval) || mxGetScalar(interval) < 0.0)
     {
-      cconeprob.colMatIdx[i] = (int)colMatIdx_data[i];
+      snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", COPTMEX_PARAM_PROGRESSINTERVAL);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, msgbuf);
+      goto exit_cleanup;
     }
 
-    cconeprob.colMatElem = mxGetDoubles(mconeprob.A);
+    COPTMEX_progress.dInterval = mxGetScalar(interval);
   }
-  // 'b'
-  if (mconeprob.b != NULL)
+
+  COPTMEX_progress.func = func;
+
+exit_cleanup:
+  return retcode;
+}
+
+/* Pass progress events recorded since last call to ProgressFcn as one batch */
+static void COPTMEX_callProgress(double dNow)
+{
+  coptmex_progress* progress = &COPTMEX_progress;
+  const char* fieldnames[5] = {COPTMEX_PROGRESS_TIME, COPTMEX_PROGRESS_OBJVAL, COPTMEX_PROGRESS_BESTBND,
+                               COPTMEX_PROGRESS_NODECNT, COPTMEX_PROGRESS_X};
+  const double* eventdata[4] = {progress->eventTime, progress->eventObj, progress->eventBnd, progress->eventNode};
+  int nBatch = progress->nEvent - progress->nEventSent;
+  mxArray* info = NULL;
+  mxArray* rhs[2];
+
+  info = mxCreateStructMatrix(1, 1, 5, fieldnames);
+  if (!info)
   {
-    cconeprob.rowRhs = (double*)mxCalloc(cconeprob.nRow, sizeof(double));
+    return;
+  }
 
-    double* rowRhs = mxGetDoubles(mconeprob.b);
-    for (int i = 0; i < cconeprob.nRow; ++i)
+  for (int i = 0; i < 4; ++i)
+  {
+    mxArray* data = mxCreateDoubleMatrix(nBatch, 1, mxREAL);
+    if (data != NULL)
     {
-      if (mxIsInf(rowRhs[i]))
-      {
-        if (rowRhs[i] > 0)
-        {
-          cconeprob.rowRhs[i] = +COPT_INFINITY;
-        }
-        else
-        {
-          cconeprob.rowRhs[i] = -COPT_INFINITY;
-        }
-      }
-      else
-      {
-        cconeprob.rowRhs[i] = rowRhs[i];
-      }
+      memcpy(mxGetDoubles(data), eventdata[i] + progress->nEventSent, nBatch * sizeof(double));
     }
+    mxSetFieldByNumber(info, 0, i, data);
   }
 
-  // 'K'
-  if (mconeprob.K != NULL)
+  // Only the latest incumbent is passed, if any found since last call
+  if (progress->hasNewSol)
   {
-    // 'f'
-    if (mconeprob.f != NULL)
-    {
-      cconeprob.nFree = (int)mxGetScalar(mconeprob.f);
-    }
-    // 'l'
-    if (mconeprob.l != NULL)
+    mxArray* x = mxCreateDoubleMatrix(progress->nCol, 1, mxREAL);
+    if (x != NULL)
     {
-      cconeprob.nPositive = (int)mxGetScalar(mconeprob.l);
+      memcpy(mxGetDoubles(x), progress->colValue, progress->nCol * sizeof(double));
     }
-    // 'q'
-    if (mconeprob.q != NULL)
-    {
-      int nCone = mxGetNumberOfElements(mconeprob.q);
-      double* coneDim_data = mxGetDoubles(mconeprob.q);
-
-      if (nCone > 1 || (nCone == 1 && coneDim_data[0] > 0))
-      {
-        cconeprob.nCone = nCone;
-        cconeprob.coneDim = (int*)mxCalloc(cconeprob.nCone, sizeof(int));
+    mxSetFieldByNumber(info, 0, 4, x);
+  }
+  else
+  {
+    mxSetFieldByNumber(info, 0, 4, mxCreateDoubleMatrix(0, 0, mxREAL));
+  }
 
-        for (int i = 0; i < cconeprob.nCone; ++i)
-        {
-          cconeprob.coneDim[i] = (int)coneDim_data[i];
-        }
-      }
-    }
-    // 'r'
-    if (mconeprob.r != NULL)
-    {
-      int nRotateCone = mxGetNumberOfElements(mconeprob.r);
-      double* rotateConeDim_data = mxGetDoubles(mconeprob.r);
+  rhs[0] = (mxArray*) progress->func;
+  rhs[1] = info;
+  progress->except = mexCallMATLABWithTrap(0, NULL, 2, rhs, "feval");
+  mxDestroyArray(info);
 
-      if (nRotateCone > 1 || (nRotateCone == 1 && rotateConeDim_data[0] > 0))
-      {
-        cconeprob.nRotateCone = nRotateCone;
-        cconeprob.rotateConeDim = (int*)mxCalloc(cconeprob.nRotateCone, sizeof(int));
+  progress->nEventSent = progress->nEvent;
+  progress->hasNewSol = 0;
+  progress->dLastCall = dNow;
+}
 
-        for (int i = 0; i < cconeprob.nRotateCone; ++i)
-        {
-          cconeprob.rotateConeDim[i] = (int)rotateConeDim_data[i];
-        }
-      }
-    }
-    // 'ep'
-    if (mconeprob.ep != NULL)
-    {
-      int nPrimalExpCone = (int)mxGetScalar(mconeprob.ep);
-      cconeprob.nPrimalExpCone = nPrimalExpCone;
-    }
-    // 'ed'
-    if (mconeprob.ed != NULL)
-    {
-      int nDualExpCone = (int)mxGetScalar(mconeprob.ed);
-      cconeprob.nDualExpCone = nDualExpCone;
-    }
+/* Append progress event to timeline, growing it as needed */
+static void COPTMEX_addProgress(double dNow, double dNode)
+{
+  coptmex_progress* progress = &COPTMEX_progress;
+  int iEvent = progress->nEvent;
 
-    /* Number of scalar columns */
-    cconeprob.nScalarCol += cconeprob.nFree;
-    cconeprob.nScalarCol += cconeprob.nPositive;
-    for (int i = 0; i < cconeprob.nCone; ++i)
-    {
-      cconeprob.nScalarCol += cconeprob.coneDim[i];
-    }
-    for (int i = 0; i < cconeprob.nRotateCone; ++i)
-    {
-      cconeprob.nScalarCol += cconeprob.rotateConeDim[i];
-    }
-    cconeprob.nScalarCol += 3 * cconeprob.nPrimalExpCone;
-    cconeprob.nScalarCol += 3 * cconeprob.nDualExpCone;
+  if (iEvent == progress->nEventCap)
+  {
+    int nEventCap = COPTMEX_MAX(2 * progress->nEventCap, COPTMEX_PROGRESS_INITEVENT);
+    double** events[4] = {&progress->eventTime, &progress->eventObj, &progress->eventBnd, &progress->eventNode};
 
-    // 's'
-    if (mconeprob.s != NULL)
+    for (int i = 0; i < 4; ++i)
     {
-      int nPSD = mxGetNumberOfElements(mconeprob.s);
-      double* psdDim_data = mxGetDoubles(mconeprob.s);
-
-      if (nPSD > 1 || (nPSD == 1 && psdDim_data[0] > 0))
+      double* data = (double*) mxRealloc(*events[i], nEventCap * sizeof(double));
+      if (!data)
       {
-        cconeprob.nPSD = nPSD;
-        cconeprob.psdDim = (int*)mxCalloc(cconeprob.nPSD, sizeof(int));
-
-        for (int i = 0; i < cconeprob.nPSD; ++i)
-        {
-          cconeprob.psdDim[i] = (int)psdDim_data[i];
-        }
+        return;
       }
+      *events[i] = data;
     }
+    progress->nEventCap = nEventCap;
   }
 
-  // 'objsen'
-  if (mconeprob.objsen != NULL)
+  progress->eventTime[iEvent] = dNow - progress->dStart;
+  progress->eventObj[iEvent] = progress->dBestObj;
+  progress->eventBnd[iEvent] = progress->dBestBnd;
+  progress->eventNode[iEvent] = dNode;
+
+  // No incumbent or bound yet is reported as inf
+  if (progress->dBestObj >= COPT_INFINITY || progress->dBestObj <= -COPT_INFINITY)
   {
-    COPTMEX_CALL(COPTMEX_getObjsen(mconeprob.objsen, &cconeprob.nObjSense));
+    progress->eventObj[iEvent] = progress->dBestObj > 0.0 ? mxGetInf() : -mxGetInf();
   }
-  // 'objcon'
-  if (mconeprob.objcon != NULL)
+  if (progress->dBestBnd >= COPT_INFINITY || progress->dBestBnd <= -COPT_INFINITY)
   {
-    cconeprob.dObjConst = mxGetScalar(mconeprob.objcon);
+    progress->eventBnd[iEvent] = progress->dBestBnd > 0.0 ? mxGetInf() : -mxGetInf();
   }
-  // 'vtype'
-  if (mconeprob.vtype != NULL)
-  {
-    if (mxGetNumberOfElements(mconeprob.vtype) == cconeprob.nScalarCol)
-    {
-      COPTMEX_CALL(COPTMEX_getString(mconeprob.vtype, &cconeprob.colType));
-    }
-    else
-    {
-      char* vtype = NULL;
-      COPTMEX_CALL(COPTMEX_getString(mconeprob.vtype, &vtype));
 
-      cconeprob.colType = (char*)mxCalloc(cconeprob.nScalarCol + 1, sizeof(char));
-      if (!cconeprob.colType)
-      {
-        retcode = COPT_RETCODE_MEMORY;
-        goto exit_cleanup;
-      }
-      for (int i = 0; i < cconeprob.nScalarCol; ++i)
-      {
-        cconeprob.colType[i] = vtype[0];
-      }
-    }
-  }
-  // 'Q'
-  if (mconeprob.Q != NULL)
-  {
-    cconeprob.nQObjElem = mxGetNzmax(mconeprob.Q);
+  progress->nEvent = iEvent + 1;
+}
 
-    cconeprob.qObjRow = (int*)mxCalloc(cconeprob.nQObjElem, sizeof(int));
-    cconeprob.qObjCol = (int*)mxCalloc(cconeprob.nQObjElem, sizeof(int));
-    cconeprob.qObjElem = (double*)mxCalloc(cconeprob.nQObjElem, sizeof(double));
-    if (!cconeprob.qObjRow || !cconeprob.qObjCol || !cconeprob.qObjElem)
-    {
-      retcode = COPT_RETCODE_MEMORY;
-      goto exit_cleanup;
-    }
+/* The user callbacks adding rows to MIP solving, enabled by LazyConstraintFcn and UserCutFcn parameters */
+static coptmex_usercb COPTMEX_usercb = {0};
 
-    COPTMEX_csc2coo(mconeprob.Q, cconeprob.qObjRow, cconeprob.qObjCol, cconeprob.qObjElem);
+int COPTMEX_startUserCallback(const mxArray* in_param)
+{
+  int retcode = 0;
+  char msgbuf[COPT_BUFFSIZE];
+  const char* funcnames[2] = {COPTMEX_PARAM_LAZYCONSTRFCN, COPTMEX_PARAM_USERCUTFCN};
+  mxArray* funcs[2] = {NULL, NULL};
+
+  memset(&COPTMEX_usercb, 0, sizeof(coptmex_usercb));
+
+  // Function handles can not be held by precompiled parameter handle
+  if (in_param == NULL || mxIsUint8(in_param))
+  {
+    return retcode;
   }
 
-  if (p_outMap != NULL)
+  for (int i = 0; i < 2; ++i)
   {
-    outRowMap = (int*)mxCalloc(cconeprob.nRow, sizeof(int));
-    if (!outRowMap)
+    funcs[i] = COPTMEX_getMexParam(in_param, funcnames[i]);
+    if (funcs[i] != NULL && !mxIsClass(funcs[i], "function_handle"))
     {
-      retcode = COPT_RETCODE_MEMORY;
+      snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", funcnames[i]);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
       goto exit_cleanup;
     }
   }
 
-  // Load cone problem data
-  COPTMEX_CALL(COPT_LoadConeProb(prob, cconeprob.nCol, cconeprob.nRow, cconeprob.nFree, cconeprob.nPositive, 0,
-    cconeprob.nCone, cconeprob.nRotateCone, cconeprob.nPrimalExpCone, cconeprob.nDualExpCone, 0, 0, cconeprob.nPSD,
-    cconeprob.nQObjElem, cconeprob.nObjSense, cconeprob.dObjConst, cconeprob.colObj, cconeprob.qObjRow,
-    cconeprob.qObjCol, cconeprob.qObjElem, cconeprob.colMatBeg, NULL, cconeprob.colMatIdx, cconeprob.colMatElem,
-    cconeprob.rowRhs, NULL, NULL, cconeprob.coneDim, cconeprob.rotateConeDim, NULL, NULL, NULL, NULL, cconeprob.psdDim,
-    cconeprob.colType, NULL, NULL, NULL, outRowMap));
+  COPTMEX_usercb.lazyFunc = funcs[0];
+  COPTMEX_usercb.cutFunc = funcs[1];
 
-  if (p_nRow != NULL)
+exit_cleanup:
+  return retcode;
+}
+
+/* Grow buffers of rows returned by user callback, return nonzero if out of memory */
+static int COPTMEX_growUserRows(int nRow, int nElem)
+{
+  coptmex_usercb* usercb = &COPTMEX_usercb;
+
+  if (nRow > usercb->nRowCap)
   {
-    *p_nRow = cconeprob.nRow;
+    int nRowCap = COPTMEX_MAX(nRow, 2 * usercb->nRowCap);
+    int* rowBeg = (int*) mxRealloc(usercb->rowBeg, nRowCap * sizeof(int));
+    int* rowCnt = (int*) mxRealloc(usercb->rowCnt, nRowCap * sizeof(int));
+    char* rowSense = (char*) mxRealloc(usercb->rowSense, nRowCap + 1);
+    double* rowRhs = (double*) mxRealloc(usercb->rowRhs, nRowCap * sizeof(double));
+
+    usercb->rowBeg = rowBeg != NULL ? rowBeg : usercb->rowBeg;
+    usercb->rowCnt = rowCnt != NULL ? rowCnt : usercb->rowCnt;
+    usercb->rowSense = rowSense != NULL ? rowSense : usercb->rowSense;
+    usercb->rowRhs = rowRhs != NULL ? rowRhs : usercb->rowRhs;
+    if (!rowBeg || !rowCnt || !rowSense || !rowRhs)
+    {
+      return COPT_RETCODE_MEMORY;
+    }
+    usercb->nRowCap = nRowCap;
   }
-  if (p_outMap != NULL)
+
+  if (nElem > usercb->nElemCap)
   {
-    *p_outMap = outRowMap;
+    int nElemCap = COPTMEX_MAX(nElem, 2 * usercb->nElemCap);
+    int* rowIdx = (int*) mxRealloc(usercb->rowIdx, nElemCap * sizeof(int));
+    double* rowElem = (double*) mxRealloc(usercb->rowElem, nElemCap * sizeof(double));
+
+    usercb->rowIdx = rowIdx != NULL ? rowIdx : usercb->rowIdx;
+    usercb->rowElem = rowElem != NULL ? rowElem : usercb->rowElem;
+    if (!rowIdx || !rowElem)
+    {
+      return COPT_RETCODE_MEMORY;
+    }
+    usercb->nElemCap = nElemCap;
   }
 
-exit_cleanup:
-  if (cconeprob.qObjRow != NULL)
+  return COPT_RETCODE_OK;
+}
+
+/* Pass solution to user callback and add the rows it returns, return number of rows or -1 on failure */
+static int COPTMEX_addUserRows(void* cbdata, const char* cbinfo, const mxArray* func, const char* funcname, int isLazy)
+{
+  coptmex_usercb* usercb = &COPTMEX_usercb;
+  int nRow = 0;
+  int nCol = usercb->nCol;
+  mxArray* rhs[2];
+  mxArray* x = NULL;
+  mxArray* rows = NULL;
+  mxArray* rowmat = NULL;
+  mxArray* rowsense = NULL;
+  mxArray* rowrhs = NULL;
+
+  // Each call gets its own solution, which the user function may keep
+  x = mxCreateDoubleMatrix(nCol, 1, mxREAL);
+  if (!x)
   {
-    mxFree(cconeprob.qObjRow);
+    usercb->badFunc = funcname;
+    return -1;
   }
-  if (cconeprob.qObjCol != NULL)
+  COPT_GetCallbackInfo(cbdata, cbinfo, mxGetDoubles(x));
+
+  rhs[0] = (mxArray*) func;
+  rhs[1] = x;
+  usercb->except = mexCallMATLABWithTrap(1, &rows, 2, rhs, "feval");
+  mxDestroyArray(x);
+  if (usercb->except != NULL)
   {
-    mxFree(cconeprob.qObjCol);
+    return -1;
   }
-  if (cconeprob.qObjElem != NULL)
+
+  // Empty return means the solution is accepted as is
+  if (rows == NULL || mxIsEmpty(rows))
   {
-    mxFree(cconeprob.qObjElem);
+    goto exit_cleanup;
   }
 
-  if (cconeprob.coneDim != NULL)
+  if (mxIsStruct(rows))
   {
-    mxFree(cconeprob.coneDim);
+    rowmat = mxGetField(rows, 0, COPTMEX_MODEL_A);
+    rowsense = mxGetField(rows, 0, COPTMEX_MODEL_SENSE);
+    rowrhs = mxGetField(rows, 0, COPTMEX_MODEL_RHS);
   }
-  if (cconeprob.rotateConeDim != NULL)
+  if (rowmat == NULL || !mxIsSparse(rowmat) || (int) mxGetN(rowmat) != nCol || rowsense == NULL ||
+      !mxIsChar(rowsense) || rowrhs == NULL || !mxIsDouble(rowrhs) ||
+      mxGetNumberOfElements(rowsense) != mxGetM(rowmat) || mxGetNumberOfElements(rowrhs) != mxGetM(rowmat))
   {
-    mxFree(cconeprob.rotateConeDim);
+    usercb->badFunc = funcname;
+    nRow = -1;
+    goto exit_cleanup;
   }
-  if (cconeprob.psdDim != NULL)
+
+  nRow = (int) mxGetM(rowmat);
+  if (nRow == 0)
   {
-    mxFree(cconeprob.psdDim);
+    goto exit_cleanup;
   }
 
-  if (cconeprob.colMatBeg != NULL)
+  if (COPTMEX_growUserRows(nRow, (int) mxGetJc(rowmat)[nCol]) != COPT_RETCODE_OK)
   {
-    mxFree(cconeprob.colMatBeg);
+    usercb->badFunc = funcname;
+    nRow = -1;
+    goto exit_cleanup;
   }
-  if (cconeprob.colMatIdx != NULL)
+
+  COPTMEX_csc2csr(rowmat, usercb->rowBeg, usercb->rowCnt, usercb->rowIdx, usercb->rowElem);
+  mxGetString(rowsense, usercb->rowSense, nRow + 1);
+  memcpy(usercb->rowRhs, mxGetDoubles(rowrhs), nRow * sizeof(double));
+
+  for (int i = 0; i < nRow; ++i)
   {
-    mxFree(cconeprob.colMatIdx);
+    if (usercb->rowSense[i] != COPT_LESS_EQUAL && usercb->rowSense[i] != COPT_GREATER_EQUAL &&
+        usercb->rowSense[i] != COPT_EQUAL)
+    {
+      usercb->badFunc = funcname;
+      nRow = -1;
+      goto exit_cleanup;
+    }
   }
 
-  if (cconeprob.rowRhs != NULL)
+  if (isLazy)
   {
-    mxFree(cconeprob.rowRhs);
+    if (COPT_AddCallbackLazyConstrs(cbdata, nRow, usercb->rowBeg, usercb->rowCnt, usercb->rowIdx, usercb->rowElem,
+                                    usercb->rowSense, usercb->rowRhs) != COPT_RETCODE_OK)
+    {
+      usercb->badFunc = funcname;
+      nRow = -1;
+    }
   }
-  return retcode;
+  else
+  {
+    if (COPT_AddCallbackUserCuts(cbdata, nRow, usercb->rowBeg, usercb->rowCnt, usercb->rowIdx, usercb->rowElem,
+                                 usercb->rowSense, usercb->rowRhs) != COPT_RETCODE_OK)
+    {
+      usercb->badFunc = funcname;
+      nRow = -1;
+    }
+  }
+
+exit_cleanup:
+  if (rows != NULL)
+  {
+    mxDestroyArray(rows);
+  }
+  return nRow;
 }
 
-/* Solve cone problem with cone data */
-int COPTMEX_solveConeModel(copt_prob* prob, const mxArray* in_model, mxArray** out_result, int ifRetResult)
+static int COPT_CALL COPTMEX_solveCallback(copt_prob* prob, void* cbdata, int cbctx, void* usrdata)
 {
-  int retcode = 0;
-  int nRow = 0;
-  int* outRowMap = NULL;
-
-  // Extract and load problem data
-  COPTMEX_CALL(COPTMEX_loadConeModel(prob, in_model, &nRow, &outRowMap));
+  coptmex_progress* progress = &COPTMEX_progress;
+  coptmex_usercb* usercb = &COPTMEX_usercb;
+  int isUserOk = (usercb->except == NULL && usercb->badFunc == NULL);
+  double dBestObj = progress->dBestObj;
+  double dBestBnd = progress->dBestBnd;
+  double dNow = 0.0;
 
-  // Set interrupt callback (for MIP only)
-  COPTMEX_CALL(COPT_SetCallback(prob, COPTMEX_interruptCallback, COPT_CBCONTEXT_MIPNODE, NULL));
-
-  // Solve the problem
-  COPTMEX_CALL(COPT_Solve(prob));
+  if (cbctx == COPT_CBCONTEXT_MIPRELAX)
+  {
+    if (usercb->cutFunc != NULL && isUserOk)
+    {
+      if (COPTMEX_addUserRows(cbdata, COPT_CBINFO_RELAXSOLUTION, usercb->cutFunc, COPTMEX_PARAM_USERCUTFCN, 0) < 0)
+      {
+        COPT_Interrupt(prob);
+      }
+    }
+    return COPT_RETCODE_OK;
+  }
 
-  // Extract and save result
-  if (ifRetResult == 1)
+  if (cbctx == COPT_CBCONTEXT_MIPNODE)
   {
-    COPTMEX_CALL(COPTMEX_getResult(prob, out_result));
+    COPTMEX_interruptCallback(prob, cbdata, cbctx, usrdata);
+  }
 
-    if (*out_result != NULL)
+  if (cbctx == COPT_CBCONTEXT_MIPSOL)
+  {
+    // Candidate cut off by lazy constraints is not an incumbent
+    if (usercb->lazyFunc != NULL && isUserOk)
     {
-      mxArray* rowMap = mxCreateDoubleMatrix(nRow, 1, mxREAL);
-      if (rowMap == NULL)
+      int nRow = 0;
+      nRow = COPTMEX_addUserRows(cbdata, COPT_CBINFO_MIPCANDIDATE, usercb->lazyFunc, COPTMEX_PARAM_LAZYCONSTRFCN, 1);
+      if (nRow < 0)
       {
-        retcode = COPT_RETCODE_MEMORY;
-        goto exit_cleanup;
+        COPT_Interrupt(prob);
       }
-
-      double* rowMap_data = mxGetDoubles(rowMap);
-      for (int i = 0; i < nRow; ++i)
+      if (nRow != 0)
       {
-        rowMap_data[i] = outRowMap[i];
+        return COPT_RETCODE_OK;
       }
+    }
 
-      mxAddField(*out_result, "rowmap");
-      mxSetField(*out_result, 0, "rowmap", rowMap);
+    COPT_GetCallbackInfo(cbdata, COPT_CBINFO_MIPCANDOBJ, &dBestObj);
+    COPT_GetCallbackInfo(cbdata, COPT_CBINFO_BESTBND, &dBestBnd);
+    if (progress->colValue != NULL)
+    {
+      COPT_GetCallbackInfo(cbdata, COPT_CBINFO_MIPCANDIDATE, progress->colValue);
+      progress->hasNewSol = 1;
     }
   }
+  else
+  {
+    progress->nNode++;
+    COPT_GetCallbackInfo(cbdata, COPT_CBINFO_BESTOBJ, &dBestObj);
+    COPT_GetCallbackInfo(cbdata, COPT_CBINFO_BESTBND, &dBestBnd);
+  }
 
-exit_cleanup:
-  if (outRowMap != NULL)
+  // Nodes not moving any bound are not worth an event
+  dNow = COPTMEX_getWallTime();
+  if (cbctx == COPT_CBCONTEXT_MIPSOL || dBestObj != progress->dBestObj || dBestBnd != progress->dBestBnd)
   {
-    mxFree(outRowMap);
+    progress->dBestObj = dBestObj;
+    progress->dBestBnd = dBestBnd;
+    COPTMEX_addProgress(dNow, (double) progress->nNode);
   }
-  return retcode;
+
+  if (progress->func != NULL && progress->except == NULL && progress->nEvent > progress->nEventSent &&
+      dNow - progress->dLastCall >= progress->dInterval)
+  {
+    COPTMEX_callProgress(dNow);
+    if (progress->except != NULL)
+    {
+      COPT_Interrupt(prob);
+    }
+  }
+
+  return COPT_RETCODE_OK;
 }
 
-/* Extract and load data to problem */
-int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
+/* Set callback of solving, which checks interruption, records progress and calls user callbacks */
+static int COPTMEX_setCallback(copt_prob* prob)
 {
   int retcode = 0;
-  coptmex_cprob cprob;
-  coptmex_mprob mprob;
+  int cbctx = COPT_CBCONTEXT_MIPNODE | COPT_CBCONTEXT_MIPSOL;
+  coptmex_progress* progress = &COPTMEX_progress;
+  coptmex_usercb* usercb = &COPTMEX_usercb;
 
-  COPTMEX_initCProb(&cprob);
-  COPTMEX_initMProb(&mprob);
+  // Incumbents are only copied for ProgressFcn
+  if (progress->func != NULL)
+  {
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &progress->nCol));
+    if (progress->nCol > 0)
+    {
+      progress->colValue = (double*) mxCalloc(progress->nCol, sizeof(double));
+      if (!progress->colValue)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+    }
+  }
 
-  mprob.objsen = mxGetField(in_model, 0, COPTMEX_MODEL_OBJSEN);
-  mprob.objcon = mxGetField(in_model, 0, COPTMEX_MODEL_OBJCON);
-  mprob.A = mxGetField(in_model, 0, COPTMEX_MODEL_A);
-  mprob.obj = mxGetField(in_model, 0, COPTMEX_MODEL_OBJ);
-  mprob.lb = mxGetField(in_model, 0, COPTMEX_MODEL_LB);
-  mprob.ub = mxGetField(in_model, 0, COPTMEX_MODEL_UB);
-  mprob.vtype = mxGetField(in_model, 0, COPTMEX_MODEL_VTYPE);
-  mprob.varnames = mxGetField(in_model, 0, COPTMEX_MODEL_VARNAME);
-  mprob.sense = mxGetField(in_model, 0, COPTMEX_MODEL_SENSE);
-  mprob.lhs = mxGetField(in_model, 0, COPTMEX_MODEL_LHS);
-  mprob.rhs = mxGetField(in_model, 0, COPTMEX_MODEL_RHS);
-  mprob.constrnames = mxGetField(in_model, 0, COPTMEX_MODEL_CONNAME);
+  if (usercb->lazyFunc != NULL || usercb->cutFunc != NULL)
+  {
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &usercb->nCol));
+  }
+  if (usercb->cutFunc != NULL)
+  {
+    cbctx |= COPT_CBCONTEXT_MIPRELAX;
+  }
 
-  mprob.sos = mxGetField(in_model, 0, COPTMEX_MODEL_SOS);
-  mprob.indicator = mxGetField(in_model, 0, COPTMEX_MODEL_INDICATOR);
+  progress->dBestObj = COPT_INFINITY;
+  progress->dBestBnd = -COPT_INFINITY;
+  progress->dStart = COPTMEX_getWallTime();
+  progress->dLastCall = progress->dStart;
 
-  mprob.cone = mxGetField(in_model, 0, COPTMEX_MODEL_CONE);
-  mprob.expcone = mxGetField(in_model, 0, COPTMEX_MODEL_EXPCONE);
-  mprob.affcone = mxGetField(in_model, 0, COPTMEX_MODEL_AFFCONE);
+  COPTMEX_CALL(COPT_SetCallback(prob, COPTMEX_solveCallback, cbctx, NULL));
 
-  mprob.qobj = mxGetField(in_model, 0, COPTMEX_MODEL_QUADOBJ);
-  mprob.quadcon = mxGetField(in_model, 0, COPTMEX_MODEL_QUADCON);
+exit_cleanup:
+  return retcode;
+}
 
-  mprob.varbasis = mxGetField(in_model, 0, COPTMEX_RESULT_VARBASIS);
-  mprob.constrbasis = mxGetField(in_model, 0, COPTMEX_RESULT_CONBASIS);
+/* Close timeline with the final bounds and node count of MIP solving */
+static int COPTMEX_endProgress(copt_prob* prob)
+{
+  int retcode = 0;
+  int nNodeCnt = 0;
+  coptmex_progress* progress = &COPTMEX_progress;
 
-  mprob.value = mxGetField(in_model, 0, COPTMEX_RESULT_VALUE);
-  mprob.slack = mxGetField(in_model, 0, COPTMEX_RESULT_SLACK);
-  mprob.dual = mxGetField(in_model, 0, COPTMEX_RESULT_DUAL);
-  mprob.redcost = mxGetField(in_model, 0, COPTMEX_RESULT_REDCOST);
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ISMIP, &progress->isMIP));
+  if (!progress->isMIP)
+  {
+    return retcode;
+  }
 
-  mprob.mipstart = mxGetField(in_model, 0, COPTMEX_ADVINFO_MIPSTART);
+  COPTMEX_CALL(COPT_GetDblAttr(prob, COPT_DBLATTR_BESTOBJ, &progress->dBestObj));
+  COPTMEX_CALL(COPT_GetDblAttr(prob, COPT_DBLATTR_BESTBND, &progress->dBestBnd));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_NODECNT, &nNodeCnt));
 
-  if (COPTMEX_checkModel(&mprob) == 0)
+  progress->dEnd = COPTMEX_getWallTime();
+  COPTMEX_addProgress(progress->dEnd, (double) nNodeCnt);
+
+exit_cleanup:
+  return retcode;
+}
+
+int COPTMEX_stopUserCallback(mxArray** p_except)
+{
+  int retcode = 0;
+  coptmex_usercb* usercb = &COPTMEX_usercb;
+  mxArray* except = usercb->except;
+  const char* badFunc = usercb->badFunc;
+  char msgbuf[COPT_BUFFSIZE];
+
+  if (usercb->rowBeg != NULL)
   {
-    goto exit_cleanup;
+    mxFree(usercb->rowBeg);
   }
-
-  // 'objsen'
-  if (mprob.objsen != NULL)
+  if (usercb->rowCnt != NULL)
   {
-    COPTMEX_CALL(COPTMEX_getObjsen(mprob.objsen, &cprob.nObjSen));
+    mxFree(usercb->rowCnt);
   }
-  // 'objcon'
-  if (mprob.objcon != NULL)
+  if (usercb->rowSense != NULL)
   {
-    cprob.dObjConst = mxGetScalar(mprob.objcon);
+    mxFree(usercb->rowSense);
   }
-  // 'A'
-  if (mprob.A != NULL)
+  if (usercb->rowRhs != NULL)
   {
-    cprob.nRow = mxGetM(mprob.A);
-    cprob.nCol = mxGetN(mprob.A);
-    cprob.nElem = mxGetNzmax(mprob.A);
-    cprob.colMatBeg = (int*)mxCalloc(cprob.nCol + 1, sizeof(int));
-    cprob.colMatIdx = (int*)mxCalloc(cprob.nElem, sizeof(int));
-    if (!cprob.colMatBeg || !cprob.colMatIdx)
-    {
-      retcode = COPT_RETCODE_MEMORY;
-      goto exit_cleanup;
-    }
-
-    mwIndex* colMatBeg_data = mxGetJc(mprob.A);
-    mwIndex* colMatIdx_data = mxGetIr(mprob.A);
-    for (int i = 0; i < cprob.nCol + 1; ++i)
-    {
-      cprob.colMatBeg[i] = (int)colMatBeg_data[i];
-    }
-    for (int i = 0; i < cprob.nElem; ++i)
-    {
-      cprob.colMatIdx[i] = (int)colMatIdx_data[i];
-    }
-
-    cprob.colMatElem = mxGetDoubles(mprob.A);
+    mxFree(usercb->rowRhs);
   }
-  // 'obj'
-  if (mprob.obj != NULL)
+  if (usercb->rowIdx != NULL)
   {
-    cprob.colCost = mxGetDoubles(mprob.obj);
+    mxFree(usercb->rowIdx);
   }
-  // 'lb'
-  if (mprob.lb != NULL)
+  if (usercb->rowElem != NULL)
   {
-    cprob.colLower = (double*)mxCalloc(cprob.nCol, sizeof(double));
+    mxFree(usercb->rowElem);
+  }
+  memset(usercb, 0, sizeof(coptmex_usercb));
 
-    double* colLower = mxGetDoubles(mprob.lb);
-    for (int i = 0; i < cprob.nCol; ++i)
-    {
-      if (mxIsInf(colLower[i]))
-      {
-        if (colLower[i] > 0)
-        {
-          cprob.colLower[i] = +COPT_INFINITY;
-        }
-        else
-        {
-          cprob.colLower[i] = -COPT_INFINITY;
-        }
-      }
-      else
-      {
-        cprob.colLower[i] = colLower[i];
-      }
-    }
+  // Errors are handed over to caller, to be raised once problem is cleaned up
+  if (except == NULL && badFunc != NULL)
+  {
+    snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", badFunc);
+    except = COPTMEX_createError(COPTMEX_ERROR_BAD_DATA, msgbuf);
   }
-  // 'ub'
-  if (mprob.ub != NULL)
+  if (except != NULL)
   {
-    cprob.colUpper = (double*)mxCalloc(cprob.nCol, sizeof(double));
+    *p_except = except;
+    retcode = COPTMEX_RETCODE_USERFUNC;
+  }
 
-    double* colUpper = mxGetDoubles(mprob.ub);
-    for (int i = 0; i < cprob.nCol; ++i)
-    {
-      if (mxIsInf(colUpper[i]))
-      {
-        if (colUpper[i] > 0)
-        {
-          cprob.colUpper[i] = +COPT_INFINITY;
-        }
-        else
-        {
-          cprob.colUpper[i] = -COPT_INFINITY;
-        }
-      }
-      else
-      {
-        cprob.colUpper[i] = colUpper[i];
-      }
-    }
+  return retcode;
+}
+
+/* Relative gap of value to reference, 1 if either is not finite or signs differ */
+static double COPTMEX_getRelGap(double value, double ref)
+{
+  double absval = value >= 0.0 ? value : -value;
+  double absref = ref >= 0.0 ? ref : -ref;
+  double absdiff = value >= ref ? value - ref : ref - value;
+
+  if (mxIsInf(value) || mxIsNaN(value) || mxIsInf(ref) || mxIsNaN(ref) || value * ref < 0.0)
+  {
+    return 1.0;
   }
-  // 'vtype'
+  if (absdiff == 0.0)
+  {
+    return 0.0;
+  }
+
+  return absdiff / COPTMEX_MAX(absval, absref);
+}
+
+/* Integral over time of relative gap of piecewise constant values, which are unknown before first event */
+static double COPTMEX_getGapIntegral(const double* time, const double* value, int nEvent, double ref)
+{
+  double integral = 0.0;
+
+  if (nEvent == 0)
+  {
+    return 0.0;
+  }
+
+  integral = time[0];
+  for (int k = 0; k + 1 < nEvent; ++k)
+  {
+    integral += COPTMEX_getRelGap(value[k], ref) * (time[k + 1] - time[k]);
+  }
+
+  return integral;
+}
+
+/* Add timeline of events and integrals of primal and dual gaps to result */
+static int COPTMEX_getTimeline(mxArray* out_result)
+{
+  int retcode = 0;
+  coptmex_progress* progress = &COPTMEX_progress;
+  const double* eventdata[4] = {progress->eventTime, progress->eventObj, progress->eventBnd, progress->eventNode};
+  int nEvent = progress->nEvent;
+  double dRef = 0.0;
+  mxArray* timeline = NULL;
+
+  timeline = mxCreateDoubleMatrix(nEvent, 4, mxREAL);
+  if (!timeline)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  for (int i = 0; i < 4 && nEvent > 0; ++i)
+  {
+    memcpy(mxGetDoubles(timeline) + i * nEvent, eventdata[i], nEvent * sizeof(double));
+  }
+
+  mxAddField(out_result, COPTMEX_RESULT_TIMELINE);
+  mxSetField(out_result, 0, COPTMEX_RESULT_TIMELINE, timeline);
+  timeline = NULL;
+
+  // Gaps are measured against the final objective, or the final bound without incumbent
+  if (nEvent > 0)
+  {
+    dRef = mxIsInf(progress->eventObj[nEvent - 1]) ? progress->eventBnd[nEvent - 1] : progress->eventObj[nEvent - 1];
+  }
+
+  mxAddField(out_result, COPTMEX_RESULT_PRIMALINT);
+  mxSetField(out_result, 0, COPTMEX_RESULT_PRIMALINT,
+             mxCreateDoubleScalar(COPTMEX_getGapIntegral(progress->eventTime, progress->eventObj, nEvent, dRef)));
+  mxAddField(out_result, COPTMEX_RESULT_DUALINT);
+  mxSetField(out_result, 0, COPTMEX_RESULT_DUALINT,
+             mxCreateDoubleScalar(COPTMEX_getGapIntegral(progress->eventTime, progress->eventBnd, nEvent, dRef)));
+
+exit_cleanup:
+  return retcode;
+}
+
+int COPTMEX_stopProgress(mxArray* out_result, mxArray** p_except)
+{
+  int retcode = 0;
+  coptmex_progress* progress = &COPTMEX_progress;
+  mxArray* except = NULL;
+
+  if (progress->func != NULL && progress->except == NULL && progress->nEvent > progress->nEventSent)
+  {
+    COPTMEX_callProgress(COPTMEX_getWallTime());
+  }
+
+  if (out_result != NULL && progress->isMIP && progress->except == NULL)
+  {
+    COPTMEX_CALL(COPTMEX_getTimeline(out_result));
+  }
+
+exit_cleanup:
+  except = progress->except;
+  if (progress->colValue != NULL)
+  {
+    mxFree(progress->colValue);
+  }
+  if (progress->eventTime != NULL)
+  {
+    mxFree(progress->eventTime);
+    mxFree(progress->eventObj);
+    mxFree(progress->eventBnd);
+    mxFree(progress->eventNode);
+  }
+  memset(progress, 0, sizeof(coptmex_progress));
+
+  // Error is handed over to caller, to be raised once problem is cleaned up
+  if (except != NULL)
+  {
+    *p_except = except;
+    retcode = COPTMEX_RETCODE_USERFUNC;
+  }
+
+  return retcode;
+}
+
+static char* COPTMEX_getFileExt(const char* filename)
+{
+  char* tmpfilename = NULL;
+  char* lastdot = NULL;
+  int lenfile = strlen(filename);
+
+  tmpfilename = (char*)mxCalloc(lenfile + 1, sizeof(char));
+  memcpy(tmpfilename, filename, lenfile + 1);
+
+  lastdot = strrchr(tmpfilename, '.');
+  if (!lastdot || lastdot == tmpfilename)
+  {
+    return "";
+  }
+
+  if (lastdot != NULL)
+  {
+    if (strcmp(lastdot, ".gz") == 0)
+    {
+      *lastdot = '\0';
+
+      lastdot = strrchr(tmpfilename, '.');
+      if (!lastdot || lastdot == tmpfilename)
+      {
+        return "";
+      }
+    }
+  }
+
+  return lastdot + 1;
+}
+
+/* Read optional information from file, or from each file in a cell array */
+int COPTMEX_readInfo(copt_prob* prob, const mxArray* in_info)
+{
+  int retcode = 0;
+  char* filename = NULL;
+  char* fileext = NULL;
+
+  if (mxIsCell(in_info))
+  {
+    int nfile = mxGetNumberOfElements(in_info);
+    for (int i = 0; i < nfile; ++i)
+    {
+      mxArray* infofile = mxGetCell(in_info, i);
+      if (infofile == NULL || !mxIsChar(infofile))
+      {
+        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "infofile");
+        goto exit_cleanup;
+      }
+      COPTMEX_CALL(COPTMEX_readInfo(prob, infofile));
+    }
+    goto exit_cleanup;
+  }
+
+  COPTMEX_CALL(COPTMEX_getString(in_info, &filename));
+
+  // Solutions are read as MIP starts, parameters and tuning settings are set to problem
+  fileext = COPTMEX_getFileExt(filename);
+  if (strcmp(fileext, "bas") == 0)
+  {
+    COPTMEX_CALL(COPT_ReadBasis(prob, filename));
+  }
+  else if (strcmp(fileext, "sol") == 0)
+  {
+    COPTMEX_CALL(COPT_ReadSol(prob, filename));
+  }
+  else if (strcmp(fileext, "mst") == 0)
+  {
+    COPTMEX_CALL(COPT_ReadMst(prob, filename));
+  }
+  else if (strcmp(fileext, "par") == 0)
+  {
+    COPTMEX_CALL(COPT_ReadParam(prob, filename));
+  }
+  else if (strcmp(fileext, "tune") == 0)
+  {
+    COPTMEX_CALL(COPT_ReadTune(prob, filename));
+  }
+  else
+  {
+    retcode = COPT_RETCODE_INVALID;
+  }
+
+exit_cleanup:
+  COPTMEX_freeString(&filename);
+  return retcode;
+}
+
+/* Read model from file with the specified extension */
+static int COPTMEX_readModelFile(copt_prob* prob, const char* filename, const char* fileext)
+{
+  int retcode = 0;
+
+  if (strcmp(fileext, "mps") == 0)
+  {
+    COPTMEX_CALL(COPT_ReadMps(prob, filename));
+  }
+  else if (strcmp(fileext, "lp") == 0)
+  {
+    COPTMEX_CALL(COPT_ReadLp(prob, filename));
+  }
+  else if (strcmp(fileext, "bin") == 0)
+  {
+    COPTMEX_CALL(COPT_ReadBin(prob, filename));
+  }
+  else if (strcmp(fileext, "dat-s") == 0)
+  {
+    COPTMEX_CALL(COPT_ReadSDPA(prob, filename));
+  }
+  else if (strcmp(fileext, "cbf") == 0)
+  {
+    COPTMEX_CALL(COPT_ReadCbf(prob, filename));
+  }
+  else
+  {
+    retcode = COPT_RETCODE_INVALID;
+  }
+
+exit_cleanup:
+  return retcode;
+}
+
+/* Write model to file with the specified extension */
+static int COPTMEX_writeModelFile(copt_prob* prob, const char* filename, const char* fileext)
+{
+  int retcode = 0;
+
+  if (strcmp(fileext, "mps") == 0)
+  {
+    COPTMEX_CALL(COPT_WriteMps(prob, filename));
+  }
+  else if (strcmp(fileext, "lp") == 0)
+  {
+    COPTMEX_CALL(COPT_WriteLp(prob, filename));
+  }
+  else if (strcmp(fileext, "bin") == 0)
+  {
+    COPTMEX_CALL(COPT_WriteBin(prob, filename));
+  }
+  else if (strcmp(fileext, "cbf") == 0)
+  {
+    COPTMEX_CALL(COPT_WriteCbf(prob, filename));
+  }
+  else
+  {
+    retcode = COPT_RETCODE_INVALID;
+  }
+
+exit_cleanup:
+  return retcode;
+}
+
+/* Update FNV-1a hash with bytes */
+static void COPTMEX_hashBytes(unsigned long long* hash, const void* data, size_t nbytes)
+{
+  const unsigned char* bytes = (const unsigned char*) data;
+  for (size_t i = 0; i < nbytes; ++i)
+  {
+    *hash ^= bytes[i];
+    *hash *= 1099511628211ULL;
+  }
+}
+
+/* Extract model cache directory, or NULL if cache is disabled */
+static const char* COPTMEX_getCacheDir(void)
+{
+  const char* cachedir = getenv(COPTMEX_CACHE_DIRENV);
+  if (cachedir == NULL || cachedir[0] == '\0')
+  {
+    return NULL;
+  }
+  return cachedir;
+}
+
+/* Extract model cache size limit in bytes */
+static double COPTMEX_getCacheMaxSize(void)
+{
+  double maxsize = COPTMEX_CACHE_DEFSIZE;
+  const char* sizestr = getenv(COPTMEX_CACHE_SIZEENV);
+
+  if (sizestr != NULL && sizestr[0] != '\0')
+  {
+    char* endptr = NULL;
+    double value = strtod(sizestr, &endptr);
+    if (endptr != sizestr && value > 0.0)
+    {
+      maxsize = value;
+    }
+  }
+
+  // Limit is given in megabytes
+  return maxsize * 1024.0 * 1024.0;
+}
+
+/* Check if model format is parsed from text and worth caching as binary */
+static int COPTMEX_isCacheExt(const char* fileext)
+{
+  return strcmp(fileext, "mps") == 0 || strcmp(fileext, "lp") == 0 || strcmp(fileext, "dat-s") == 0 ||
+         strcmp(fileext, "cbf") == 0;
+}
+
+/* Compute cache file path keyed by source path, size, mtime and content */
+static int COPTMEX_getCachePath(const char* filename, char* cachepath)
+{
+  const char* cachedir = COPTMEX_getCacheDir();
+  char fullpath[COPT_BUFFSIZE];
+  char buffer[65536];
+  unsigned long long hash = 14695981039346656037ULL;
+  long long filesize = 0;
+  long long filetime = 0;
+  size_t nread = 0;
+  FILE* fp = NULL;
+  COPTMEX_statbuf filestat;
+
+  cachepath[0] = '\0';
+  if (cachedir == NULL || COPTMEX_stat(filename, &filestat) != 0)
+  {
+    return 0;
+  }
+
+#ifdef _WIN32
+  if (_fullpath(fullpath, filename, COPT_BUFFSIZE) == NULL)
+#else
+  if (realpath(filename, fullpath) == NULL)
+#endif
+  {
+    snprintf(fullpath, COPT_BUFFSIZE, "%s", filename);
+  }
+
+  filesize = (long long) filestat.st_size;
+  filetime = (long long) filestat.st_mtime;
+
+  COPTMEX_hashBytes(&hash, fullpath, strlen(fullpath));
+  COPTMEX_hashBytes(&hash, &filesize, sizeof(filesize));
+  COPTMEX_hashBytes(&hash, &filetime, sizeof(filetime));
+
+  // Hash the raw (possibly compressed) content, which is far cheaper than parsing
+  fp = fopen(filename, "rb");
+  if (fp == NULL)
+  {
+    return 0;
+  }
+  while ((nread = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+  {
+    COPTMEX_hashBytes(&hash, buffer, nread);
+  }
+  fclose(fp);
+
+  snprintf(cachepath, COPT_BUFFSIZE, "%s/%s%016llx.bin", cachedir, COPTMEX_CACHE_PREFIX, hash);
+  return 1;
+}
+
+/* Append cache file to entry list */
+static int COPTMEX_appendCache(const char* cachedir, const char* name, coptmex_cacheentry** p_entry, int* p_nentry,
+                               int* p_capacity)
+{
+  size_t lenname = strlen(name);
+  size_t lenprefix = strlen(COPTMEX_CACHE_PREFIX);
+  COPTMEX_statbuf filestat;
+  coptmex_cacheentry* entry = NULL;
+
+  if (lenname <= lenprefix + 4 || strncmp(name, COPTMEX_CACHE_PREFIX, lenprefix) != 0 ||
+      strcmp(name + lenname - 4, ".bin") != 0)
+  {
+    return COPT_RETCODE_OK;
+  }
+
+  if (*p_nentry == *p_capacity)
+  {
+    *p_capacity *= 2;
+    *p_entry = (coptmex_cacheentry*) mxRealloc(*p_entry, (*p_capacity) * sizeof(coptmex_cacheentry));
+    if (!(*p_entry))
+    {
+      return COPT_RETCODE_MEMORY;
+    }
+  }
+
+  entry = &(*p_entry)[*p_nentry];
+  snprintf(entry->path, COPT_BUFFSIZE, "%s/%s", cachedir, name);
+  if (COPTMEX_stat(entry->path, &filestat) == 0)
+  {
+    entry->size = (double) filestat.st_size;
+    entry->mtime = (double) filestat.st_mtime;
+    (*p_nentry)++;
+  }
+
+  return COPT_RETCODE_OK;
+}
+
+/* Collect all files in model cache */
+static int COPTMEX_scanCache(const char* cachedir, coptmex_cacheentry** p_entry, int* p_nentry)
+{
+  int retcode = COPT_RETCODE_OK;
+  int capacity = 16;
+
+  *p_nentry = 0;
+  *p_entry = (coptmex_cacheentry*) mxCalloc(capacity, sizeof(coptmex_cacheentry));
+  if (!(*p_entry))
+  {
+    return COPT_RETCODE_MEMORY;
+  }
+
+#ifdef _WIN32
+  char pattern[COPT_BUFFSIZE];
+  WIN32_FIND_DATAA finddata;
+  HANDLE hfind = INVALID_HANDLE_VALUE;
+
+  snprintf(pattern, COPT_BUFFSIZE, "%s/%s*.bin", cachedir, COPTMEX_CACHE_PREFIX);
+  hfind = FindFirstFileA(pattern, &finddata);
+  if (hfind != INVALID_HANDLE_VALUE)
+  {
+    do
+    {
+      retcode = COPTMEX_appendCache(cachedir, finddata.cFileName, p_entry, p_nentry, &capacity);
+    } while (retcode == COPT_RETCODE_OK && FindNextFileA(hfind, &finddata));
+    FindClose(hfind);
+  }
+#else
+  DIR* dir = opendir(cachedir);
+  struct dirent* dent = NULL;
+
+  if (dir != NULL)
+  {
+    while (retcode == COPT_RETCODE_OK && (dent = readdir(dir)) != NULL)
+    {
+      retcode = COPTMEX_appendCache(cachedir, dent->d_name, p_entry, p_nentry, &capacity);
+    }
+    closedir(dir);
+  }
+#endif
+
+  return retcode;
+}
+
+/* Order cache entries from the least recently used */
+static int COPTMEX_compareCache(const void* a, const void* b)
+{
+  double mtimeA = ((const coptmex_cacheentry*) a)->mtime;
+  double mtimeB = ((const coptmex_cacheentry*) b)->mtime;
+  return (mtimeA > mtimeB) - (mtimeA < mtimeB);
+}
+
+/* Remove least recently used entries until cache fits in size limit */
+static void COPTMEX_trimCache(const char* cachedir, const char* keeppath)
+{
+  double maxsize = COPTMEX_getCacheMaxSize();
+  double totalsize = 0.0;
+  int nentry = 0;
+  coptmex_cacheentry* entry = NULL;
+
+  if (COPTMEX_scanCache(cachedir, &entry, &nentry) == COPT_RETCODE_OK)
+  {
+    for (int i = 0; i < nentry; ++i)
+    {
+      totalsize += entry[i].size;
+    }
+
+    if (totalsize > maxsize)
+    {
+      qsort(entry, nentry, sizeof(coptmex_cacheentry), COPTMEX_compareCache);
+      for (int i = 0; i < nentry && totalsize > maxsize; ++i)
+      {
+        if (strcmp(entry[i].path, keeppath) != 0 && remove(entry[i].path) == 0)
+        {
+          totalsize -= entry[i].size;
+        }
+      }
+    }
+  }
+
+  if (entry != NULL)
+  {
+    mxFree(entry);
+  }
+}
+
+/* Save loaded model to cache, ignoring failures */
+static void COPTMEX_writeCache(copt_prob* prob, const char* cachepath)
+{
+  char partpath[COPT_BUFFSIZE];
+
+  // Write to a partial file first, so that concurrent readers never see a truncated model
+  snprintf(partpath, COPT_BUFFSIZE, "%s.part%d", cachepath, (int) COPTMEX_getpid());
+  if (COPT_WriteBin(prob, partpath) != COPT_RETCODE_OK || rename(partpath, cachepath) != 0)
+  {
+    remove(partpath);
+    return;
+  }
+
+  COPTMEX_trimCache(COPTMEX_getCacheDir(), cachepath);
+}
+
+/* Extract model cache information */
+int COPTMEX_getCacheInfo(mxArray** out_info)
+{
+  int retcode = COPT_RETCODE_OK;
+  const char* cachedir = COPTMEX_getCacheDir();
+  double totalsize = 0.0;
+  int nentry = 0;
+  coptmex_cacheentry* entry = NULL;
+  mxArray* info = NULL;
+
+  if (cachedir != NULL)
+  {
+    COPTMEX_CALL(COPTMEX_scanCache(cachedir, &entry, &nentry));
+    for (int i = 0; i < nentry; ++i)
+    {
+      totalsize += entry[i].size;
+    }
+  }
+
+  info = mxCreateStructMatrix(1, 1, 0, NULL);
+  if (!info)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  mxAddField(info, COPTMEX_CACHE_DIR);
+  mxAddField(info, COPTMEX_CACHE_NFILES);
+  mxAddField(info, COPTMEX_CACHE_SIZE);
+  mxAddField(info, COPTMEX_CACHE_MAXSIZE);
+
+  mxSetField(info, 0, COPTMEX_CACHE_DIR, mxCreateString(cachedir != NULL ? cachedir : ""));
+  mxSetField(info, 0, COPTMEX_CACHE_NFILES, mxCreateDoubleScalar(nentry));
+  mxSetField(info, 0, COPTMEX_CACHE_SIZE, mxCreateDoubleScalar(totalsize));
+  mxSetField(info, 0, COPTMEX_CACHE_MAXSIZE, mxCreateDoubleScalar(COPTMEX_getCacheMaxSize()));
+
+  *out_info = info;
+
+exit_cleanup:
+  if (entry != NULL)
+  {
+    mxFree(entry);
+  }
+  return retcode;
+}
+
+/* Remove all entries in model cache */
+int COPTMEX_clearCache(int* p_nremoved)
+{
+  int retcode = COPT_RETCODE_OK;
+  const char* cachedir = COPTMEX_getCacheDir();
+  int nentry = 0;
+  coptmex_cacheentry* entry = NULL;
+
+  *p_nremoved = 0;
+  if (cachedir == NULL)
+  {
+    return retcode;
+  }
+
+  COPTMEX_CALL(COPTMEX_scanCache(cachedir, &entry, &nentry));
+  for (int i = 0; i < nentry; ++i)
+  {
+    if (remove(entry[i].path) == 0)
+    {
+      (*p_nremoved)++;
+    }
+  }
+
+exit_cleanup:
+  if (entry != NULL)
+  {
+    mxFree(entry);
+  }
+  return retcode;
+}
+
+/* Read model from file */
+int COPTMEX_readModel(copt_prob* prob, const mxArray* in_model)
+{
+  int retcode = 0;
+  char* filename = NULL;
+  char* fileext = NULL;
+  char cachepath[COPT_BUFFSIZE];
+  COPTMEX_statbuf cachestat;
+
+  COPTMEX_CALL(COPTMEX_getString(in_model, &filename));
+
+  fileext = COPTMEX_getFileExt(filename);
+
+  // Load binary copy from model cache if enabled and up to date, the path
+  // hashes the whole file so it is only computed for formats that are cached
+  cachepath[0] = '\0';
+  if (COPTMEX_isCacheExt(fileext) && COPTMEX_getCachePath(filename, cachepath))
+  {
+    if (COPTMEX_stat(cachepath, &cachestat) == 0 && COPT_ReadBin(prob, cachepath) == COPT_RETCODE_OK)
+    {
+      COPTMEX_utime(cachepath);
+      goto exit_cleanup;
+    }
+  }
+
+  COPTMEX_CALL(COPTMEX_readModelFile(prob, filename, fileext));
+
+  if (cachepath[0] != '\0')
+  {
+    COPTMEX_writeCache(prob, cachepath);
+  }
+
+exit_cleanup:
+  COPTMEX_freeString(&filename);
+  return retcode;
+}
+
+/* Write model to file */
+int COPTMEX_writeModel(copt_prob* prob, const mxArray* out_file)
+{
+  int retcode = 0;
+  char* filename = NULL;
+  char* fileext = NULL;
+
+  COPTMEX_CALL(COPTMEX_getString(out_file, &filename));
+
+  fileext = COPTMEX_getFileExt(filename);
+  COPTMEX_CALL(COPTMEX_writeModelFile(prob, filename, fileext));
+
+exit_cleanup:
+  COPTMEX_freeString(&filename);
+  return retcode;
+}
+
+/* Split format such as 'mps', '.lp' or 'mps.gz' into extension and compression flag */
+static void COPTMEX_parseFormat(char* format, char** p_fileext, int* p_isGzip)
+{
+  size_t lenfmt = 0;
+
+  if (format[0] == '.')
+  {
+    format++;
+  }
+
+  lenfmt = strlen(format);
+  *p_isGzip = 0;
+  if (lenfmt > 3 && strcmp(format + lenfmt - 3, ".gz") == 0)
+  {
+    format[lenfmt - 3] = '\0';
+    *p_isGzip = 1;
+  }
+
+  *p_fileext = format;
+}
+
+/* Open an anonymous file that COPT readers/writers can access by path */
+static int COPTMEX_openMemFile(const char* fileext, int isGzip, coptmex_memfile* memfile)
+{
+  char suffix[COPT_BUFFSIZE];
+
+  memfile->fd = -1;
+  memfile->isTemp = 0;
+  memfile->path[0] = '\0';
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+  // Memory-backed file, only for uncompressed data since readers detect gzip by name
+  if (!isGzip)
+  {
+    memfile->fd = (int) syscall(SYS_memfd_create, "coptmex", 0);
+    if (memfile->fd >= 0)
+    {
+      snprintf(memfile->path, COPT_BUFFSIZE, "/proc/self/fd/%d", memfile->fd);
+      return COPT_RETCODE_OK;
+    }
+  }
+#endif
+
+  // Fall back to a temporary file carrying the extension
+  snprintf(suffix, COPT_BUFFSIZE, ".%s%s", fileext, isGzip ? ".gz" : "");
+
+#ifdef _WIN32
+  char* tmpname = _tempnam(NULL, "coptmex");
+  if (tmpname == NULL)
+  {
+    return COPT_RETCODE_FILE;
+  }
+  int pathlen = snprintf(memfile->path, COPT_BUFFSIZE, "%s%s", tmpname, suffix);
+  free(tmpname);
+  if (pathlen < 0 || pathlen >= COPT_BUFFSIZE)
+  {
+    return COPT_RETCODE_FILE;
+  }
+  memfile->fd = _open(memfile->path, _O_CREAT | _O_EXCL | _O_RDWR | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+  const char* tmpdir = getenv("TMPDIR");
+  if (tmpdir == NULL || tmpdir[0] == '\0')
+  {
+    tmpdir = "/tmp";
+  }
+  // A long TMPDIR would truncate the template and its suffix
+  int pathlen = snprintf(memfile->path, COPT_BUFFSIZE, "%s/coptmexXXXXXX%s", tmpdir, suffix);
+  if (pathlen < 0 || pathlen >= COPT_BUFFSIZE)
+  {
+    return COPT_RETCODE_FILE;
+  }
+  memfile->fd = mkstemps(memfile->path, (int) strlen(suffix));
+#endif
+
+  if (memfile->fd < 0)
+  {
+    return COPT_RETCODE_FILE;
+  }
+
+  memfile->isTemp = 1;
+  return COPT_RETCODE_OK;
+}
+
+/* Close anonymous file and remove it if backed by disk */
+static void COPTMEX_closeMemFile(coptmex_memfile* memfile)
+{
+  if (memfile->fd >= 0)
+  {
+    COPTMEX_fdClose(memfile->fd);
+    memfile->fd = -1;
+  }
+  if (memfile->isTemp)
+  {
+    COPTMEX_unlink(memfile->path);
+    memfile->isTemp = 0;
+  }
+}
+
+/* Read model from MATLAB uint8 buffer in the specified format */
+int COPTMEX_readModelBuffer(copt_prob* prob, const mxArray* in_buffer, const mxArray* in_format)
+{
+  int retcode = 0;
+  char* format = NULL;
+  char* fileext = NULL;
+  int isGzip = 0;
+  coptmex_memfile memfile;
+  const char* data = (const char*) mxGetData(in_buffer);
+  size_t nbytes = mxGetNumberOfElements(in_buffer);
+  size_t offset = 0;
+
+  memfile.fd = -1;
+  memfile.isTemp = 0;
+
+  COPTMEX_CALL(COPTMEX_getString(in_format, &format));
+  COPTMEX_parseFormat(format, &fileext, &isGzip);
+
+  COPTMEX_CALL(COPTMEX_openMemFile(fileext, isGzip, &memfile));
+
+  // Copy bytes in chunks, since single writes may be capped by the OS
+  while (offset < nbytes)
+  {
+    size_t nchunk = COPTMEX_MIN(nbytes - offset, (size_t) 1 << 30);
+    int nwrite = (int) COPTMEX_fdWrite(memfile.fd, data + offset, (unsigned int) nchunk);
+    if (nwrite <= 0)
+    {
+      retcode = COPT_RETCODE_FILE;
+      goto exit_cleanup;
+    }
+    offset += (size_t) nwrite;
+  }
+
+  COPTMEX_CALL(COPTMEX_readModelFile(prob, memfile.path, fileext));
+
+exit_cleanup:
+  COPTMEX_closeMemFile(&memfile);
+  COPTMEX_freeString(&format);
+  return retcode;
+}
+
+/* Write model to MATLAB uint8 buffer in the specified format */
+int COPTMEX_writeModelBuffer(copt_prob* prob, const mxArray* in_format, mxArray** out_buffer)
+{
+  int retcode = 0;
+  char* format = NULL;
+  char* fileext = NULL;
+  int isGzip = 0;
+  coptmex_memfile memfile;
+  char* data = NULL;
+  size_t nbytes = 0;
+  size_t offset = 0;
+
+  memfile.fd = -1;
+  memfile.isTemp = 0;
+
+  COPTMEX_CALL(COPTMEX_getString(in_format, &format));
+  COPTMEX_parseFormat(format, &fileext, &isGzip);
+
+  // Compressed output is not produced by COPT writers
+  if (isGzip)
+  {
+    retcode = COPT_RETCODE_INVALID;
+    goto exit_cleanup;
+  }
+
+  COPTMEX_CALL(COPTMEX_openMemFile(fileext, isGzip, &memfile));
+  COPTMEX_CALL(COPTMEX_writeModelFile(prob, memfile.path, fileext));
+
+  // Writers reopen the path, so size is taken from the end of the file
+  nbytes = (size_t) COPTMEX_fdSeek(memfile.fd, 0, SEEK_END);
+  COPTMEX_fdSeek(memfile.fd, 0, SEEK_SET);
+
+  *out_buffer = mxCreateNumericMatrix(nbytes, 1, mxUINT8_CLASS, mxREAL);
+  if (!(*out_buffer))
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  data = (char*) mxGetData(*out_buffer);
+  while (offset < nbytes)
+  {
+    size_t nchunk = COPTMEX_MIN(nbytes - offset, (size_t) 1 << 30);
+    int nread = (int) COPTMEX_fdRead(memfile.fd, data + offset, (unsigned int) nchunk);
+    if (nread <= 0)
+    {
+      retcode = COPT_RETCODE_FILE;
+      goto exit_cleanup;
+    }
+    offset += (size_t) nread;
+  }
+
+exit_cleanup:
+  COPTMEX_closeMemFile(&memfile);
+  COPTMEX_freeString(&format);
+  return retcode;
+}
+
+/* Compute primal, dual and complementarity residuals of solution in result */
+static int COPTMEX_getResidual(copt_prob* prob, coptmex_cprob* cprob, mxArray* result)
+{
+  int retcode = COPT_RETCODE_OK;
+  coptmex_cprob cdata;
+  double* rowAct = NULL;
+
+  COPTMEX_initCProb(&cdata);
+
+  if (result == NULL)
+  {
+    goto exit_cleanup;
+  }
+
+  mxArray* value_m = mxGetField(result, 0, COPTMEX_RESULT_VALUE);
+  mxArray* dual_m = mxGetField(result, 0, COPTMEX_RESULT_DUAL);
+  mxArray* redcost_m = mxGetField(result, 0, COPTMEX_RESULT_REDCOST);
+  if (value_m == NULL)
+  {
+    goto exit_cleanup;
+  }
+
+  // Fetch the loaded data from problem if not given
+  if (cprob == NULL)
+  {
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ROWS, &cdata.nRow));
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &cdata.nCol));
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ELEMS, &cdata.nElem));
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_OBJSENSE, &cdata.nObjSen));
+
+    cdata.colMatBeg = (int*)COPTMEX_alloc(cdata.nCol + 1, sizeof(int));
+    cdata.colMatIdx = (int*)COPTMEX_alloc(COPTMEX_MAX(cdata.nElem, 1), sizeof(int));
+    cdata.colMatElem = (double*)COPTMEX_alloc(COPTMEX_MAX(cdata.nElem, 1), sizeof(double));
+    cdata.colCost = (double*)COPTMEX_alloc(COPTMEX_MAX(cdata.nCol, 1), sizeof(double));
+    cdata.colLower = (double*)COPTMEX_alloc(COPTMEX_MAX(cdata.nCol, 1), sizeof(double));
+    cdata.colUpper = (double*)COPTMEX_alloc(COPTMEX_MAX(cdata.nCol, 1), sizeof(double));
+    cdata.rowLower = (double*)COPTMEX_alloc(COPTMEX_MAX(cdata.nRow, 1), sizeof(double));
+    cdata.rowUpper = (double*)COPTMEX_alloc(COPTMEX_MAX(cdata.nRow, 1), sizeof(double));
+    if (!cdata.colMatBeg || !cdata.colMatIdx || !cdata.colMatElem || !cdata.colCost || !cdata.colLower ||
+        !cdata.colUpper || !cdata.rowLower || !cdata.rowUpper)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    if (cdata.nCol > 0)
+    {
+      COPTMEX_CALL(COPT_GetCols(prob, cdata.nCol, NULL, cdata.colMatBeg, NULL, cdata.colMatIdx, cdata.colMatElem,
+        cdata.nElem, NULL));
+      COPTMEX_CALL(COPT_GetColInfo(prob, COPT_DBLINFO_OBJ, cdata.nCol, NULL, cdata.colCost));
+      COPTMEX_CALL(COPT_GetColInfo(prob, COPT_DBLINFO_LB, cdata.nCol, NULL, cdata.colLower));
+      COPTMEX_CALL(COPT_GetColInfo(prob, COPT_DBLINFO_UB, cdata.nCol, NULL, cdata.colUpper));
+    }
+    if (cdata.nRow > 0)
+    {
+      COPTMEX_CALL(COPT_GetRowInfo(prob, COPT_DBLINFO_LB, cdata.nRow, NULL, cdata.rowLower));
+      COPTMEX_CALL(COPT_GetRowInfo(prob, COPT_DBLINFO_UB, cdata.nRow, NULL, cdata.rowUpper));
+    }
+
+    cprob = &cdata;
+  }
+
+  // Dual residuals are only defined for linear problems with duals
+  int hasDual = (dual_m != NULL && redcost_m != NULL);
+  if (hasDual)
+  {
+    int nQElem = 0, nQConstr = 0, nCone = 0, nExpCone = 0, nAffCone = 0, nPSD = 0;
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_QELEMS, &nQElem));
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_QCONSTRS, &nQConstr));
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_CONES, &nCone));
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_EXPCONES, &nExpCone));
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_AFFINECONES, &nAffCone));
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_PSDCOLS, &nPSD));
+    if (nQElem + nQConstr + nCone + nExpCone + nAffCone + nPSD > 0)
+    {
+      hasDual = 0;
+    }
+  }
+
+  rowAct = (double*)COPTMEX_alloc(COPTMEX_MAX(cprob->nRow, 1), sizeof(double));
+  if (!rowAct)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  const double* colValue = mxGetDoubles(value_m);
+  const double* rowDual = hasDual ? mxGetDoubles(dual_m) : NULL;
+  const double* colDual = hasDual ? mxGetDoubles(redcost_m) : NULL;
+  double objSense = (cprob->nObjSen == COPT_MAXIMIZE) ? -1.0 : 1.0;
+  double primalViol = 0.0;
+  double dualViol = 0.0;
+  double complViol = 0.0;
+
+  // Single pass over columns for row activities, bound violations and dual stationarity
+  for (int j = 0; j < cprob->nCol; ++j)
+  {
+    double colVal = colValue[j];
+    double colLow = (cprob->colLower != NULL) ? cprob->colLower[j] : 0.0;
+    double colUpp = (cprob->colUpper != NULL) ? cprob->colUpper[j] : +COPT_INFINITY;
+    double colDot = 0.0;
+
+    for (int k = cprob->colMatBeg[j]; k < cprob->colMatBeg[j + 1]; ++k)
+    {
+      int iRow = cprob->colMatIdx[k];
+      rowAct[iRow] += cprob->colMatElem[k] * colVal;
+      if (hasDual)
+      {
+        colDot += cprob->colMatElem[k] * rowDual[iRow];
+      }
+    }
+
+    primalViol = COPTMEX_MAX(primalViol, colLow - colVal);
+    primalViol = COPTMEX_MAX(primalViol, colVal - colUpp);
+
+    if (hasDual)
+    {
+      double colCost = (cprob->colCost != NULL) ? cprob->colCost[j] : 0.0;
+      double colRes = colCost - colDot - colDual[j];
+      double colRc = objSense * colDual[j];
+
+      dualViol = COPTMEX_MAX(dualViol, (colRes < 0.0) ? -colRes : colRes);
+      if (colLow <= -COPT_INFINITY)
+      {
+        dualViol = COPTMEX_MAX(dualViol, colRc);
+      }
+      else if (colRc > 0.0)
+      {
+        complViol = COPTMEX_MAX(complViol, colRc * ((colVal > colLow) ? colVal - colLow : colLow - colVal));
+      }
+      if (colUpp >= +COPT_INFINITY)
+      {
+        dualViol = COPTMEX_MAX(dualViol, -colRc);
+      }
+      else if (colRc < 0.0)
+      {
+        complViol = COPTMEX_MAX(complViol, -colRc * ((colUpp > colVal) ? colUpp - colVal : colVal - colUpp));
+      }
+    }
+  }
+
+  for (int i = 0; i < cprob->nRow; ++i)
+  {
+    double rowLow = 0.0;
+    double rowUpp = 0.0;
+
+    if (cprob->rowLower != NULL)
+    {
+      rowLow = cprob->rowLower[i];
+      rowUpp = cprob->rowUpper[i];
+    }
+    else
+    {
+      switch (cprob->rowSense[i])
+      {
+      case COPT_LESS_EQUAL:
+        rowLow = -COPT_INFINITY;
+        rowUpp = cprob->rowUpper[i];
+        break;
+      case COPT_GREATER_EQUAL:
+        rowLow = cprob->rowUpper[i];
+        rowUpp = +COPT_INFINITY;
+        break;
+      default:
+        rowLow = cprob->rowUpper[i];
+        rowUpp = cprob->rowUpper[i];
+        break;
+      }
+    }
+
+    primalViol = COPTMEX_MAX(primalViol, rowLow - rowAct[i]);
+    primalViol = COPTMEX_MAX(primalViol, rowAct[i] - rowUpp);
+
+    if (hasDual)
+    {
+      double rowPi = objSense * rowDual[i];
+
+      if (rowLow <= -COPT_INFINITY)
+      {
+        dualViol = COPTMEX_MAX(dualViol, rowPi);
+      }
+      else if (rowPi > 0.0)
+      {
+        complViol = COPTMEX_MAX(complViol, rowPi * ((rowAct[i] > rowLow) ? rowAct[i] - rowLow : rowLow - rowAct[i]));
+      }
+      if (rowUpp >= +COPT_INFINITY)
+      {
+        dualViol = COPTMEX_MAX(dualViol, -rowPi);
+      }
+      else if (rowPi < 0.0)
+      {
+        complViol = COPTMEX_MAX(complViol, -rowPi * ((rowUpp > rowAct[i]) ? rowUpp - rowAct[i] : rowAct[i] - rowUpp));
+      }
+    }
+  }
+
+  mxAddField(result, COPTMEX_RESULT_PRIMALVIOL);
+  mxSetField(result, 0, COPTMEX_RESULT_PRIMALVIOL, mxCreateDoubleScalar(primalViol));
+  if (hasDual)
+  {
+    mxAddField(result, COPTMEX_RESULT_DUALVIOL);
+    mxSetField(result, 0, COPTMEX_RESULT_DUALVIOL, mxCreateDoubleScalar(dualViol));
+    mxAddField(result, COPTMEX_RESULT_COMPL);
+    mxSetField(result, 0, COPTMEX_RESULT_COMPL, mxCreateDoubleScalar(complViol));
+  }
+
+exit_cleanup:
+  if (rowAct != NULL)
+  {
+    mxFree(rowAct);
+  }
+  if (cdata.colMatBeg != NULL)
+  {
+    mxFree(cdata.colMatBeg);
+  }
+  if (cdata.colMatIdx != NULL)
+  {
+    mxFree(cdata.colMatIdx);
+  }
+  if (cdata.colMatElem != NULL)
+  {
+    mxFree(cdata.colMatElem);
+  }
+  if (cdata.colCost != NULL)
+  {
+    mxFree(cdata.colCost);
+  }
+  if (cdata.colLower != NULL)
+  {
+    mxFree(cdata.colLower);
+  }
+  if (cdata.colUpper != NULL)
+  {
+    mxFree(cdata.colUpper);
+  }
+  if (cdata.rowLower != NULL)
+  {
+    mxFree(cdata.rowLower);
+  }
+  if (cdata.rowUpper != NULL)
+  {
+    mxFree(cdata.rowUpper);
+  }
+  return retcode;
+}
+
+/* Map name of solution field to its bit in result field mask, or 0 if unknown */
+static int COPTMEX_getFieldMask(const mxArray* in_field)
+{
+  const char* fieldnames[7] = {COPTMEX_RESULT_VALUE, COPTMEX_RESULT_REDCOST, COPTMEX_RESULT_SLACK,
+                               COPTMEX_RESULT_DUAL, COPTMEX_RESULT_VARBASIS, COPTMEX_RESULT_CONBASIS,
+                               COPTMEX_RESULT_POOL};
+  char fieldname[COPT_BUFFSIZE];
+
+  if (in_field == NULL || !mxIsChar(in_field))
+  {
+    return 0;
+  }
+
+  mxGetString(in_field, fieldname, COPT_BUFFSIZE);
+  for (int i = 0; i < 7; ++i)
+  {
+    if (strcmp(fieldname, fieldnames[i]) == 0)
+    {
+      return 1 << i;
+    }
+  }
+
+  return 0;
+}
+
+/* Extract solution files to write and solution fields to return, if given by parameter */
+static int COPTMEX_getOutput(const mxArray* in_param, coptmex_output* output)
+{
+  int retcode = 0;
+  char msgbuf[COPT_BUFFSIZE];
+  const char* filepars[3] = {COPTMEX_PARAM_WRITESOL, COPTMEX_PARAM_WRITEBASIS, COPTMEX_PARAM_WRITEMIPSTART};
+  char** filenames[3] = {&output->solFile, &output->basFile, &output->mstFile};
+  mxArray* fields = NULL;
+  mxArray* residuals = NULL;
+
+  // Output settings can not be held by precompiled parameter handle
+  if (in_param == NULL || mxIsUint8(in_param))
+  {
+    return retcode;
+  }
+
+  for (int i = 0; i < 3; ++i)
+  {
+    mxArray* filename = COPTMEX_getMexParam(in_param, filepars[i]);
+    if (filename != NULL)
+    {
+      if (!mxIsChar(filename))
+      {
+        snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", filepars[i]);
+        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+        goto exit_cleanup;
+      }
+
+      COPTMEX_CALL(COPTMEX_getString(filename, filenames[i]));
+    }
+  }
+
+  fields = COPTMEX_getMexParam(in_param, COPTMEX_PARAM_RESULTFIELDS);
+  if (fields != NULL)
+  {
+    snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", COPTMEX_PARAM_RESULTFIELDS);
+    if (!mxIsChar(fields) && !mxIsCell(fields))
+    {
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+      goto exit_cleanup;
+    }
+
+    // Scalar fields are always returned, only the listed solution fields are
+    output->nFieldMask = 0;
+    int nfield = mxIsChar(fields) ? 1 : mxGetNumberOfElements(fields);
+    for (int i = 0; i < nfield; ++i)
+    {
+      int nMask = COPTMEX_getFieldMask(mxIsChar(fields) ? fields : mxGetCell(fields, i));
+      if (nMask == 0)
+      {
+        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, msgbuf);
+        goto exit_cleanup;
+      }
+
+      output->nFieldMask |= nMask;
+    }
+  }
+
+  residuals = COPTMEX_getMexParam(in_param, COPTMEX_PARAM_RESIDUALS);
+  if (residuals != NULL)
+  {
+    if (!mxIsScalar(residuals) || mxIsChar(residuals))
+    {
+      snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", COPTMEX_PARAM_RESIDUALS);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+      goto exit_cleanup;
+    }
+
+    output->ifResidual = (mxGetScalar(residuals) != 0.0 ? 1 : 0);
+  }
+
+exit_cleanup:
+  return retcode;
+}
+
+/* Write solution, basis and MIP start to files given by parameter, if available */
+static int COPTMEX_writeOutput(copt_prob* prob, const coptmex_output* output)
+{
+  int retcode = 0;
+  int isMip = 0;
+  int hasSol = 0;
+  int hasBasis = 0;
+
+  if (output->solFile == NULL && output->basFile == NULL && output->mstFile == NULL)
+  {
+    goto exit_cleanup;
+  }
+
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ISMIP, &isMip));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, isMip ? COPT_INTATTR_HASMIPSOL : COPT_INTATTR_HASLPSOL, &hasSol));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_HASBASIS, &hasBasis));
+
+  if (output->solFile != NULL && hasSol)
+  {
+    COPTMEX_CALL(COPT_WriteSol(prob, output->solFile));
+  }
+  if (output->basFile != NULL && hasBasis)
+  {
+    COPTMEX_CALL(COPT_WriteBasis(prob, output->basFile));
+  }
+  if (output->mstFile != NULL && hasSol)
+  {
+    COPTMEX_CALL(COPT_WriteMst(prob, output->mstFile));
+  }
+
+exit_cleanup:
+  return retcode;
+}
+
+/* Free file names of solution output settings */
+static void COPTMEX_freeOutput(coptmex_output* output)
+{
+  COPTMEX_freeString(&output->solFile);
+  COPTMEX_freeString(&output->basFile);
+  COPTMEX_freeString(&output->mstFile);
+  return;
+}
+
+/* Solve problem */
+int COPTMEX_solveModel(copt_prob* prob, const mxArray* in_model, int ifRead, const mxArray* in_info,
+                       const mxArray* in_param, mxArray** out_result, int ifRetResult)
+{
+  int retcode = 0;
+  int ifLoaded = 0;
+  coptmex_output output;
+  coptmex_cprob cprob;
+
+  // Check solution output settings before the problem is solved
+  COPTMEX_initOutput(&output);
+  COPTMEX_initCProb(&cprob);
+  COPTMEX_CALL(COPTMEX_getOutput(in_param, &output));
+
+  // Extract and load data to problem, unless already loaded from buffer
+  if (in_model == NULL)
+  {
+    // Nothing to load
+  }
+  else if (ifRead)
+  {
+    COPTMEX_switchPhase(COPTMEX_PHASE_READ);
+    COPTMEX_CALL(COPTMEX_readModel(prob, in_model));
+  }
+  else
+  {
+    // Keep the loaded data to compute residuals after solve
+    COPTMEX_CALL(COPTMEX_loadModelData(prob, in_model, &cprob));
+    ifLoaded = 1;
+  }
+
+  // Read MIP starts, parameters and tuning settings from info files
+  if (in_info != NULL)
+  {
+    COPTMEX_switchPhase(COPTMEX_PHASE_READ);
+    COPTMEX_CALL(COPTMEX_readInfo(prob, in_info));
+  }
+
+  // Set interrupt, progress and user callbacks of MIP solving, other solves are stopped by watchdog
+  COPTMEX_switchPhase(COPTMEX_PHASE_SOLVE);
+  COPTMEX_CALL(COPTMEX_setCallback(prob));
+
+  // Solve the problem, the result of an interrupted solve is returned as is
+  COPTMEX_CALL(COPTMEX_solveWatched(prob));
+  COPTMEX_CALL(COPTMEX_endProgress(prob));
+
+  // Write solution files and extract and save result
+  COPTMEX_switchPhase(COPTMEX_PHASE_EXTRACT);
+  COPTMEX_CALL(COPTMEX_writeOutput(prob, &output));
+  if (ifRetResult)
+  {
+    COPTMEX_CALL(COPTMEX_getResultFields(prob, output.nFieldMask, out_result));
+
+    // Models read from file or buffer are only fetched back from problem if asked
+    if (ifLoaded)
+    {
+      COPTMEX_CALL(COPTMEX_getResidual(prob, &cprob, *out_result));
+    }
+    else if (output.ifResidual)
+    {
+      COPTMEX_CALL(COPTMEX_getResidual(prob, NULL, *out_result));
+    }
+  }
+
+exit_cleanup:
+  COPTMEX_freeModelData(&cprob, ifLoaded ? in_model : NULL);
+  COPTMEX_freeOutput(&output);
+  return retcode;
+}
+
+/* Check if solve problem via cone data */
+int COPTMEX_isConeModel(const mxArray* in_model)
+{
+  int ifConeData = 0;
+  mxArray* conedata = NULL;
+
+  conedata = mxGetField(in_model, 0, COPTMEX_MODEL_CONEDATA);
+  if (conedata != NULL)
+  {
+    if (COPTMEX_checkConeModel(conedata))
+    {
+      ifConeData = 1;
+    }
+  }
+
+  return ifConeData;
+}
+
+/* Load problem with cone data */
+int COPTMEX_loadConeModel(copt_prob* prob, const mxArray* in_model, int* p_nRow, int** p_outMap)
+{
+  int retcode = 0;
+  coptmex_cconeprob cconeprob;
+  coptmex_mconeprob mconeprob;
+  mxArray* conedata = NULL;
+  int* outRowMap = NULL;
+
+  COPTMEX_initCConeProb(&cconeprob);
+  COPTMEX_initMConeProb(&mconeprob);
+
+  conedata = mxGetField(in_model, 0, COPTMEX_MODEL_CONEDATA);
+
+  mconeprob.c = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_C);
+  mconeprob.A = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_A);
+  mconeprob.b = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_B);
+
+  mconeprob.K = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_K);
+  mconeprob.f = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_F);
+  mconeprob.l = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_L);
+  mconeprob.q = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_Q);
+  mconeprob.r = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_R);
+  mconeprob.ep = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_EP);
+  mconeprob.ed = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_ED);
+  mconeprob.s = mxGetField(mconeprob.K, 0, COPTMEX_MODEL_CONEK_S);
+
+  mconeprob.objsen = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_OBJSEN);
+  mconeprob.objcon = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_OBJCON);
+  mconeprob.vtype = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_VTYPE);
+  mconeprob.Q = mxGetField(conedata, 0, COPTMEX_MODEL_CONE_Q);
+
+  // 'c'
+  if (mconeprob.c != NULL)
+  {
+    cconeprob.colObj = mxGetDoubles(mconeprob.c);
+  }
+  // 'A'
+  if (mconeprob.A != NULL)
+  {
+    cconeprob.nRow = mxGetM(mconeprob.A);
+    cconeprob.nCol = mxGetN(mconeprob.A);
+    cconeprob.nElem = mxGetNzmax(mconeprob.A);
+    cconeprob.colMatBeg = (int*)COPTMEX_alloc(cconeprob.nCol + 1, sizeof(int));
+    cconeprob.colMatIdx = (int*)COPTMEX_alloc(cconeprob.nElem, sizeof(int));
+    if (!cconeprob.colMatBeg || !cconeprob.colMatIdx)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    mwIndex* colMatBeg_data = mxGetJc(mconeprob.A);
+    mwIndex* colMatIdx_data = mxGetIr(mconeprob.A);
+    for (int i = 0; i < cconeprob.nCol + 1; ++i)
+    {
+      cconeprob.colMatBeg[i] = (int)colMatBeg_data[i];
+    }
+    for (int i = 0; i < cconeprob.nElem; ++i)
+    {
+      cconeprob.colMatIdx[i] = (int)colMatIdx_data[i];
+    }
+
+    cconeprob.colMatElem = mxGetDoubles(mconeprob.A);
+  }
+  // 'b'
+  if (mconeprob.b != NULL)
+  {
+    cconeprob.rowRhs = (double*)COPTMEX_alloc(cconeprob.nRow, sizeof(double));
+
+    double* rowRhs = mxGetDoubles(mconeprob.b);
+    for (int i = 0; i < cconeprob.nRow; ++i)
+    {
+      if (mxIsInf(rowRhs[i]))
+      {
+        if (rowRhs[i] > 0)
+        {
+          cconeprob.rowRhs[i] = +COPT_INFINITY;
+        }
+        else
+        {
+          cconeprob.rowRhs[i] = -COPT_INFINITY;
+        }
+      }
+      else
+      {
+        cconeprob.rowRhs[i] = rowRhs[i];
+      }
+    }
+  }
+
+  // 'K'
+  if (mconeprob.K != NULL)
+  {
+    // 'f'
+    if (mconeprob.f != NULL)
+    {
+      cconeprob.nFree = (int)mxGetScalar(mconeprob.f);
+    }
+    // 'l'
+    if (mconeprob.l != NULL)
+    {
+      cconeprob.nPositive = (int)mxGetScalar(mconeprob.l);
+    }
+    // 'q'
+    if (mconeprob.q != NULL)
+    {
+      int nCone = mxGetNumberOfElements(mconeprob.q);
+      double* coneDim_data = mxGetDoubles(mconeprob.q);
+
+      if (nCone > 1 || (nCone == 1 && coneDim_data[0] > 0))
+      {
+        cconeprob.nCone = nCone;
+        cconeprob.coneDim = (int*)COPTMEX_alloc(cconeprob.nCone, sizeof(int));
+
+        for (int i = 0; i < cconeprob.nCone; ++i)
+        {
+          cconeprob.coneDim[i] = (int)coneDim_data[i];
+        }
+      }
+    }
+    // 'r'
+    if (mconeprob.r != NULL)
+    {
+      int nRotateCone = mxGetNumberOfElements(mconeprob.r);
+      double* rotateConeDim_data = mxGetDoubles(mconeprob.r);
+
+      if (nRotateCone > 1 || (nRotateCone == 1 && rotateConeDim_data[0] > 0))
+      {
+        cconeprob.nRotateCone = nRotateCone;
+        cconeprob.rotateConeDim = (int*)COPTMEX_alloc(cconeprob.nRotateCone, sizeof(int));
+
+        for (int i = 0; i < cconeprob.nRotateCone; ++i)
+        {
+          cconeprob.rotateConeDim[i] = (int)rotateConeDim_data[i];
+        }
+      }
+    }
+    // 'ep'
+    if (mconeprob.ep != NULL)
+    {
+      int nPrimalExpCone = (int)mxGetScalar(mconeprob.ep);
+      cconeprob.nPrimalExpCone = nPrimalExpCone;
+    }
+    // 'ed'
+    if (mconeprob.ed != NULL)
+    {
+      int nDualExpCone = (int)mxGetScalar(mconeprob.ed);
+      cconeprob.nDualExpCone = nDualExpCone;
+    }
+
+    /* Number of scalar columns */
+    cconeprob.nScalarCol += cconeprob.nFree;
+    cconeprob.nScalarCol += cconeprob.nPositive;
+    for (int i = 0; i < cconeprob.nCone; ++i)
+    {
+      cconeprob.nScalarCol += cconeprob.coneDim[i];
+    }
+    for (int i = 0; i < cconeprob.nRotateCone; ++i)
+    {
+      cconeprob.nScalarCol += cconeprob.rotateConeDim[i];
+    }
+    cconeprob.nScalarCol += 3 * cconeprob.nPrimalExpCone;
+    cconeprob.nScalarCol += 3 * cconeprob.nDualExpCone;
+
+    // 's'
+    if (mconeprob.s != NULL)
+    {
+      int nPSD = mxGetNumberOfElements(mconeprob.s);
+      double* psdDim_data = mxGetDoubles(mconeprob.s);
+
+      if (nPSD > 1 || (nPSD == 1 && psdDim_data[0] > 0))
+      {
+        cconeprob.nPSD = nPSD;
+        cconeprob.psdDim = (int*)COPTMEX_alloc(cconeprob.nPSD, sizeof(int));
+
+        for (int i = 0; i < cconeprob.nPSD; ++i)
+        {
+          cconeprob.psdDim[i] = (int)psdDim_data[i];
+        }
+      }
+    }
+  }
+
+  // 'objsen'
+  if (mconeprob.objsen != NULL)
+  {
+    COPTMEX_CALL(COPTMEX_getObjsen(mconeprob.objsen, &cconeprob.nObjSense));
+  }
+  // 'objcon'
+  if (mconeprob.objcon != NULL)
+  {
+    cconeprob.dObjConst = mxGetScalar(mconeprob.objcon);
+  }
+  // 'vtype'
+  if (mconeprob.vtype != NULL)
+  {
+    if (mxGetNumberOfElements(mconeprob.vtype) == cconeprob.nScalarCol)
+    {
+      COPTMEX_CALL(COPTMEX_getString(mconeprob.vtype, &cconeprob.colType));
+    }
+    else
+    {
+      char* vtype = NULL;
+      COPTMEX_CALL(COPTMEX_getString(mconeprob.vtype, &vtype));
+
+      cconeprob.colType = (char*)COPTMEX_alloc(cconeprob.nScalarCol + 1, sizeof(char));
+      if (!cconeprob.colType)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+      for (int i = 0; i < cconeprob.nScalarCol; ++i)
+      {
+        cconeprob.colType[i] = vtype[0];
+      }
+    }
+  }
+  // 'Q'
+  if (mconeprob.Q != NULL)
+  {
+    cconeprob.nQObjElem = mxGetNzmax(mconeprob.Q);
+
+    cconeprob.qObjRow = (int*)COPTMEX_alloc(cconeprob.nQObjElem, sizeof(int));
+    cconeprob.qObjCol = (int*)COPTMEX_alloc(cconeprob.nQObjElem, sizeof(int));
+    cconeprob.qObjElem = (double*)COPTMEX_alloc(cconeprob.nQObjElem, sizeof(double));
+    if (!cconeprob.qObjRow || !cconeprob.qObjCol || !cconeprob.qObjElem)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    COPTMEX_csc2coo(mconeprob.Q, cconeprob.qObjRow, cconeprob.qObjCol, cconeprob.qObjElem);
+  }
+
+  if (p_outMap != NULL)
+  {
+    outRowMap = (int*)COPTMEX_alloc(cconeprob.nRow, sizeof(int));
+    if (!outRowMap)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+  }
+
+  // Load cone problem data
+  COPTMEX_LOAD(COPT_LoadConeProb(prob, cconeprob.nCol, cconeprob.nRow, cconeprob.nFree, cconeprob.nPositive, 0,
+    cconeprob.nCone, cconeprob.nRotateCone, cconeprob.nPrimalExpCone, cconeprob.nDualExpCone, 0, 0, cconeprob.nPSD,
+    cconeprob.nQObjElem, cconeprob.nObjSense, cconeprob.dObjConst, cconeprob.colObj, cconeprob.qObjRow,
+    cconeprob.qObjCol, cconeprob.qObjElem, cconeprob.colMatBeg, NULL, cconeprob.colMatIdx, cconeprob.colMatElem,
+    cconeprob.rowRhs, NULL, NULL, cconeprob.coneDim, cconeprob.rotateConeDim, NULL, NULL, NULL, NULL, cconeprob.psdDim,
+    cconeprob.colType, NULL, NULL, NULL, outRowMap));
+
+  if (p_nRow != NULL)
+  {
+    *p_nRow = cconeprob.nRow;
+  }
+  if (p_outMap != NULL)
+  {
+    *p_outMap = outRowMap;
+  }
+
+exit_cleanup:
+  if (cconeprob.qObjRow != NULL)
+  {
+    mxFree(cconeprob.qObjRow);
+  }
+  if (cconeprob.qObjCol != NULL)
+  {
+    mxFree(cconeprob.qObjCol);
+  }
+  if (cconeprob.qObjElem != NULL)
+  {
+    mxFree(cconeprob.qObjElem);
+  }
+
+  if (cconeprob.coneDim != NULL)
+  {
+    mxFree(cconeprob.coneDim);
+  }
+  if (cconeprob.rotateConeDim != NULL)
+  {
+    mxFree(cconeprob.rotateConeDim);
+  }
+  if (cconeprob.psdDim != NULL)
+  {
+    mxFree(cconeprob.psdDim);
+  }
+
+  if (cconeprob.colMatBeg != NULL)
+  {
+    mxFree(cconeprob.colMatBeg);
+  }
+  if (cconeprob.colMatIdx != NULL)
+  {
+    mxFree(cconeprob.colMatIdx);
+  }
+
+  if (cconeprob.rowRhs != NULL)
+  {
+    mxFree(cconeprob.rowRhs);
+  }
+  return retcode;
+}
+
+/* Solve cone problem with cone data */
+int COPTMEX_solveConeModel(copt_prob* prob, const mxArray* in_model, const mxArray* in_info,
+                           const mxArray* in_param, mxArray** out_result, int ifRetResult)
+{
+  int retcode = 0;
+  int nRow = 0;
+  int* outRowMap = NULL;
+  coptmex_output output;
+
+  // Check solution output settings before the problem is solved
+  COPTMEX_initOutput(&output);
+  COPTMEX_CALL(COPTMEX_getOutput(in_param, &output));
+
+  // Extract and load problem data
+  COPTMEX_switchPhase(COPTMEX_PHASE_CONVERT);
+  COPTMEX_CALL(COPTMEX_loadConeModel(prob, in_model, &nRow, &outRowMap));
+
+  // Read MIP starts, parameters and tuning settings from info files
+  if (in_info != NULL)
+  {
+    COPTMEX_switchPhase(COPTMEX_PHASE_READ);
+    COPTMEX_CALL(COPTMEX_readInfo(prob, in_info));
+  }
+
+  // Set interrupt, progress and user callbacks of MIP solving, other solves are stopped by watchdog
+  COPTMEX_switchPhase(COPTMEX_PHASE_SOLVE);
+  COPTMEX_CALL(COPTMEX_setCallback(prob));
+
+  // Solve the problem, the result of an interrupted solve is returned as is
+  COPTMEX_CALL(COPTMEX_solveWatched(prob));
+  COPTMEX_CALL(COPTMEX_endProgress(prob));
+
+  // Write solution files and extract and save result
+  COPTMEX_switchPhase(COPTMEX_PHASE_EXTRACT);
+  COPTMEX_CALL(COPTMEX_writeOutput(prob, &output));
+  if (ifRetResult == 1)
+  {
+    COPTMEX_CALL(COPTMEX_getResultFields(prob, output.nFieldMask, out_result));
+
+    if (*out_result != NULL)
+    {
+      mxArray* rowMap = mxCreateDoubleMatrix(nRow, 1, mxREAL);
+      if (rowMap == NULL)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+
+      double* rowMap_data = mxGetDoubles(rowMap);
+      for (int i = 0; i < nRow; ++i)
+      {
+        rowMap_data[i] = outRowMap[i];
+      }
+
+      mxAddField(*out_result, "rowmap");
+      mxSetField(*out_result, 0, "rowmap", rowMap);
+    }
+  }
+
+exit_cleanup:
+  if (outRowMap != NULL)
+  {
+    mxFree(outRowMap);
+  }
+  COPTMEX_freeOutput(&output);
+  return retcode;
+}
+
+/* Count nonzeros of each column in sparse or dense block */
+static void COPTMEX_countBlock(const mxArray* mat, const double* val, int* colCnt)
+{
+  int nrow = (int)mxGetM(mat);
+  int ncol = (int)mxGetN(mat);
+
+  if (mxIsSparse(mat))
+  {
+    mwIndex* jc = mxGetJc(mat);
+    for (int j = 0; j < ncol; ++j)
+    {
+      colCnt[j] += (int)(jc[j + 1] - jc[j]);
+    }
+  }
+  else
+  {
+    for (int j = 0; j < ncol; ++j)
+    {
+      const double* colVal = val + (size_t)j * nrow;
+      for (int i = 0; i < nrow; ++i)
+      {
+        if (colVal[i] != 0.0)
+        {
+          colCnt[j]++;
+        }
+      }
+    }
+  }
+
+  return;
+}
+
+/* Fill nonzeros of sparse or dense block to CSC matrix, shifting row indices */
+static void COPTMEX_fillBlock(
+  const mxArray* mat, const double* val, int rowOff, int* colPos, int* matIdx, double* matElem)
+{
+  int nrow = (int)mxGetM(mat);
+  int ncol = (int)mxGetN(mat);
+
+  if (mxIsSparse(mat))
+  {
+    mwIndex* jc = mxGetJc(mat);
+    mwIndex* ir = mxGetIr(mat);
+    for (int j = 0; j < ncol; ++j)
+    {
+      for (mwIndex k = jc[j]; k < jc[j + 1]; ++k)
+      {
+        matIdx[colPos[j]] = (int)ir[k] + rowOff;
+        matElem[colPos[j]] = val[k];
+        colPos[j]++;
+      }
+    }
+  }
+  else
+  {
+    for (int j = 0; j < ncol; ++j)
+    {
+      const double* colVal = val + (size_t)j * nrow;
+      for (int i = 0; i < nrow; ++i)
+      {
+        if (colVal[i] != 0.0)
+        {
+          matIdx[colPos[j]] = i + rowOff;
+          matElem[colPos[j]] = colVal[i];
+          colPos[j]++;
+        }
+      }
+    }
+  }
+
+  return;
+}
+
+/* Solve linprog/quadprog/intlinprog problem with separate blocks */
+int COPTMEX_solveProg(copt_prob* prob, const mxArray* in_prog, mxArray** out_result, int ifRetResult)
+{
+  int retcode = 0;
+  coptmex_cprob cprob;
+  coptmex_mprog mprog;
+  char msgbuf[COPT_BUFFSIZE];
+
+  int nIneq = 0;
+  int nEq = 0;
+  int* colPos = NULL;
+  double* ineqElem = NULL;
+  double* eqElem = NULL;
+  int* intIdx = NULL;
+  int* qObjRow = NULL;
+  int* qObjCol = NULL;
+  double* qObjElem = NULL;
+  double* colStart = NULL;
+
+  COPTMEX_initCProb(&cprob);
+  COPTMEX_initMProg(&mprog);
+
+  COPTMEX_switchPhase(COPTMEX_PHASE_CHECK);
+
+  mprog.f = mxGetField(in_prog, 0, COPTMEX_PROG_F);
+  mprog.H = mxGetField(in_prog, 0, COPTMEX_PROG_H);
+  mprog.intcon = mxGetField(in_prog, 0, COPTMEX_PROG_INTCON);
+  mprog.Aineq = mxGetField(in_prog, 0, COPTMEX_PROG_AINEQ);
+  mprog.bineq = mxGetField(in_prog, 0, COPTMEX_PROG_BINEQ);
+  mprog.Aeq = mxGetField(in_prog, 0, COPTMEX_PROG_AEQ);
+  mprog.beq = mxGetField(in_prog, 0, COPTMEX_PROG_BEQ);
+  mprog.lb = mxGetField(in_prog, 0, COPTMEX_PROG_LB);
+  mprog.ub = mxGetField(in_prog, 0, COPTMEX_PROG_UB);
+  mprog.x0 = mxGetField(in_prog, 0, COPTMEX_PROG_X0);
+
+  // Empty blocks are the same as absent ones
+  mxArray** blocks[] = {&mprog.f, &mprog.H, &mprog.intcon, &mprog.Aineq, &mprog.bineq, &mprog.Aeq, &mprog.beq,
+    &mprog.lb, &mprog.ub, &mprog.x0};
+  for (int i = 0; i < sizeof(blocks) / sizeof(blocks[0]); ++i)
+  {
+    if (*blocks[i] != NULL && mxIsEmpty(*blocks[i]))
+    {
+      *blocks[i] = NULL;
+    }
+  }
+
+  if (COPTMEX_checkProg(&mprog, &cprob.nCol) == 0)
+  {
+    goto exit_cleanup;
+  }
+
+  COPTMEX_switchPhase(COPTMEX_PHASE_CONVERT);
+
+  nIneq = (mprog.Aineq != NULL) ? (int)mxGetM(mprog.Aineq) : 0;
+  nEq = (mprog.Aeq != NULL) ? (int)mxGetM(mprog.Aeq) : 0;
+  cprob.nRow = nIneq + nEq;
+
+  // Stack 'Aineq' and 'Aeq' into a single CSC matrix
+  cprob.colMatBeg = (int*)COPTMEX_alloc(cprob.nCol + 1, sizeof(int));
+  colPos = (int*)COPTMEX_alloc(COPTMEX_MAX(cprob.nCol, 1), sizeof(int));
+  if (!cprob.colMatBeg || !colPos)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  if (mprog.Aineq != NULL)
+  {
+    ineqElem = COPTMEX_getDoubles(mprog.Aineq);
+    if (!ineqElem)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+    COPTMEX_countBlock(mprog.Aineq, ineqElem, colPos);
+  }
+  if (mprog.Aeq != NULL)
+  {
+    eqElem = COPTMEX_getDoubles(mprog.Aeq);
+    if (!eqElem)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+    COPTMEX_countBlock(mprog.Aeq, eqElem, colPos);
+  }
+
+  for (int j = 0; j < cprob.nCol; ++j)
+  {
+    cprob.colMatBeg[j + 1] = cprob.colMatBeg[j] + colPos[j];
+    colPos[j] = cprob.colMatBeg[j];
+  }
+  cprob.nElem = cprob.colMatBeg[cprob.nCol];
+
+  cprob.colMatIdx = (int*)COPTMEX_alloc(COPTMEX_MAX(cprob.nElem, 1), sizeof(int));
+  cprob.colMatElem = (double*)COPTMEX_alloc(COPTMEX_MAX(cprob.nElem, 1), sizeof(double));
+  if (!cprob.colMatIdx || !cprob.colMatElem)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  if (mprog.Aineq != NULL)
+  {
+    COPTMEX_fillBlock(mprog.Aineq, ineqElem, 0, colPos, cprob.colMatIdx, cprob.colMatElem);
+  }
+  if (mprog.Aeq != NULL)
+  {
+    COPTMEX_fillBlock(mprog.Aeq, eqElem, nIneq, colPos, cprob.colMatIdx, cprob.colMatElem);
+  }
+
+  // 'f'
+  if (mprog.f != NULL)
+  {
+    cprob.colCost = COPTMEX_getDoubles(mprog.f);
+    if (!cprob.colCost)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+  }
+  // 'lb', default to -inf
+  cprob.colLower = (double*)COPTMEX_alloc(COPTMEX_MAX(cprob.nCol, 1), sizeof(double));
+  if (!cprob.colLower)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+  if (mprog.lb != NULL)
+  {
+    COPTMEX_copyDoubles(mprog.lb, cprob.nCol, cprob.colLower);
+    for (int i = 0; i < cprob.nCol; ++i)
+    {
+      if (mxIsInf(cprob.colLower[i]))
+      {
+        if (cprob.colLower[i] > 0)
+        {
+          cprob.colLower[i] = +COPT_INFINITY;
+        }
+        else
+        {
+          cprob.colLower[i] = -COPT_INFINITY;
+        }
+      }
+    }
+  }
+  else
+  {
+    for (int i = 0; i < cprob.nCol; ++i)
+    {
+      cprob.colLower[i] = -COPT_INFINITY;
+    }
+  }
+  // 'ub', left to solver default if absent
+  if (mprog.ub != NULL)
+  {
+    cprob.colUpper = (double*)COPTMEX_alloc(COPTMEX_MAX(cprob.nCol, 1), sizeof(double));
+    if (!cprob.colUpper)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    COPTMEX_copyDoubles(mprog.ub, cprob.nCol, cprob.colUpper);
+    for (int i = 0; i < cprob.nCol; ++i)
+    {
+      if (mxIsInf(cprob.colUpper[i]))
+      {
+        if (cprob.colUpper[i] > 0)
+        {
+          cprob.colUpper[i] = +COPT_INFINITY;
+        }
+        else
+        {
+          cprob.colUpper[i] = -COPT_INFINITY;
+        }
+      }
+    }
+  }
+  // 'intcon'
+  if (mprog.intcon != NULL)
+  {
+    int nIntCol = (int)mxGetNumberOfElements(mprog.intcon);
+
+    cprob.colType = (char*)COPTMEX_alloc(cprob.nCol + 1, sizeof(char));
+    intIdx = (int*)COPTMEX_alloc(COPTMEX_MAX(nIntCol, 1), sizeof(int));
+    if (!cprob.colType || !intIdx)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    for (int i = 0; i < cprob.nCol; ++i)
+    {
+      cprob.colType[i] = COPT_CONTINUOUS;
+    }
+
+    COPTMEX_copyInts(mprog.intcon, nIntCol, 1, intIdx);
+    for (int i = 0; i < nIntCol; ++i)
+    {
+      if (intIdx[i] < 0 || intIdx[i] >= cprob.nCol)
+      {
+        snprintf(msgbuf, COPT_BUFFSIZE, "problem.%s", COPTMEX_PROG_INTCON);
+        COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, msgbuf);
+        goto exit_cleanup;
+      }
+      cprob.colType[intIdx[i]] = COPT_INTEGER;
+    }
+  }
+  // 'bineq' and 'beq'
+  cprob.rowSense = (char*)COPTMEX_alloc(cprob.nRow + 1, sizeof(char));
+  cprob.rowUpper = (double*)COPTMEX_alloc(COPTMEX_MAX(cprob.nRow, 1), sizeof(double));
+  if (!cprob.rowSense || !cprob.rowUpper)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  if (mprog.bineq != NULL)
+  {
+    COPTMEX_copyDoubles(mprog.bineq, nIneq, cprob.rowUpper);
+  }
+  if (mprog.beq != NULL)
+  {
+    COPTMEX_copyDoubles(mprog.beq, nEq, cprob.rowUpper + nIneq);
+  }
+  for (int i = 0; i < cprob.nRow; ++i)
+  {
+    cprob.rowSense[i] = (i < nIneq) ? COPT_LESS_EQUAL : COPT_EQUAL;
+    if (mxIsInf(cprob.rowUpper[i]))
+    {
+      if (cprob.rowUpper[i] > 0)
+      {
+        cprob.rowUpper[i] = +COPT_INFINITY;
+      }
+      else
+      {
+        cprob.rowUpper[i] = -COPT_INFINITY;
+      }
+    }
+  }
+
+  COPTMEX_LOAD(COPT_LoadProb(prob, cprob.nCol, cprob.nRow, COPT_MINIMIZE, 0.0, cprob.colCost, cprob.colMatBeg, NULL,
+    cprob.colMatIdx, cprob.colMatElem, cprob.colType, cprob.colLower, cprob.colUpper, cprob.rowSense, cprob.rowUpper,
+    NULL, NULL, NULL));
+
+  // 'H', objective of quadprog is 0.5 * x' * H * x
+  if (mprog.H != NULL)
+  {
+    double* hElem = NULL;
+    if (mxIsSparse(mprog.H))
+    {
+      cprob.nQElem = (int)mxGetJc(mprog.H)[cprob.nCol];
+    }
+    else
+    {
+      hElem = COPTMEX_getDoubles(mprog.H);
+      if (!hElem)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+      for (size_t i = 0; i < (size_t)cprob.nCol * cprob.nCol; ++i)
+      {
+        if (hElem[i] != 0.0)
+        {
+          cprob.nQElem++;
+        }
+      }
+    }
+
+    qObjRow = (int*)COPTMEX_alloc(COPTMEX_MAX(cprob.nQElem, 1), sizeof(int));
+    qObjCol = (int*)COPTMEX_alloc(COPTMEX_MAX(cprob.nQElem, 1), sizeof(int));
+    qObjElem = (double*)COPTMEX_alloc(COPTMEX_MAX(cprob.nQElem, 1), sizeof(double));
+    if (!qObjRow || !qObjCol || !qObjElem)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    if (mxIsSparse(mprog.H))
+    {
+      COPTMEX_csc2coo(mprog.H, qObjRow, qObjCol, qObjElem);
+    }
+    else
+    {
+      for (int j = 0, iElem = 0; j < cprob.nCol; ++j)
+      {
+        for (int i = 0; i < cprob.nCol; ++i)
+        {
+          double hVal = hElem[(size_t)j * cprob.nCol + i];
+          if (hVal != 0.0)
+          {
+            qObjRow[iElem] = i;
+            qObjCol[iElem] = j;
+            qObjElem[iElem] = hVal;
+            iElem++;
+          }
+        }
+      }
+      COPTMEX_freeDoubles(mprog.H, hElem);
+    }
+
+    for (int i = 0; i < cprob.nQElem; ++i)
+    {
+      qObjElem[i] *= 0.5;
+    }
+
+    COPTMEX_LOAD(COPT_SetQuadObj(prob, cprob.nQElem, qObjRow, qObjCol, qObjElem));
+  }
+
+  // 'x0', used as MIP start for intlinprog
+  if (mprog.x0 != NULL && mprog.intcon != NULL)
+  {
+    colStart = (double*)COPTMEX_alloc(COPTMEX_MAX(cprob.nCol, 1), sizeof(double));
+    if (!colStart)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    COPTMEX_copyDoubles(mprog.x0, cprob.nCol, colStart);
+    for (int i = 0; i < cprob.nCol; ++i)
+    {
+      if (mxIsNaN(colStart[i]))
+      {
+        colStart[i] = COPT_UNDEFINED;
+      }
+    }
+
+    COPTMEX_LOAD(COPT_AddMipStart(prob, cprob.nCol, NULL, colStart));
+  }
+
+  // Set interrupt, progress and user callbacks of MIP solving, other solves are stopped by watchdog
+  COPTMEX_switchPhase(COPTMEX_PHASE_SOLVE);
+  COPTMEX_CALL(COPTMEX_setCallback(prob));
+
+  // Solve the problem, the result of an interrupted solve is returned as is
+  COPTMEX_CALL(COPTMEX_solveWatched(prob));
+  COPTMEX_CALL(COPTMEX_endProgress(prob));
+
+  // Extract and save result, with residuals computed from the stacked data
+  COPTMEX_switchPhase(COPTMEX_PHASE_EXTRACT);
+  if (ifRetResult == 1)
+  {
+    COPTMEX_CALL(COPTMEX_getResult(prob, out_result));
+    COPTMEX_CALL(COPTMEX_getResidual(prob, &cprob, *out_result));
+  }
+
+exit_cleanup:
+  if (cprob.colMatBeg != NULL)
+  {
+    mxFree(cprob.colMatBeg);
+  }
+  if (cprob.colMatIdx != NULL)
+  {
+    mxFree(cprob.colMatIdx);
+  }
+  if (cprob.colMatElem != NULL)
+  {
+    mxFree(cprob.colMatElem);
+  }
+  if (cprob.colCost != NULL)
+  {
+    COPTMEX_freeDoubles(mprog.f, cprob.colCost);
+  }
+  if (cprob.colLower != NULL)
+  {
+    mxFree(cprob.colLower);
+  }
+  if (cprob.colUpper != NULL)
+  {
+    mxFree(cprob.colUpper);
+  }
+  if (cprob.colType != NULL)
+  {
+    mxFree(cprob.colType);
+  }
+  if (cprob.rowSense != NULL)
+  {
+    mxFree(cprob.rowSense);
+  }
+  if (cprob.rowUpper != NULL)
+  {
+    mxFree(cprob.rowUpper);
+  }
+
+  if (colPos != NULL)
+  {
+    mxFree(colPos);
+  }
+  if (ineqElem != NULL)
+  {
+    COPTMEX_freeDoubles(mprog.Aineq, ineqElem);
+  }
+  if (eqElem != NULL)
+  {
+    COPTMEX_freeDoubles(mprog.Aeq, eqElem);
+  }
+  if (intIdx != NULL)
+  {
+    mxFree(intIdx);
+  }
+  if (qObjRow != NULL)
+  {
+    mxFree(qObjRow);
+  }
+  if (qObjCol != NULL)
+  {
+    mxFree(qObjCol);
+  }
+  if (qObjElem != NULL)
+  {
+    mxFree(qObjElem);
+  }
+  if (colStart != NULL)
+  {
+    mxFree(colStart);
+  }
+  return retcode;
+}
+
+/* Re-solve kept problem from its basis, extracting objective with either duals or primal values and slacks */
+static int COPTMEX_resolveKept(copt_prob* prob, int ifPrimal, mxArray** out_result, int ifRetResult)
+{
+  int retcode = 0;
+  int nRow = 0;
+  int nCol = 0;
+  int isMIP = 0;
+  int hasSol = 0;
+  int nStatus = COPT_LPSTATUS_UNSTARTED;
+  int nLpMethod = 0;
+  int ifSetMethod = 0;
+  double dObjVal = 0.0;
+
+  mxArray* result = NULL;
+  mxArray* value = NULL;
+  mxArray* slack = NULL;
+  mxArray* dual = NULL;
+
+  // Simplex warm starts from the kept basis, while barrier would start over,
+  // so dual simplex is used and the method set by user is restored after the solve
+  COPTMEX_CALL(COPT_GetIntParam(prob, COPT_INTPARAM_LPMETHOD, &nLpMethod));
+  COPTMEX_CALL(COPT_SetIntParam(prob, COPT_INTPARAM_LPMETHOD, 1));
+  ifSetMethod = 1;
+
+  COPTMEX_switchPhase(COPTMEX_PHASE_SOLVE);
+  COPTMEX_CALL(COPTMEX_setCallback(prob));
+  COPTMEX_CALL(COPTMEX_solveWatched(prob));
+  COPTMEX_CALL(COPTMEX_endProgress(prob));
+
+  COPTMEX_switchPhase(COPTMEX_PHASE_EXTRACT);
+  if (!ifRetResult)
+  {
+    goto exit_cleanup;
+  }
+
+  // Only the parts needed by the next iteration are extracted
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ROWS, &nRow));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &nCol));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ISMIP, &isMIP));
+  if (isMIP)
+  {
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_MIPSTATUS, &nStatus));
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_HASMIPSOL, &hasSol));
+    if (hasSol)
+    {
+      COPTMEX_CALL(COPT_GetDblAttr(prob, COPT_DBLATTR_BESTOBJ, &dObjVal));
+      if (ifPrimal)
+      {
+        value = mxCreateDoubleMatrix(nCol, 1, mxREAL);
+        if (!value)
+        {
+          retcode = COPT_RETCODE_MEMORY;
+          goto exit_cleanup;
+        }
+        COPTMEX_CALL(COPT_GetSolution(prob, mxGetDoubles(value)));
+      }
+    }
+  }
+  else
+  {
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_LPSTATUS, &nStatus));
+    COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_HASLPSOL, &hasSol));
+    if (hasSol)
+    {
+      COPTMEX_CALL(COPT_GetDblAttr(prob, COPT_DBLATTR_LPOBJVAL, &dObjVal));
+      if (ifPrimal)
+      {
+        value = mxCreateDoubleMatrix(nCol, 1, mxREAL);
+        slack = mxCreateDoubleMatrix(nRow, 1, mxREAL);
+        if (!value || !slack)
+        {
+          retcode = COPT_RETCODE_MEMORY;
+          goto exit_cleanup;
+        }
+        COPTMEX_CALL(COPT_GetLpSolution(prob, mxGetDoubles(value), mxGetDoubles(slack), NULL, NULL));
+      }
+      else
+      {
+        dual = mxCreateDoubleMatrix(nRow, 1, mxREAL);
+        if (!dual)
+        {
+          retcode = COPT_RETCODE_MEMORY;
+          goto exit_cleanup;
+        }
+        COPTMEX_CALL(COPT_GetLpSolution(prob, NULL, NULL, mxGetDoubles(dual), NULL));
+      }
+    }
+  }
+
+  result = mxCreateStructMatrix(1, 1, 0, NULL);
+  if (!result)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  // 'status'
+  mxAddField(result, COPTMEX_RESULT_STATUS);
+  mxSetField(result, 0, COPTMEX_RESULT_STATUS, mxCreateString(COPTMEX_statusInt2Str(nStatus)));
+
+  if (hasSol)
+  {
+    // 'objval'
+    mxAddField(result, COPTMEX_RESULT_OBJVAL);
+    mxSetField(result, 0, COPTMEX_RESULT_OBJVAL, mxCreateDoubleScalar(dObjVal));
+  }
+  if (value != NULL)
+  {
+    // 'x'
+    mxAddField(result, COPTMEX_RESULT_VALUE);
+    mxSetField(result, 0, COPTMEX_RESULT_VALUE, value);
+    value = NULL;
+  }
+  if (slack != NULL)
+  {
+    // 'slack'
+    mxAddField(result, COPTMEX_RESULT_SLACK);
+    mxSetField(result, 0, COPTMEX_RESULT_SLACK, slack);
+    slack = NULL;
+  }
+  if (dual != NULL)
+  {
+    // 'pi'
+    mxAddField(result, COPTMEX_RESULT_DUAL);
+    mxSetField(result, 0, COPTMEX_RESULT_DUAL, dual);
+    dual = NULL;
+  }
+
+  *out_result = result;
+
+exit_cleanup:
+  if (ifSetMethod)
+  {
+    COPT_SetIntParam(prob, COPT_INTPARAM_LPMETHOD, nLpMethod);
+  }
+  if (value != NULL)
+  {
+    mxDestroyArray(value);
+  }
+  if (slack != NULL)
+  {
+    mxDestroyArray(slack);
+  }
+  if (dual != NULL)
+  {
+    mxDestroyArray(dual);
+  }
+
+  return retcode;
+}
+
+/* Append columns to kept problem and re-solve it from the current basis */
+int COPTMEX_addCols(copt_prob* prob, const mxArray* in_obj, const mxArray* in_A, const mxArray* in_lb,
+                    const mxArray* in_ub, mxArray** out_result, int ifRetResult)
+{
+  int retcode = 0;
+  int nAddCol = 0;
+
+  double* colCost = NULL;
+  double* colElem = NULL;
+  int* colMatBeg = NULL;
+  int* colMatIdx = NULL;
+  double* colMatElem = NULL;
+  double* colLower = NULL;
+  double* colUpper = NULL;
+  int* colPos = NULL;
+
+  if (COPTMEX_checkAddCols(prob, in_obj, in_A, in_lb, in_ub, &nAddCol) == 0)
+  {
+    goto exit_cleanup;
+  }
+
+  // Convert new columns to CSC matrix, only nonzeros of them are passed to COPT
+  colCost = COPTMEX_getDoubles(in_obj);
+  colElem = COPTMEX_getDoubles(in_A);
+  colMatBeg = (int*)mxCalloc(nAddCol + 1, sizeof(int));
+  colPos = (int*)mxCalloc(COPTMEX_MAX(nAddCol, 1), sizeof(int));
+  if ((!colCost && nAddCol > 0) || (!colElem && !mxIsEmpty(in_A)) || !colMatBeg || !colPos)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  COPTMEX_countBlock(in_A, colElem, colPos);
+  for (int j = 0; j < nAddCol; ++j)
+  {
+    colMatBeg[j + 1] = colMatBeg[j] + colPos[j];
+    colPos[j] = colMatBeg[j];
+  }
+
+  colMatIdx = (int*)mxCalloc(COPTMEX_MAX(colMatBeg[nAddCol], 1), sizeof(int));
+  colMatElem = (double*)mxCalloc(COPTMEX_MAX(colMatBeg[nAddCol], 1), sizeof(double));
+  if (!colMatIdx || !colMatElem)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+  COPTMEX_fillBlock(in_A, colElem, 0, colPos, colMatIdx, colMatElem);
+
+  // 'lb' and 'ub', default to 0 and +inf
+  if (in_lb != NULL && !mxIsEmpty(in_lb))
+  {
+    colLower = (double*)mxCalloc(COPTMEX_MAX(nAddCol, 1), sizeof(double));
+    if (!colLower)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+    COPTMEX_copyDoubles(in_lb, nAddCol, colLower);
+    for (int i = 0; i < nAddCol; ++i)
+    {
+      if (mxIsInf(colLower[i]))
+      {
+        colLower[i] = (colLower[i] > 0 ? COPT_INFINITY : -COPT_INFINITY);
+      }
+    }
+  }
+  if (in_ub != NULL && !mxIsEmpty(in_ub))
+  {
+    colUpper = (double*)mxCalloc(COPTMEX_MAX(nAddCol, 1), sizeof(double));
+    if (!colUpper)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+    COPTMEX_copyDoubles(in_ub, nAddCol, colUpper);
+    for (int i = 0; i < nAddCol; ++i)
+    {
+      if (mxIsInf(colUpper[i]))
+      {
+        colUpper[i] = (colUpper[i] > 0 ? COPT_INFINITY : -COPT_INFINITY);
+      }
+    }
+  }
+
+  // COPT keeps the basis of existing columns, new columns start nonbasic at a bound
+  COPTMEX_switchPhase(COPTMEX_PHASE_LOAD);
+  COPTMEX_CALL(COPT_AddCols(prob, nAddCol, colCost, colMatBeg, NULL, colMatIdx, colMatElem, NULL, colLower, colUpper,
+                            NULL));
+
+  // The old basis stays primal feasible after adding columns, so simplex warm starts from it
+  COPTMEX_CALL(COPTMEX_resolveKept(prob, 0, out_result, ifRetResult));
+
+exit_cleanup:
+  COPTMEX_freeDoubles(in_obj, colCost);
+  COPTMEX_freeDoubles(in_A, colElem);
+  mxFree(colMatBeg);
+  mxFree(colMatIdx);
+  mxFree(colMatElem);
+  mxFree(colLower);
+  mxFree(colUpper);
+  mxFree(colPos);
+
+  return retcode;
+}
+
+/* Count nonzeros of each row in sparse or dense block */
+static void COPTMEX_countRows(const mxArray* mat, const double* val, int* rowCnt)
+{
+  int nrow = (int)mxGetM(mat);
+  int ncol = (int)mxGetN(mat);
+
+  if (mxIsSparse(mat))
+  {
+    mwIndex* jc = mxGetJc(mat);
+    mwIndex* ir = mxGetIr(mat);
+    for (mwIndex k = 0; k < jc[ncol]; ++k)
+    {
+      rowCnt[ir[k]]++;
+    }
+  }
+  else
+  {
+    for (int j = 0; j < ncol; ++j)
+    {
+      const double* colVal = val + (size_t)j * nrow;
+      for (int i = 0; i < nrow; ++i)
+      {
+        if (colVal[i] != 0.0)
+        {
+          rowCnt[i]++;
+        }
+      }
+    }
+  }
+
+  return;
+}
+
+/* Fill nonzeros of sparse or dense block to CSR matrix */
+static void COPTMEX_fillRows(const mxArray* mat, const double* val, int* rowPos, int* matIdx, double* matElem)
+{
+  int nrow = (int)mxGetM(mat);
+  int ncol = (int)mxGetN(mat);
+
+  if (mxIsSparse(mat))
+  {
+    mwIndex* jc = mxGetJc(mat);
+    mwIndex* ir = mxGetIr(mat);
+    for (int j = 0; j < ncol; ++j)
+    {
+      for (mwIndex k = jc[j]; k < jc[j + 1]; ++k)
+      {
+        matIdx[rowPos[ir[k]]] = j;
+        matElem[rowPos[ir[k]]] = val[k];
+        rowPos[ir[k]]++;
+      }
+    }
+  }
+  else
+  {
+    for (int j = 0; j < ncol; ++j)
+    {
+      const double* colVal = val + (size_t)j * nrow;
+      for (int i = 0; i < nrow; ++i)
+      {
+        if (colVal[i] != 0.0)
+        {
+          matIdx[rowPos[i]] = j;
+          matElem[rowPos[i]] = colVal[i];
+          rowPos[i]++;
+        }
+      }
+    }
+  }
+
+  return;
+}
+
+/* Append rows to kept problem and re-solve it from the current basis */
+int COPTMEX_addRows(copt_prob* prob, const mxArray* in_A, const mxArray* in_sense, const mxArray* in_rhs,
+                    mxArray** out_result, int ifRetResult)
+{
+  int retcode = 0;
+  int nAddRow = 0;
+
+  double* rowElem = NULL;
+  int* rowMatBeg = NULL;
+  int* rowMatIdx = NULL;
+  double* rowMatElem = NULL;
+  char* rowSense = NULL;
+  double* rowBound = NULL;
+  int* rowPos = NULL;
+
+  if (COPTMEX_checkAddRows(prob, in_A, in_sense, in_rhs, &nAddRow) == 0)
+  {
+    goto exit_cleanup;
+  }
+
+  // Convert new rows to CSR matrix, only nonzeros of them are passed to COPT
+  rowElem = COPTMEX_getDoubles(in_A);
+  rowMatBeg = (int*)mxCalloc(nAddRow + 1, sizeof(int));
+  rowPos = (int*)mxCalloc(COPTMEX_MAX(nAddRow, 1), sizeof(int));
+  rowSense = (char*)mxCalloc(nAddRow + 1, sizeof(char));
+  rowBound = (double*)mxCalloc(COPTMEX_MAX(nAddRow, 1), sizeof(double));
+  if ((!rowElem && !mxIsEmpty(in_A)) || !rowMatBeg || !rowPos || !rowSense || !rowBound)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  COPTMEX_countRows(in_A, rowElem, rowPos);
+  for (int i = 0; i < nAddRow; ++i)
+  {
+    rowMatBeg[i + 1] = rowMatBeg[i] + rowPos[i];
+    rowPos[i] = rowMatBeg[i];
+  }
+
+  rowMatIdx = (int*)mxCalloc(COPTMEX_MAX(rowMatBeg[nAddRow], 1), sizeof(int));
+  rowMatElem = (double*)mxCalloc(COPTMEX_MAX(rowMatBeg[nAddRow], 1), sizeof(double));
+  if (!rowMatIdx || !rowMatElem)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+  COPTMEX_fillRows(in_A, rowElem, rowPos, rowMatIdx, rowMatElem);
+
+  // 'sense' and 'rhs'
+  mxGetString(in_sense, rowSense, nAddRow + 1);
+  for (int i = 0; i < nAddRow; ++i)
+  {
+    if (rowSense[i] != COPT_LESS_EQUAL && rowSense[i] != COPT_GREATER_EQUAL && rowSense[i] != COPT_EQUAL)
+    {
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, "sense");
+      goto exit_cleanup;
+    }
+  }
+  COPTMEX_copyDoubles(in_rhs, nAddRow, rowBound);
+  for (int i = 0; i < nAddRow; ++i)
+  {
+    if (mxIsInf(rowBound[i]))
+    {
+      rowBound[i] = (rowBound[i] > 0 ? COPT_INFINITY : -COPT_INFINITY);
+    }
+  }
+
+  // COPT keeps the basis of existing rows, new rows start with their slacks basic
+  COPTMEX_switchPhase(COPTMEX_PHASE_LOAD);
+  COPTMEX_CALL(COPT_AddRows(prob, nAddRow, rowMatBeg, NULL, rowMatIdx, rowMatElem, rowSense, rowBound, NULL, NULL));
+
+  // The old basis stays dual feasible after adding rows, so dual simplex warm starts from it
+  COPTMEX_CALL(COPTMEX_resolveKept(prob, 1, out_result, ifRetResult));
+
+exit_cleanup:
+  COPTMEX_freeDoubles(in_A, rowElem);
+  mxFree(rowMatBeg);
+  mxFree(rowMatIdx);
+  mxFree(rowMatElem);
+  mxFree(rowSense);
+  mxFree(rowBound);
+  mxFree(rowPos);
+
+  return retcode;
+}
+
+/* Delete rows of kept problem */
+int COPTMEX_delRows(copt_prob* prob, const mxArray* in_rows)
+{
+  int retcode = 0;
+  int nRow = 0;
+  int nDelRow = 0;
+  int* rowList = NULL;
+
+  if (!COPTMEX_isNumData(in_rows) || mxIsSparse(in_rows))
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "rows");
+    goto exit_cleanup;
+  }
+
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ROWS, &nRow));
+  nDelRow = (int)mxGetNumberOfElements(in_rows);
+  if (nDelRow == 0)
+  {
+    goto exit_cleanup;
+  }
+
+  // Rows are given by 1-based indices, as returned by find
+  rowList = (int*)mxCalloc(nDelRow, sizeof(int));
+  if (!rowList)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+  COPTMEX_copyInts(in_rows, nDelRow, 1, rowList);
+  for (int i = 0; i < nDelRow; ++i)
+  {
+    if (rowList[i] < 0 || rowList[i] >= nRow)
+    {
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_DATA, "rows");
+      goto exit_cleanup;
+    }
+  }
+
+  COPTMEX_CALL(COPT_DelRows(prob, nDelRow, rowList));
+
+exit_cleanup:
+  mxFree(rowList);
+  return retcode;
+}
+
+/* Free converted model data, whose matrix and cost may point into the model struct */
+void COPTMEX_freeModelData(coptmex_cprob* cprob, const mxArray* in_model)
+{
+  mxArray* A = in_model != NULL ? mxGetField(in_model, 0, COPTMEX_MODEL_A) : NULL;
+  mxArray* obj = in_model != NULL ? mxGetField(in_model, 0, COPTMEX_MODEL_OBJ) : NULL;
+
+  if (cprob->colMatBeg != NULL)
+  {
+    mxFree(cprob->colMatBeg);
+  }
+  if (cprob->colMatIdx != NULL)
+  {
+    mxFree(cprob->colMatIdx);
+  }
+  if (cprob->colMatElem != NULL)
+  {
+    COPTMEX_freeDoubles(A, cprob->colMatElem);
+  }
+  if (cprob->colCost != NULL)
+  {
+    COPTMEX_freeDoubles(obj, cprob->colCost);
+  }
+  if (cprob->colLower != NULL)
+  {
+    mxFree(cprob->colLower);
+  }
+  if (cprob->colUpper != NULL)
+  {
+    mxFree(cprob->colUpper);
+  }
+  if (cprob->colType != NULL)
+  {
+    COPTMEX_freeString(&cprob->colType);
+  }
+  if (cprob->colNames != NULL)
+  {
+    for (int i = 0; i < cprob->nCol; ++i)
+    {
+      if (cprob->colNames[i] != NULL)
+      {
+        COPTMEX_freeString(&cprob->colNames[i]);
+      }
+    }
+    mxFree(cprob->colNames);
+  }
+
+  if (cprob->rowLower != NULL)
+  {
+    mxFree(cprob->rowLower);
+  }
+  if (cprob->rowUpper != NULL)
+  {
+    mxFree(cprob->rowUpper);
+  }
+  if (cprob->rowSense != NULL)
+  {
+    COPTMEX_freeString(&cprob->rowSense);
+  }
+  if (cprob->rowNames != NULL)
+  {
+    for (int i = 0; i < cprob->nRow; ++i)
+    {
+      if (cprob->rowNames[i] != NULL)
+      {
+        COPTMEX_freeString(&cprob->rowNames[i]);
+      }
+    }
+    mxFree(cprob->rowNames);
+  }
+
+  if (cprob->affMatBeg != NULL)
+  {
+    mxFree(cprob->affMatBeg);
+  }
+  if (cprob->affMatCnt != NULL)
+  {
+    mxFree(cprob->affMatCnt);
+  }
+  if (cprob->affMatIdx != NULL)
+  {
+    mxFree(cprob->affMatIdx);
+  }
+  if (cprob->affMatElem != NULL)
+  {
+    mxFree(cprob->affMatElem);
+  }
+  return;
+}
+
+/* Extract and load data to problem, handing converted data over to caller if asked */
+int COPTMEX_loadModelData(copt_prob* prob, const mxArray* in_model, coptmex_cprob* out_cprob)
+{
+  int retcode = 0;
+  coptmex_cprob cprob;
+  coptmex_mprob mprob;
+
+  COPTMEX_initCProb(&cprob);
+  COPTMEX_initMProb(&mprob);
+
+  COPTMEX_switchPhase(COPTMEX_PHASE_CHECK);
+
+  mprob.objsen = mxGetField(in_model, 0, COPTMEX_MODEL_OBJSEN);
+  mprob.objcon = mxGetField(in_model, 0, COPTMEX_MODEL_OBJCON);
+  mprob.A = mxGetField(in_model, 0, COPTMEX_MODEL_A);
+  mprob.obj = mxGetField(in_model, 0, COPTMEX_MODEL_OBJ);
+  mprob.lb = mxGetField(in_model, 0, COPTMEX_MODEL_LB);
+  mprob.ub = mxGetField(in_model, 0, COPTMEX_MODEL_UB);
+  mprob.vtype = mxGetField(in_model, 0, COPTMEX_MODEL_VTYPE);
+  mprob.varnames = mxGetField(in_model, 0, COPTMEX_MODEL_VARNAME);
+  mprob.sense = mxGetField(in_model, 0, COPTMEX_MODEL_SENSE);
+  mprob.lhs = mxGetField(in_model, 0, COPTMEX_MODEL_LHS);
+  mprob.rhs = mxGetField(in_model, 0, COPTMEX_MODEL_RHS);
+  mprob.constrnames = mxGetField(in_model, 0, COPTMEX_MODEL_CONNAME);
+
+  mprob.sos = mxGetField(in_model, 0, COPTMEX_MODEL_SOS);
+  mprob.indicator = mxGetField(in_model, 0, COPTMEX_MODEL_INDICATOR);
+
+  mprob.cone = mxGetField(in_model, 0, COPTMEX_MODEL_CONE);
+  mprob.expcone = mxGetField(in_model, 0, COPTMEX_MODEL_EXPCONE);
+  mprob.affcone = mxGetField(in_model, 0, COPTMEX_MODEL_AFFCONE);
+
+  mprob.qobj = mxGetField(in_model, 0, COPTMEX_MODEL_QUADOBJ);
+  mprob.quadcon = mxGetField(in_model, 0, COPTMEX_MODEL_QUADCON);
+
+  mprob.varbasis = mxGetField(in_model, 0, COPTMEX_RESULT_VARBASIS);
+  mprob.constrbasis = mxGetField(in_model, 0, COPTMEX_RESULT_CONBASIS);
+
+  mprob.value = mxGetField(in_model, 0, COPTMEX_RESULT_VALUE);
+  mprob.slack = mxGetField(in_model, 0, COPTMEX_RESULT_SLACK);
+  mprob.dual = mxGetField(in_model, 0, COPTMEX_RESULT_DUAL);
+  mprob.redcost = mxGetField(in_model, 0, COPTMEX_RESULT_REDCOST);
+
+  mprob.mipstart = mxGetField(in_model, 0, COPTMEX_ADVINFO_MIPSTART);
+
+  if (COPTMEX_checkModel(&mprob) == 0)
+  {
+    goto exit_cleanup;
+  }
+
+  COPTMEX_switchPhase(COPTMEX_PHASE_CONVERT);
+
+  // 'objsen'
+  if (mprob.objsen != NULL)
+  {
+    COPTMEX_CALL(COPTMEX_getObjsen(mprob.objsen, &cprob.nObjSen));
+  }
+  // 'objcon'
+  if (mprob.objcon != NULL)
+  {
+    cprob.dObjConst = mxGetScalar(mprob.objcon);
+  }
+  // 'A'
+  if (mprob.A != NULL)
+  {
+    cprob.nRow = mxGetM(mprob.A);
+    cprob.nCol = mxGetN(mprob.A);
+    cprob.nElem = mxGetNzmax(mprob.A);
+    cprob.colMatBeg = (int*)COPTMEX_alloc(cprob.nCol + 1, sizeof(int));
+    cprob.colMatIdx = (int*)COPTMEX_alloc(cprob.nElem, sizeof(int));
+    if (!cprob.colMatBeg || !cprob.colMatIdx)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    mwIndex* colMatBeg_data = mxGetJc(mprob.A);
+    mwIndex* colMatIdx_data = mxGetIr(mprob.A);
+    for (int i = 0; i < cprob.nCol + 1; ++i)
+    {
+      cprob.colMatBeg[i] = (int)colMatBeg_data[i];
+    }
+    for (int i = 0; i < cprob.nElem; ++i)
+    {
+      cprob.colMatIdx[i] = (int)colMatIdx_data[i];
+    }
+
+    cprob.colMatElem = COPTMEX_getDoubles(mprob.A);
+    if (!cprob.colMatElem)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+  }
+  // 'obj'
+  if (mprob.obj != NULL)
+  {
+    cprob.colCost = COPTMEX_getDoubles(mprob.obj);
+    if (!cprob.colCost)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+  }
+  // 'lb'
+  if (mprob.lb != NULL)
+  {
+    cprob.colLower = (double*)COPTMEX_alloc(COPTMEX_MAX(cprob.nCol, 1), sizeof(double));
+    if (!cprob.colLower)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    COPTMEX_copyDoubles(mprob.lb, cprob.nCol, cprob.colLower);
+    for (int i = 0; i < cprob.nCol; ++i)
+    {
+      if (mxIsInf(cprob.colLower[i]))
+      {
+        if (cprob.colLower[i] > 0)
+        {
+          cprob.colLower[i] = +COPT_INFINITY;
+        }
+        else
+        {
+          cprob.colLower[i] = -COPT_INFINITY;
+        }
+      }
+    }
+  }
+  // 'ub'
+  if (mprob.ub != NULL)
+  {
+    cprob.colUpper = (double*)COPTMEX_alloc(COPTMEX_MAX(cprob.nCol, 1), sizeof(double));
+    if (!cprob.colUpper)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    COPTMEX_copyDoubles(mprob.ub, cprob.nCol, cprob.colUpper);
+    for (int i = 0; i < cprob.nCol; ++i)
+    {
+      if (mxIsInf(cprob.colUpper[i]))
+      {
+        if (cprob.colUpper[i] > 0)
+        {
+          cprob.colUpper[i] = +COPT_INFINITY;
+        }
+        else
+        {
+          cprob.colUpper[i] = -COPT_INFINITY;
+        }
+      }
+    }
+  }
+  // 'vtype'
   if (mprob.vtype != NULL)
   {
     if (mxGetNumberOfElements(mprob.vtype) == cprob.nCol)
@@ -2481,7 +6367,7 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       char* vtype = NULL;
       COPTMEX_CALL(COPTMEX_getString(mprob.vtype, &vtype));
 
-      cprob.colType = (char*)mxCalloc(cprob.nCol + 1, sizeof(char));
+      cprob.colType = (char*)COPTMEX_alloc(cprob.nCol + 1, sizeof(char));
       if (!cprob.colType)
       {
         retcode = COPT_RETCODE_MEMORY;
@@ -2496,7 +6382,7 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
   // 'varnames'
   if (mprob.varnames != NULL)
   {
-    cprob.colNames = (char**)mxCalloc(cprob.nCol, sizeof(char*));
+    cprob.colNames = (char**)COPTMEX_alloc(cprob.nCol, sizeof(char*));
     for (int i = 0; i < cprob.nCol; ++i)
     {
       mxArray* nameCell = mxGetCell(mprob.varnames, i);
@@ -2506,15 +6392,20 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
   // 'sense', 'lhs' and 'rhs'
   if (mprob.sense == NULL)
   {
-    cprob.rowLower = (double*)mxCalloc(cprob.nRow, sizeof(double));
-    cprob.rowUpper = (double*)mxCalloc(cprob.nRow, sizeof(double));
+    cprob.rowLower = (double*)COPTMEX_alloc(COPTMEX_MAX(cprob.nRow, 1), sizeof(double));
+    cprob.rowUpper = (double*)COPTMEX_alloc(COPTMEX_MAX(cprob.nRow, 1), sizeof(double));
+    if (!cprob.rowLower || !cprob.rowUpper)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
 
-    double* rowLower = mxGetDoubles(mprob.lhs);
+    COPTMEX_copyDoubles(mprob.lhs, cprob.nRow, cprob.rowLower);
     for (int i = 0; i < cprob.nRow; ++i)
     {
-      if (mxIsInf(rowLower[i]))
+      if (mxIsInf(cprob.rowLower[i]))
       {
-        if (rowLower[i] > 0)
+        if (cprob.rowLower[i] > 0)
         {
           cprob.rowLower[i] = +COPT_INFINITY;
         }
@@ -2523,18 +6414,14 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
           cprob.rowLower[i] = -COPT_INFINITY;
         }
       }
-      else
-      {
-        cprob.rowLower[i] = rowLower[i];
-      }
     }
 
-    double* rowUpper = mxGetDoubles(mprob.rhs);
+    COPTMEX_copyDoubles(mprob.rhs, cprob.nRow, cprob.rowUpper);
     for (int i = 0; i < cprob.nRow; ++i)
     {
-      if (mxIsInf(rowUpper[i]))
+      if (mxIsInf(cprob.rowUpper[i]))
       {
-        if (rowUpper[i] > 0)
+        if (cprob.rowUpper[i] > 0)
         {
           cprob.rowUpper[i] = +COPT_INFINITY;
         }
@@ -2543,10 +6430,6 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
           cprob.rowUpper[i] = -COPT_INFINITY;
         }
       }
-      else
-      {
-        cprob.rowUpper[i] = rowUpper[i];
-      }
     }
   }
   else
@@ -2560,7 +6443,7 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       char* rsense = NULL;
       COPTMEX_CALL(COPTMEX_getString(mprob.sense, &rsense));
 
-      cprob.rowSense = (char*)mxCalloc(cprob.nRow + 1, sizeof(char));
+      cprob.rowSense = (char*)COPTMEX_alloc(cprob.nRow + 1, sizeof(char));
       if (!cprob.rowSense)
       {
         retcode = COPT_RETCODE_MEMORY;
@@ -2572,14 +6455,19 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       }
     }
 
-    cprob.rowUpper = (double*)mxCalloc(cprob.nRow, sizeof(double));
+    cprob.rowUpper = (double*)COPTMEX_alloc(COPTMEX_MAX(cprob.nRow, 1), sizeof(double));
+    if (!cprob.rowUpper)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
 
-    double* rowUpper = mxGetDoubles(mprob.rhs);
+    COPTMEX_copyDoubles(mprob.rhs, cprob.nRow, cprob.rowUpper);
     for (int i = 0; i < cprob.nRow; ++i)
     {
-      if (mxIsInf(rowUpper[i]))
+      if (mxIsInf(cprob.rowUpper[i]))
       {
-        if (rowUpper[i] > 0)
+        if (cprob.rowUpper[i] > 0)
         {
           cprob.rowUpper[i] = +COPT_INFINITY;
         }
@@ -2588,16 +6476,12 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
           cprob.rowUpper[i] = -COPT_INFINITY;
         }
       }
-      else
-      {
-        cprob.rowUpper[i] = rowUpper[i];
-      }
     }
   }
   // 'constrnames'
   if (mprob.constrnames != NULL)
   {
-    cprob.rowNames = (char**)mxCalloc(cprob.nRow, sizeof(char*));
+    cprob.rowNames = (char**)COPTMEX_alloc(cprob.nRow, sizeof(char*));
     for (int i = 0; i < cprob.nRow; ++i)
     {
       mxArray* namecell = mxGetCell(mprob.constrnames, i);
@@ -2608,13 +6492,13 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
   // Load problem data to COPT problem
   if (cprob.rowSense == NULL)
   {
-    COPTMEX_CALL(COPT_LoadProb(prob, cprob.nCol, cprob.nRow, cprob.nObjSen, cprob.dObjConst, cprob.colCost,
+    COPTMEX_LOAD(COPT_LoadProb(prob, cprob.nCol, cprob.nRow, cprob.nObjSen, cprob.dObjConst, cprob.colCost,
       cprob.colMatBeg, NULL, cprob.colMatIdx, cprob.colMatElem, cprob.colType, cprob.colLower, cprob.colUpper, NULL,
       cprob.rowLower, cprob.rowUpper, cprob.colNames, cprob.rowNames));
   }
   else
   {
-    COPTMEX_CALL(COPT_LoadProb(prob, cprob.nCol, cprob.nRow, cprob.nObjSen, cprob.dObjConst, cprob.colCost,
+    COPTMEX_LOAD(COPT_LoadProb(prob, cprob.nCol, cprob.nRow, cprob.nObjSen, cprob.dObjConst, cprob.colCost,
       cprob.colMatBeg, NULL, cprob.colMatIdx, cprob.colMatElem, cprob.colType, cprob.colLower, cprob.colUpper,
       cprob.rowSense, cprob.rowUpper, NULL, cprob.colNames, cprob.rowNames));
   }
@@ -2631,28 +6515,33 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       int sosType = (int)mxGetScalar(sostype_m);
       int sosMatBeg = 0;
       int sosMatCnt = (int)mxGetNumberOfElements(sosvars_m);
-      int* sosMatIdx = (int*)mxCalloc(sosMatCnt, sizeof(int));
+      int* sosMatIdx = (int*)COPTMEX_alloc(sosMatCnt, sizeof(int));
       if (!sosMatIdx)
       {
         retcode = COPT_RETCODE_MEMORY;
         goto exit_cleanup;
       }
 
-      double* sosvars_data = mxGetDoubles(sosvars_m);
-      for (int i = 0; i < sosMatCnt; ++i)
-      {
-        sosMatIdx[i] = (int)sosvars_data[i] - 1;
-      }
+      COPTMEX_copyInts(sosvars_m, sosMatCnt, 1, sosMatIdx);
 
       double* sosMatWt = NULL;
       if (soswgts_m != NULL)
       {
-        sosMatWt = mxGetDoubles(soswgts_m);
+        sosMatWt = COPTMEX_getDoubles(soswgts_m);
+        if (!sosMatWt)
+        {
+          retcode = COPT_RETCODE_MEMORY;
+          goto exit_cleanup;
+        }
       }
 
-      COPTMEX_CALL(COPT_AddSOSs(prob, 1, &sosType, &sosMatBeg, &sosMatCnt, sosMatIdx, sosMatWt));
+      COPTMEX_LOAD(COPT_AddSOSs(prob, 1, &sosType, &sosMatBeg, &sosMatCnt, sosMatIdx, sosMatWt));
 
       mxFree(sosMatIdx);
+      if (soswgts_m != NULL)
+      {
+        COPTMEX_freeDoubles(soswgts_m, sosMatWt);
+      }
     }
   }
 
@@ -2676,7 +6565,7 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       if (mxIsSparse(indicA))
       {
         nRowMatCnt = mxGetNzmax(indicA);
-        rowMatIdx = (int*)mxCalloc(nRowMatCnt, sizeof(int));
+        rowMatIdx = (int*)COPTMEX_alloc(nRowMatCnt, sizeof(int));
         if (!rowMatIdx)
         {
           retcode = COPT_RETCODE_MEMORY;
@@ -2687,11 +6576,21 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
         {
           rowMatIdx[i] = rowMatIdx_data[i];
         }
-        rowMatElem = mxGetDoubles(indicA);
+        rowMatElem = COPTMEX_getDoubles(indicA);
+        if (!rowMatElem)
+        {
+          retcode = COPT_RETCODE_MEMORY;
+          goto exit_cleanup;
+        }
       }
       else
       {
-        double* rowMatElem_data = mxGetDoubles(indicA);
+        double* rowMatElem_data = COPTMEX_getDoubles(indicA);
+        if (!rowMatElem_data)
+        {
+          retcode = COPT_RETCODE_MEMORY;
+          goto exit_cleanup;
+        }
         for (int i = 0; i < mxGetNumberOfElements(indicA); ++i)
         {
           if (rowMatElem_data[i] != 0)
@@ -2699,8 +6598,8 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
             ++nRowMatCnt;
           }
         }
-        rowMatIdx = (int*)mxCalloc(nRowMatCnt, sizeof(int));
-        rowMatElem = (double*)mxCalloc(nRowMatCnt, sizeof(double));
+        rowMatIdx = (int*)COPTMEX_alloc(nRowMatCnt, sizeof(int));
+        rowMatElem = (double*)COPTMEX_alloc(nRowMatCnt, sizeof(double));
         if (!rowMatIdx || !rowMatElem)
         {
           retcode = COPT_RETCODE_MEMORY;
@@ -2715,6 +6614,7 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
             iElem++;
           }
         }
+        COPTMEX_freeDoubles(indicA, rowMatElem_data);
       }
 
       char cRowSense[2];
@@ -2733,7 +6633,7 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
         }
       }
 
-      COPTMEX_CALL(
+      COPTMEX_LOAD(
         COPT_AddIndicator(prob, binColIdx, binColVal, nRowMatCnt, rowMatIdx, rowMatElem, cRowSense[0], dRowBound));
 
       mxFree(rowMatIdx);
@@ -2741,6 +6641,10 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       {
         mxFree(rowMatElem);
       }
+      else
+      {
+        COPTMEX_freeDoubles(indicA, rowMatElem);
+      }
     }
   }
 
@@ -2755,20 +6659,16 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       int coneType = (int)mxGetScalar(conetype_m);
       int coneBeg = 0;
       int coneCnt = (int)mxGetNumberOfElements(conevars_m);
-      int* coneIdx = (int*)mxCalloc(coneCnt, sizeof(int));
+      int* coneIdx = (int*)COPTMEX_alloc(coneCnt, sizeof(int));
       if (!coneIdx)
       {
         retcode = COPT_RETCODE_MEMORY;
         goto exit_cleanup;
       }
 
-      double* conevars_data = mxGetDoubles(conevars_m);
-      for (int i = 0; i < coneCnt; ++i)
-      {
-        coneIdx[i] = (int)conevars_data[i] - 1;
-      }
+      COPTMEX_copyInts(conevars_m, coneCnt, 1, coneIdx);
 
-      COPTMEX_CALL(COPT_AddCones(prob, 1, &coneType, &coneBeg, &coneCnt, coneIdx));
+      COPTMEX_LOAD(COPT_AddCones(prob, 1, &coneType, &coneBeg, &coneCnt, coneIdx));
 
       mxFree(coneIdx);
     }
@@ -2783,20 +6683,16 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       mxArray* conevars_m = mxGetField(mprob.expcone, i, COPTMEX_MODEL_EXPCONEVARS);
 
       int coneType = (int)mxGetScalar(conetype_m);
-      int* coneIdx = (int*)mxCalloc(3, sizeof(int));
+      int* coneIdx = (int*)COPTMEX_alloc(3, sizeof(int));
       if (!coneIdx)
       {
         retcode = COPT_RETCODE_MEMORY;
         goto exit_cleanup;
       }
 
-      double* conevars_data = mxGetDoubles(conevars_m);
-      for (int i = 0; i < 3; ++i)
-      {
-        coneIdx[i] = (int)conevars_data[i] - 1;
-      }
+      COPTMEX_copyInts(conevars_m, 3, 1, coneIdx);
 
-      COPTMEX_CALL(COPT_AddExpCones(prob, 1, &coneType, coneIdx));
+      COPTMEX_LOAD(COPT_AddExpCones(prob, 1, &coneType, coneIdx));
 
       mxFree(coneIdx);
     }
@@ -2815,10 +6711,10 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       nMaxConeElemSize = COPTMEX_MAX(nMaxConeElemSize, mxGetNzmax(coneA_m));
     }
 
-    cprob.affMatBeg = (int*)mxCalloc(nMaxConeSize, sizeof(int));
-    cprob.affMatCnt = (int*)mxCalloc(nMaxConeSize, sizeof(int));
-    cprob.affMatIdx = (int*)mxCalloc(nMaxConeElemSize, sizeof(int));
-    cprob.affMatElem = (double*)mxCalloc(nMaxConeElemSize, sizeof(double));
+    cprob.affMatBeg = (int*)COPTMEX_alloc(nMaxConeSize, sizeof(int));
+    cprob.affMatCnt = (int*)COPTMEX_alloc(nMaxConeSize, sizeof(int));
+    cprob.affMatIdx = (int*)COPTMEX_alloc(nMaxConeElemSize, sizeof(int));
+    cprob.affMatElem = (double*)COPTMEX_alloc(nMaxConeElemSize, sizeof(double));
     if (!cprob.affMatBeg || !cprob.affMatCnt || !cprob.affMatIdx || !cprob.affMatElem)
     {
       retcode = COPT_RETCODE_MEMORY;
@@ -2840,7 +6736,12 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       COPTMEX_CALL(COPTMEX_csc2csr(coneA_m, cprob.affMatBeg, cprob.affMatCnt, cprob.affMatIdx, cprob.affMatElem));
       if (coneB_m != NULL)
       {
-        cprob.affConst = mxGetDoubles(coneB_m);
+        cprob.affConst = COPTMEX_getDoubles(coneB_m);
+        if (!cprob.affConst)
+        {
+          retcode = COPT_RETCODE_MEMORY;
+          goto exit_cleanup;
+        }
       }
       else
       {
@@ -2852,8 +6753,13 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
         mxGetString(coneName_m, coneName, COPT_BUFFSIZE);
       }
 
-      COPTMEX_CALL(COPT_AddAffineCone(prob, coneType, coneSize, 0, NULL, NULL, NULL, NULL, NULL, cprob.affMatBeg,
+      COPTMEX_LOAD(COPT_AddAffineCone(prob, coneType, coneSize, 0, NULL, NULL, NULL, NULL, NULL, cprob.affMatBeg,
         cprob.affMatCnt, cprob.affMatIdx, cprob.affMatElem, cprob.affConst, coneName));
+
+      if (coneB_m != NULL)
+      {
+        COPTMEX_freeDoubles(coneB_m, cprob.affConst);
+      }
     }
   }
 
@@ -2861,9 +6767,9 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
   if (mprob.qobj != NULL)
   {
     cprob.nQElem = mxGetNzmax(mprob.qobj);
-    int* qObjRow = (int*)mxCalloc(cprob.nQElem, sizeof(int));
-    int* qObjCol = (int*)mxCalloc(cprob.nQElem, sizeof(int));
-    double* qObjElem = (double*)mxCalloc(cprob.nQElem, sizeof(double));
+    int* qObjRow = (int*)COPTMEX_alloc(cprob.nQElem, sizeof(int));
+    int* qObjCol = (int*)COPTMEX_alloc(cprob.nQElem, sizeof(int));
+    double* qObjElem = (double*)COPTMEX_alloc(cprob.nQElem, sizeof(double));
     if (!qObjRow || !qObjCol || !qObjElem)
     {
       retcode = COPT_RETCODE_MEMORY;
@@ -2871,7 +6777,7 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
     }
 
     COPTMEX_csc2coo(mprob.qobj, qObjRow, qObjCol, qObjElem);
-    COPTMEX_CALL(COPT_SetQuadObj(prob, cprob.nQElem, qObjRow, qObjCol, qObjElem));
+    COPTMEX_LOAD(COPT_SetQuadObj(prob, cprob.nQElem, qObjRow, qObjCol, qObjElem));
 
     mxFree(qObjRow);
     mxFree(qObjCol);
@@ -2906,9 +6812,9 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       if (QcMat != NULL)
       {
         nQMatElem = mxGetNzmax(QcMat);
-        qMatRow = (int*)mxCalloc(nQMatElem, sizeof(int));
-        qMatCol = (int*)mxCalloc(nQMatElem, sizeof(int));
-        qMatElem = (double*)mxCalloc(nQMatElem, sizeof(double));
+        qMatRow = (int*)COPTMEX_alloc(nQMatElem, sizeof(int));
+        qMatCol = (int*)COPTMEX_alloc(nQMatElem, sizeof(int));
+        qMatElem = (double*)COPTMEX_alloc(nQMatElem, sizeof(double));
         if (!qMatRow || !qMatCol || !qMatElem)
         {
           retcode = COPT_RETCODE_MEMORY;
@@ -2922,21 +6828,21 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
         if (QcRow != NULL && QcCol != NULL && QcVal != NULL)
         {
           nQMatElem = mxGetNumberOfElements(QcRow);
-          qMatRow = (int*)mxCalloc(nQMatElem, sizeof(int));
-          qMatCol = (int*)mxCalloc(nQMatElem, sizeof(int));
+          qMatRow = (int*)COPTMEX_alloc(nQMatElem, sizeof(int));
+          qMatCol = (int*)COPTMEX_alloc(nQMatElem, sizeof(int));
           if (!qMatRow || !qMatCol)
           {
             retcode = COPT_RETCODE_MEMORY;
             goto exit_cleanup;
           }
 
-          double* qMatRow_data = mxGetDoubles(QcRow);
-          double* qMatCol_data = mxGetDoubles(QcCol);
-          qMatElem = mxGetDoubles(QcVal);
-          for (int i = 0; i < nQMatElem; ++i)
+          COPTMEX_copyInts(QcRow, nQMatElem, 1, qMatRow);
+          COPTMEX_copyInts(QcCol, nQMatElem, 1, qMatCol);
+          qMatElem = COPTMEX_getDoubles(QcVal);
+          if (!qMatElem)
           {
-            qMatRow[i] = (int)qMatRow_data[i] - 1;
-            qMatCol[i] = (int)qMatCol_data[i] - 1;
+            retcode = COPT_RETCODE_MEMORY;
+            goto exit_cleanup;
           }
         }
       }
@@ -2945,7 +6851,12 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       {
         if (mxIsSparse(QcLinear))
         {
-          double* qRowMatElem_data = mxGetDoubles(QcLinear);
+          double* qRowMatElem_data = COPTMEX_getDoubles(QcLinear);
+          if (!qRowMatElem_data)
+          {
+            retcode = COPT_RETCODE_MEMORY;
+            goto exit_cleanup;
+          }
           for (int i = 0; i < mxGetNzmax(QcLinear); ++i)
           {
             if (qRowMatElem_data[i] != 0.0)
@@ -2955,8 +6866,8 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
           }
           if (nQRowElem > 0)
           {
-            qRowMatIdx = (int*)mxCalloc(nQRowElem, sizeof(int));
-            qRowMatElem = (double*)mxCalloc(nQRowElem, sizeof(double));
+            qRowMatIdx = (int*)COPTMEX_alloc(nQRowElem, sizeof(int));
+            qRowMatElem = (double*)COPTMEX_alloc(nQRowElem, sizeof(double));
             if (!qRowMatIdx || !qRowMatElem)
             {
               retcode = COPT_RETCODE_MEMORY;
@@ -2973,10 +6884,16 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
               }
             }
           }
+          COPTMEX_freeDoubles(QcLinear, qRowMatElem_data);
         }
         else
         {
-          double* qRowMatElem_data = mxGetDoubles(QcLinear);
+          double* qRowMatElem_data = COPTMEX_getDoubles(QcLinear);
+          if (!qRowMatElem_data)
+          {
+            retcode = COPT_RETCODE_MEMORY;
+            goto exit_cleanup;
+          }
           for (int i = 0; i < mxGetNumberOfElements(QcLinear); ++i)
           {
             if (qRowMatElem_data[i] != 0.0)
@@ -2986,8 +6903,8 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
           }
           if (nQRowElem > 0)
           {
-            qRowMatIdx = (int*)mxCalloc(nQRowElem, sizeof(int));
-            qRowMatElem = (double*)mxCalloc(nQRowElem, sizeof(double));
+            qRowMatIdx = (int*)COPTMEX_alloc(nQRowElem, sizeof(int));
+            qRowMatElem = (double*)COPTMEX_alloc(nQRowElem, sizeof(double));
             if (!qRowMatIdx || !qRowMatElem)
             {
               retcode = COPT_RETCODE_MEMORY;
@@ -3003,6 +6920,7 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
               }
             }
           }
+          COPTMEX_freeDoubles(QcLinear, qRowMatElem_data);
         }
       }
 
@@ -3033,7 +6951,7 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
         mxGetString(QcName, qRowName, COPT_BUFFSIZE);
       }
 
-      COPTMEX_CALL(COPT_AddQConstr(prob, nQRowElem, qRowMatIdx, qRowMatElem, nQMatElem, qMatRow, qMatCol, qMatElem,
+      COPTMEX_LOAD(COPT_AddQConstr(prob, nQRowElem, qRowMatIdx, qRowMatElem, nQMatElem, qMatRow, qMatCol, qMatElem,
         qRowSense[0], qRowBound, qRowName));
 
       mxFree(qMatRow);
@@ -3042,6 +6960,10 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
       {
         mxFree(qMatElem);
       }
+      else if (QcVal != NULL)
+      {
+        COPTMEX_freeDoubles(QcVal, qMatElem);
+      }
 
       if (nQRowElem > 0)
       {
@@ -3051,446 +6973,989 @@ int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
     }
   }
 
-  // Extract and load the optional advanced information
-  if (mprob.varbasis != NULL && mprob.constrbasis != NULL)
+  // Extract and load the optional advanced information
+  if (mprob.varbasis != NULL && mprob.constrbasis != NULL)
+  {
+    cprob.colBasis = (int*)COPTMEX_alloc(cprob.nCol, sizeof(int));
+    cprob.rowBasis = (int*)COPTMEX_alloc(cprob.nRow, sizeof(int));
+    if (!cprob.colBasis || !cprob.rowBasis)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    COPTMEX_copyInts(mprob.varbasis, cprob.nCol, 0, cprob.colBasis);
+    COPTMEX_copyInts(mprob.constrbasis, cprob.nRow, 0, cprob.rowBasis);
+
+    COPTMEX_LOAD(COPT_SetBasis(prob, cprob.colBasis, cprob.rowBasis));
+
+    mxFree(cprob.colBasis);
+    mxFree(cprob.rowBasis);
+  }
+
+  if (mprob.value != NULL && mprob.slack != NULL && mprob.dual != NULL && mprob.redcost != NULL)
+  {
+    double* colValue = COPTMEX_getDoubles(mprob.value);
+    double* colDual = COPTMEX_getDoubles(mprob.redcost);
+    double* rowSlack = COPTMEX_getDoubles(mprob.slack);
+    double* rowDual = COPTMEX_getDoubles(mprob.dual);
+    if (!colValue || !colDual || !rowSlack || !rowDual)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    COPTMEX_LOAD(COPT_SetLpSolution(prob, colValue, rowSlack, rowDual, colDual));
+
+    COPTMEX_freeDoubles(mprob.value, colValue);
+    COPTMEX_freeDoubles(mprob.redcost, colDual);
+    COPTMEX_freeDoubles(mprob.slack, rowSlack);
+    COPTMEX_freeDoubles(mprob.dual, rowDual);
+  }
+
+  if (mprob.mipstart != NULL)
+  {
+    // Each column of 'start' is a separate MIP start
+    int nStart = COPTMEX_getNumStart(mprob.mipstart, cprob.nCol);
+    int* startIdx = NULL;
+    double* startElem = NULL;
+
+    if (mxIsSparse(mprob.mipstart))
+    {
+      // Only nonzero positions of sparse start are fixed, the rest are left to the solver
+      mwIndex* jc = mxGetJc(mprob.mipstart);
+      mwIndex* ir = mxGetIr(mprob.mipstart);
+      int nElem = (int)jc[nStart];
+
+      startIdx = (int*)COPTMEX_alloc(COPTMEX_MAX(nElem, 1), sizeof(int));
+      startElem = COPTMEX_getDoubles(mprob.mipstart);
+      if (!startIdx || !startElem)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+      for (int i = 0; i < nElem; ++i)
+      {
+        startIdx[i] = (int)ir[i];
+      }
+
+      for (int k = 0; k < nStart; ++k)
+      {
+        COPTMEX_LOAD(COPT_AddMipStart(prob, (int)(jc[k + 1] - jc[k]), startIdx + jc[k], startElem + jc[k]));
+      }
+
+      mxFree(startIdx);
+      COPTMEX_freeDoubles(mprob.mipstart, startElem);
+    }
+    else
+    {
+      size_t nElem = (size_t)cprob.nCol * nStart;
+
+      startElem = (double*)COPTMEX_alloc(COPTMEX_MAX(nElem, 1), sizeof(double));
+      if (!startElem)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+
+      COPTMEX_copyDoubles(mprob.mipstart, nElem, startElem);
+      for (size_t i = 0; i < nElem; ++i)
+      {
+        if (mxIsNaN(startElem[i]))
+        {
+          startElem[i] = COPT_UNDEFINED;
+        }
+      }
+
+      for (int k = 0; k < nStart; ++k)
+      {
+        COPTMEX_LOAD(COPT_AddMipStart(prob, cprob.nCol, NULL, startElem + (size_t)k * cprob.nCol));
+      }
+
+      mxFree(startElem);
+    }
+  }
+
+exit_cleanup:
+  if (out_cprob != NULL && retcode == COPT_RETCODE_OK)
+  {
+    *out_cprob = cprob;
+  }
+  else
+  {
+    COPTMEX_freeModelData(&cprob, in_model);
+  }
+  return retcode;
+}
+
+/* Extract and load data to problem */
+int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model)
+{
+  return COPTMEX_loadModelData(prob, in_model, NULL);
+}
+
+/* Extract IIS information, possibly partial if computation was stopped */
+static int COPTMEX_getIIS(copt_prob* prob, int isComplete, int ifWriteIIS, mxArray** out_iis)
+{
+  int retcode = COPT_RETCODE_OK;
+  int nRow = 0, nCol = 0, nSos = 0, nIndicator = 0;
+  int hasIIS = 0;
+  int isMinIIS = 0;
+  mxArray* iisInfo = NULL;
+  coptmex_ciisinfo ciisinfo;
+  coptmex_miisinfo miisinfo;
+
+  COPTMEX_initCIISInfo(&ciisinfo);
+  COPTMEX_initMIISInfo(&miisinfo);
+
+  miisinfo.iscomplete = mxCreateDoubleScalar(isComplete);
+  if (!miisinfo.iscomplete)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  // Without any conflict set, only report whether computation completed
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_HASIIS, &hasIIS));
+  if (hasIIS == 0)
+  {
+    iisInfo = mxCreateStructMatrix(1, 1, 0, NULL);
+    if (!iisInfo)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    mxAddField(iisInfo, COPTMEX_IIS_ISMINIIS);
+    mxSetField(iisInfo, 0, COPTMEX_IIS_ISMINIIS, mxCreateDoubleScalar(0.0));
+    mxAddField(iisInfo, COPTMEX_IIS_ISCOMPLETE);
+    mxSetField(iisInfo, 0, COPTMEX_IIS_ISCOMPLETE, miisinfo.iscomplete);
+
+    *out_iis = iisInfo;
+    goto exit_cleanup;
+  }
+
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ROWS, &nRow));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &nCol));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_SOSS, &nSos));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_INDICATORS, &nIndicator));
+
+  miisinfo.isminiis = mxCreateDoubleMatrix(1, 1, mxREAL);
+  if (!miisinfo.isminiis)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
+
+  if (nCol > 0)
+  {
+    miisinfo.varlb = mxCreateLogicalMatrix(nCol, 1);
+    miisinfo.varub = mxCreateLogicalMatrix(nCol, 1);
+    if (!miisinfo.varlb || !miisinfo.varub)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+  }
+
+  if (nRow > 0)
+  {
+    miisinfo.constrlb = mxCreateLogicalMatrix(nRow, 1);
+    miisinfo.construb = mxCreateLogicalMatrix(nRow, 1);
+    if (!miisinfo.constrlb || !miisinfo.construb)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+  }
+
+  if (nSos > 0)
+  {
+    miisinfo.sos = mxCreateLogicalMatrix(nSos, 1);
+    if (!miisinfo.sos)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+  }
+
+  if (nIndicator > 0)
+  {
+    miisinfo.indicator = mxCreateLogicalMatrix(nIndicator, 1);
+    if (!miisinfo.indicator)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+  }
+
+  if (nCol > 0)
+  {
+    ciisinfo.colLowerIIS = (int*)COPTMEX_alloc(nCol, sizeof(int));
+    ciisinfo.colUpperIIS = (int*)COPTMEX_alloc(nCol, sizeof(int));
+    if (!ciisinfo.colLowerIIS || !ciisinfo.colUpperIIS)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+  }
+
+  if (nRow > 0)
   {
-    cprob.colBasis = (int*)mxCalloc(cprob.nCol, sizeof(int));
-    cprob.rowBasis = (int*)mxCalloc(cprob.nRow, sizeof(int));
-    if (!cprob.colBasis || !cprob.rowBasis)
+    ciisinfo.rowLowerIIS = (int*)COPTMEX_alloc(nRow, sizeof(int));
+    ciisinfo.rowUpperIIS = (int*)COPTMEX_alloc(nRow, sizeof(int));
+    if (!ciisinfo.rowLowerIIS || !ciisinfo.rowUpperIIS)
     {
       retcode = COPT_RETCODE_MEMORY;
       goto exit_cleanup;
     }
+  }
 
-    double* colBasis_data = mxGetDoubles(mprob.varbasis);
-    double* rowBasis_data = mxGetDoubles(mprob.constrbasis);
-    for (int i = 0; i < cprob.nCol; ++i)
+  if (nSos > 0)
+  {
+    ciisinfo.sosIIS = (int*)COPTMEX_alloc(nSos, sizeof(int));
+    if (!ciisinfo.sosIIS)
     {
-      cprob.colBasis[i] = (int)colBasis_data[i];
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
     }
-    for (int i = 0; i < cprob.nRow; ++i)
+  }
+
+  if (nIndicator > 0)
+  {
+    ciisinfo.indicatorIIS = (int*)COPTMEX_alloc(nIndicator, sizeof(int));
+    if (!ciisinfo.indicatorIIS)
     {
-      cprob.rowBasis[i] = (int)rowBasis_data[i];
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
     }
+  }
 
-    COPTMEX_CALL(COPT_SetBasis(prob, cprob.colBasis, cprob.rowBasis));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ISMINIIS, &isMinIIS));
+  if (!isComplete)
+  {
+    isMinIIS = 0;
+  }
 
-    mxFree(cprob.colBasis);
-    mxFree(cprob.rowBasis);
+  if (nCol > 0)
+  {
+    COPTMEX_CALL(COPT_GetColLowerIIS(prob, nCol, NULL, ciisinfo.colLowerIIS));
+    COPTMEX_CALL(COPT_GetColUpperIIS(prob, nCol, NULL, ciisinfo.colUpperIIS));
   }
 
-  if (mprob.value != NULL && mprob.slack != NULL && mprob.dual != NULL && mprob.redcost != NULL)
+  if (nRow > 0)
   {
-    double* colValue = mxGetDoubles(mprob.value);
-    double* colDual = mxGetDoubles(mprob.redcost);
-    double* rowSlack = mxGetDoubles(mprob.slack);
-    double* rowDual = mxGetDoubles(mprob.dual);
+    COPTMEX_CALL(COPT_GetRowLowerIIS(prob, nRow, NULL, ciisinfo.rowLowerIIS));
+    COPTMEX_CALL(COPT_GetRowUpperIIS(prob, nRow, NULL, ciisinfo.rowUpperIIS));
+  }
 
-    COPTMEX_CALL(COPT_SetLpSolution(prob, colValue, rowSlack, rowDual, colDual));
+  if (nSos > 0)
+  {
+    COPTMEX_CALL(COPT_GetSOSIIS(prob, nSos, NULL, ciisinfo.sosIIS));
   }
 
-  if (mprob.mipstart != NULL)
+  if (nIndicator > 0)
   {
-    int nRowCnt = 0;
-    int* rowIdx = NULL;
-    double* rowElem = NULL;
+    COPTMEX_CALL(COPT_GetIndicatorIIS(prob, nIndicator, NULL, ciisinfo.indicatorIIS));
+  }
 
-    if (mxIsSparse(mprob.mipstart))
+  *mxGetDoubles(miisinfo.isminiis) = isMinIIS;
+
+  if (nCol > 0)
+  {
+    mxLogical* colLowerIIS_data = mxGetLogicals(miisinfo.varlb);
+    mxLogical* colUpperIIS_data = mxGetLogicals(miisinfo.varub);
+    for (int i = 0; i < nCol; ++i)
     {
-      nRowCnt = mxGetNzmax(mprob.mipstart);
-      rowIdx = (int*)mxCalloc(nRowCnt, sizeof(int));
-      if (!rowIdx)
-      {
-        retcode = COPT_RETCODE_MEMORY;
-        goto exit_cleanup;
-      }
-      mwIndex* rowIdx_data = mxGetIr(mprob.mipstart);
-      for (int i = 0; i < nRowCnt; ++i)
-      {
-        rowIdx[i] = rowIdx_data[i];
-      }
-      rowElem = mxGetDoubles(mprob.mipstart);
+      colLowerIIS_data[i] = ciisinfo.colLowerIIS[i];
+      colUpperIIS_data[i] = ciisinfo.colUpperIIS[i];
+    }
+    mxFree(ciisinfo.colLowerIIS);
+    mxFree(ciisinfo.colUpperIIS);
+  }
 
-      COPTMEX_CALL(COPT_AddMipStart(prob, nRowCnt, rowIdx, rowElem));
+  if (nRow > 0)
+  {
+    mxLogical* rowLowerIIS_data = mxGetLogicals(miisinfo.constrlb);
+    mxLogical* rowUpperIIS_data = mxGetLogicals(miisinfo.construb);
+    for (int i = 0; i < nRow; ++i)
+    {
+      rowLowerIIS_data[i] = ciisinfo.rowLowerIIS[i];
+      rowUpperIIS_data[i] = ciisinfo.rowUpperIIS[i];
+    }
+    mxFree(ciisinfo.rowLowerIIS);
+    mxFree(ciisinfo.rowUpperIIS);
+  }
 
-      mxFree(rowIdx);
+  if (nSos > 0)
+  {
+    mxLogical* sosIIS_data = mxGetLogicals(miisinfo.sos);
+    for (int i = 0; i < nSos; ++i)
+    {
+      sosIIS_data[i] = ciisinfo.sosIIS[i];
     }
-    else
+    mxFree(ciisinfo.sosIIS);
+  }
+
+  if (nIndicator > 0)
+  {
+    mxLogical* indicatorIIS_data = mxGetLogicals(miisinfo.indicator);
+    for (int i = 0; i < nIndicator; ++i)
     {
-      double* rowElem_data = mxGetDoubles(mprob.mipstart);
+      indicatorIIS_data[i] = ciisinfo.indicatorIIS[i];
+    }
+    mxFree(ciisinfo.indicatorIIS);
+  }
 
-      nRowCnt = mxGetNumberOfElements(mprob.mipstart);
-      rowElem = (double*)mxCalloc(nRowCnt, sizeof(double));
-      if (!rowElem)
-      {
-        retcode = COPT_RETCODE_MEMORY;
-        goto exit_cleanup;
-      }
+  iisInfo = mxCreateStructMatrix(1, 1, 0, NULL);
+  if (!iisInfo)
+  {
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
+  }
 
-      for (int i = 0; i < nRowCnt; ++i)
-      {
-        if (mxIsNaN(rowElem_data[i]))
-        {
-          rowElem[i] = COPT_UNDEFINED;
-        }
-        else
-        {
-          rowElem[i] = rowElem_data[i];
-        }
-      }
+  // 'isminiis'
+  mxAddField(iisInfo, COPTMEX_IIS_ISMINIIS);
+  mxSetField(iisInfo, 0, COPTMEX_IIS_ISMINIIS, miisinfo.isminiis);
 
-      COPTMEX_CALL(COPT_AddMipStart(prob, nRowCnt, NULL, rowElem));
+  // 'iscomplete'
+  mxAddField(iisInfo, COPTMEX_IIS_ISCOMPLETE);
+  mxSetField(iisInfo, 0, COPTMEX_IIS_ISCOMPLETE, miisinfo.iscomplete);
 
-      mxFree(rowElem);
-    }
+  if (nCol > 0)
+  {
+    // 'varlb'
+    mxAddField(iisInfo, COPTMEX_IIS_VARLB);
+    mxSetField(iisInfo, 0, COPTMEX_IIS_VARLB, miisinfo.varlb);
+    // 'varub'
+    mxAddField(iisInfo, COPTMEX_IIS_VARUB);
+    mxSetField(iisInfo, 0, COPTMEX_IIS_VARUB, miisinfo.varub);
+  }
+
+  if (nRow > 0)
+  {
+    // 'constrlb'
+    mxAddField(iisInfo, COPTMEX_IIS_CONSTRLB);
+    mxSetField(iisInfo, 0, COPTMEX_IIS_CONSTRLB, miisinfo.constrlb);
+    // 'construb'
+    mxAddField(iisInfo, COPTMEX_IIS_CONSTRUB);
+    mxSetField(iisInfo, 0, COPTMEX_IIS_CONSTRUB, miisinfo.construb);
+  }
+
+  if (nSos > 0)
+  {
+    // 'sos'
+    mxAddField(iisInfo, COPTMEX_IIS_SOS);
+    mxSetField(iisInfo, 0, COPTMEX_IIS_SOS, miisinfo.sos);
+  }
+
+  if (nIndicator > 0)
+  {
+    // 'indicator'
+    mxAddField(iisInfo, COPTMEX_IIS_INDICATOR);
+    mxSetField(iisInfo, 0, COPTMEX_IIS_INDICATOR, miisinfo.indicator);
+  }
+
+  // Write out IIS problem
+  if (ifWriteIIS)
+  {
+    COPTMEX_CALL(COPT_WriteIIS(prob, "copt.iis"));
   }
 
+  *out_iis = iisInfo;
+
 exit_cleanup:
-  if (cprob.colMatBeg != NULL)
+  if (retcode != COPT_RETCODE_OK)
   {
-    mxFree(cprob.colMatBeg);
+    *out_iis = NULL;
   }
-  if (cprob.colMatIdx != NULL)
+
+  return retcode;
+}
+
+/* Compute IIS for infeasible problem */
+int COPTMEX_computeIIS(copt_prob* prob, mxArray** out_iis, int ifRetResult)
+{
+  int retcode = COPT_RETCODE_OK;
+  int isStopped = 0;
+  double timeLimit = 0.0;
+  coptmex_watchdog watchdog;
+
+  // Try to find IIS for the given problem, stopping on time limit or Ctrl-C
+  COPTMEX_CALL(COPT_GetDblParam(prob, COPT_DBLPARAM_TIMELIMIT, &timeLimit));
+  COPTMEX_switchPhase(COPTMEX_PHASE_SOLVE);
+  COPTMEX_startWatchdog(&watchdog, &prob, 1, timeLimit < COPT_INFINITY ? timeLimit : 0.0);
+  retcode = COPT_ComputeIIS(prob);
+  isStopped = COPTMEX_stopWatchdog(&watchdog);
+  if (retcode != COPT_RETCODE_OK)
   {
-    mxFree(cprob.colMatIdx);
+    goto exit_cleanup;
   }
-  if (cprob.colLower != NULL)
+
+  // Extract IIS information, flagged incomplete if stopped
+  if (ifRetResult == 1)
   {
-    mxFree(cprob.colLower);
+    COPTMEX_switchPhase(COPTMEX_PHASE_EXTRACT);
+    COPTMEX_CALL(COPTMEX_getIIS(prob, !isStopped, 1, out_iis));
   }
-  if (cprob.colUpper != NULL)
+
+exit_cleanup:
+  return retcode;
+}
+
+/* Problems and per-problem outcomes of a batch IIS computation */
+typedef struct coptmex_iisbatch_s
+{
+  copt_prob** probs;
+  int* retcodes;
+  int* complete;
+  double* times;
+  const coptmex_watchdog* watchdog;
+} coptmex_iisbatch;
+
+/* Compute IIS of one problem in batch, runs on worker thread */
+static void COPTMEX_computeIISTask(void* data, int iTask)
+{
+  coptmex_iisbatch* batch = (coptmex_iisbatch*) data;
+  double start = COPTMEX_getWallTime();
+
+  // Problems not started before watchdog stopped the batch are left incomplete
+  if (batch->watchdog->stopped)
   {
-    mxFree(cprob.colUpper);
+    return;
   }
-  if (cprob.colType != NULL)
+
+  batch->retcodes[iTask] = COPT_ComputeIIS(batch->probs[iTask]);
+  batch->times[iTask] = COPTMEX_getWallTime() - start;
+
+  // Watchdog flags stop before interrupting, so a problem finished after it may have been cut short
+  batch->complete[iTask] = !batch->watchdog->stopped;
+}
+
+/* Shallow 1x1 view of one element of struct array, fields are shared */
+static mxArray* COPTMEX_getStructElem(const mxArray* in_struct, int idx)
+{
+  int nField = mxGetNumberOfFields(in_struct);
+  mxArray* elem = mxCreateStructMatrix(1, 1, 0, NULL);
+
+  if (elem == NULL)
+  {
+    return NULL;
+  }
+
+  // Keep view alive on error exits, since MATLAB would otherwise free the shared fields
+  mexMakeArrayPersistent(elem);
+  for (int i = 0; i < nField; ++i)
+  {
+    mxAddField(elem, mxGetFieldNameByNumber(in_struct, i));
+    mxSetFieldByNumber(elem, 0, i, mxGetFieldByNumber(in_struct, idx, i));
+  }
+
+  return elem;
+}
+
+/* Release view created by COPTMEX_getStructElem */
+static void COPTMEX_freeStructElem(mxArray* elem)
+{
+  for (int i = 0; i < mxGetNumberOfFields(elem); ++i)
+  {
+    mxSetFieldByNumber(elem, 0, i, NULL);
+  }
+  mxDestroyArray(elem);
+}
+
+/* Move fields of 1x1 struct into element of struct array */
+static void COPTMEX_moveStructElem(mxArray* in_elem, mxArray* out_struct, int idx)
+{
+  for (int i = 0; i < mxGetNumberOfFields(in_elem); ++i)
+  {
+    const char* name = mxGetFieldNameByNumber(in_elem, i);
+    if (mxGetFieldNumber(out_struct, name) < 0)
+    {
+      mxAddField(out_struct, name);
+    }
+    mxSetField(out_struct, idx, name, mxGetFieldByNumber(in_elem, 0, i));
+    mxSetFieldByNumber(in_elem, 0, i, NULL);
+  }
+  mxDestroyArray(in_elem);
+}
+
+/* Read or load problem idx of a problem file, problem struct, cell array of files or struct array */
+static int COPTMEX_loadBatchModel(copt_prob* prob, const mxArray* in_models, int idx)
+{
+  int retcode = COPT_RETCODE_OK;
+  char msgbuf[COPT_BUFFSIZE];
+  mxArray* model = NULL;
+
+  if (mxIsChar(in_models))
+  {
+    COPTMEX_CALL(COPTMEX_readModel(prob, in_models));
+  }
+  else if (mxIsCell(in_models))
+  {
+    mxArray* probfile = mxGetCell(in_models, idx);
+    if (probfile == NULL || !mxIsChar(probfile))
+    {
+      snprintf(msgbuf, COPT_BUFFSIZE, "probfile{%d}", idx + 1);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+      goto exit_cleanup;
+    }
+    COPTMEX_CALL(COPTMEX_readModel(prob, probfile));
+  }
+  else if (mxGetNumberOfElements(in_models) == 1)
+  {
+    COPTMEX_CALL(COPTMEX_loadModel(prob, in_models));
+  }
+  else
+  {
+    model = COPTMEX_getStructElem(in_models, idx);
+    if (model == NULL)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+    COPTMEX_CALL(COPTMEX_loadModel(prob, model));
+  }
+
+exit_cleanup:
+  if (model != NULL)
+  {
+    COPTMEX_freeStructElem(model);
+  }
+  return retcode;
+}
+
+/* Compute IIS for a batch of infeasible problems in parallel */
+int COPTMEX_computeIISBatch(copt_env* env, const mxArray* in_models, const mxArray* in_param, mxArray** out_iis,
+                            int ifRetResult)
+{
+  int retcode = COPT_RETCODE_OK;
+  char msgbuf[COPT_BUFFSIZE];
+  int nProb = (int) mxGetNumberOfElements(in_models);
+  int nThread = COPTMEX_getNumProcs();
+  mxArray* nthreads = NULL;
+  mxArray* retiis = NULL;
+  double timeLimit = 0.0;
+  coptmex_watchdog watchdog;
+  coptmex_iisbatch batch;
+
+  batch.probs = NULL;
+  batch.retcodes = NULL;
+  batch.complete = NULL;
+  batch.times = NULL;
+  batch.watchdog = &watchdog;
+
+  nthreads = COPTMEX_getMexParam(in_param, COPTMEX_PARAM_BATCHTHREADS);
+  if (nthreads != NULL)
+  {
+    if (!mxIsScalar(nthreads) || mxIsChar(nthreads))
+    {
+      snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", COPTMEX_PARAM_BATCHTHREADS);
+      COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+      goto exit_cleanup;
+    }
+    if ((int) mxGetScalar(nthreads) > 0)
+    {
+      nThread = (int) mxGetScalar(nthreads);
+    }
+  }
+
+  batch.probs = (copt_prob**) mxCalloc(COPTMEX_MAX(nProb, 1), sizeof(copt_prob*));
+  batch.retcodes = (int*) mxCalloc(COPTMEX_MAX(nProb, 1), sizeof(int));
+  batch.complete = (int*) mxCalloc(COPTMEX_MAX(nProb, 1), sizeof(int));
+  batch.times = (double*) mxCalloc(COPTMEX_MAX(nProb, 1), sizeof(double));
+  if (!batch.probs || !batch.retcodes || !batch.complete || !batch.times)
   {
-    COPTMEX_freeString(&cprob.colType);
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
   }
-  if (cprob.colNames != NULL)
+
+  // Load all problems on the MATLAB thread, since MATLAB APIs are not thread-safe
+  for (int i = 0; i < nProb; ++i)
   {
-    for (int i = 0; i < cprob.nCol; ++i)
+    COPTMEX_CALL(COPT_CreateProb(env, &batch.probs[i]));
+    if (in_param != NULL)
     {
-      if (cprob.colNames[i] != NULL)
-      {
-        COPTMEX_freeString(&cprob.colNames[i]);
-      }
+      COPTMEX_CALL(COPTMEX_setParam(batch.probs[i], in_param));
     }
-    mxFree(cprob.colNames);
+
+    COPTMEX_CALL(COPTMEX_loadBatchModel(batch.probs[i], in_models, i));
+
+    // Log callback prints through MATLAB, so logging is disabled on worker threads
+    COPTMEX_CALL(COPT_SetIntParam(batch.probs[i], COPT_INTPARAM_LOGGING, 0));
   }
 
-  if (cprob.rowLower != NULL)
+  // Time limit of the whole batch or interruption from MATLAB stops all problems in batch
+  if (nProb > 0)
   {
-    mxFree(cprob.rowLower);
+    COPTMEX_CALL(COPT_GetDblParam(batch.probs[0], COPT_DBLPARAM_TIMELIMIT, &timeLimit));
   }
-  if (cprob.rowUpper != NULL)
+  COPTMEX_startWatchdog(&watchdog, batch.probs, nProb, timeLimit < COPT_INFINITY ? timeLimit : 0.0);
+  retcode = COPTMEX_runParallel(nProb, nThread, COPTMEX_computeIISTask, &batch);
+  COPTMEX_stopWatchdog(&watchdog);
+  if (retcode != COPT_RETCODE_OK)
   {
-    mxFree(cprob.rowUpper);
+    goto exit_cleanup;
   }
-  if (cprob.rowSense != NULL)
+
+  for (int i = 0; i < nProb; ++i)
   {
-    COPTMEX_freeString(&cprob.rowSense);
+    COPTMEX_CALL(batch.retcodes[i]);
   }
-  if (cprob.rowNames != NULL)
+
+  // Extract IIS information, problems without IIS only have timing
+  if (ifRetResult == 1)
   {
-    for (int i = 0; i < cprob.nRow; ++i)
+    retiis = mxCreateStructArray(mxGetNumberOfDimensions(in_models), mxGetDimensions(in_models), 0, NULL);
+    if (!retiis)
     {
-      if (cprob.rowNames[i] != NULL)
-      {
-        COPTMEX_freeString(&cprob.rowNames[i]);
-      }
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+
+    mxAddField(retiis, COPTMEX_IIS_TIME);
+    for (int i = 0; i < nProb; ++i)
+    {
+      mxArray* iisInfo = NULL;
+
+      COPTMEX_CALL(COPTMEX_getIIS(batch.probs[i], batch.complete[i], 0, &iisInfo));
+      COPTMEX_moveStructElem(iisInfo, retiis, i);
+      mxSetField(retiis, i, COPTMEX_IIS_TIME, mxCreateDoubleScalar(batch.times[i]));
     }
-    mxFree(cprob.rowNames);
+
+    *out_iis = retiis;
   }
 
-  if (cprob.affMatBeg != NULL)
+exit_cleanup:
+  if (batch.probs != NULL)
   {
-    mxFree(cprob.affMatBeg);
+    for (int i = 0; i < nProb; ++i)
+    {
+      COPT_DeleteProb(&batch.probs[i]);
+    }
+    mxFree(batch.probs);
   }
-  if (cprob.affMatCnt != NULL)
+  if (batch.retcodes != NULL)
   {
-    mxFree(cprob.affMatCnt);
+    mxFree(batch.retcodes);
   }
-  if (cprob.affMatIdx != NULL)
+  if (batch.complete != NULL)
   {
-    mxFree(cprob.affMatIdx);
+    mxFree(batch.complete);
   }
-  if (cprob.affMatElem != NULL)
+  if (batch.times != NULL)
   {
-    mxFree(cprob.affMatElem);
+    mxFree(batch.times);
   }
+
   return retcode;
 }
 
-/* Extract IIS information */
-static int COPTMEX_getIIS(copt_prob* prob, mxArray** out_iis)
+/* Parse parameter file written by COPT into parameter struct */
+static int COPTMEX_readParamFile(const char* filename, mxArray** out_param)
 {
   int retcode = COPT_RETCODE_OK;
-  int nRow = 0, nCol = 0, nSos = 0, nIndicator = 0;
-  int hasIIS = 0;
-  int isMinIIS = 0;
-  mxArray* iisInfo = NULL;
-  coptmex_ciisinfo ciisinfo;
-  coptmex_miisinfo miisinfo;
+  char line[COPT_BUFFSIZE];
+  char name[COPT_BUFFSIZE];
+  double value = 0.0;
+  mxArray* param = NULL;
+  FILE* fp = NULL;
 
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_HASIIS, &hasIIS));
-  if (hasIIS == 0)
+  fp = fopen(filename, "r");
+  if (fp == NULL)
   {
-    *out_iis = NULL;
+    retcode = COPT_RETCODE_FILE;
     goto exit_cleanup;
   }
 
-  COPTMEX_initCIISInfo(&ciisinfo);
-  COPTMEX_initMIISInfo(&miisinfo);
-
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ROWS, &nRow));
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &nCol));
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_SOSS, &nSos));
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_INDICATORS, &nIndicator));
-
-  miisinfo.isminiis = mxCreateDoubleMatrix(1, 1, mxREAL);
-  if (!miisinfo.isminiis)
+  param = mxCreateStructMatrix(1, 1, 0, NULL);
+  if (!param)
   {
     retcode = COPT_RETCODE_MEMORY;
     goto exit_cleanup;
   }
 
-  if (nCol > 0)
+  // Each line holds a parameter name and value, '#' starts a comment
+  while (fgets(line, COPT_BUFFSIZE, fp) != NULL)
   {
-    miisinfo.varlb = mxCreateLogicalMatrix(nCol, 1);
-    miisinfo.varub = mxCreateLogicalMatrix(nCol, 1);
-    if (!miisinfo.varlb || !miisinfo.varub)
+    if (sscanf(line, "%s %lf", name, &value) != 2 || name[0] == '#')
     {
-      retcode = COPT_RETCODE_MEMORY;
-      goto exit_cleanup;
+      continue;
+    }
+    if (mxGetFieldNumber(param, name) < 0)
+    {
+      mxAddField(param, name);
     }
+    mxSetField(param, 0, name, mxCreateDoubleScalar(value));
   }
 
-  if (nRow > 0)
+  *out_param = param;
+
+exit_cleanup:
+  if (fp != NULL)
   {
-    miisinfo.constrlb = mxCreateLogicalMatrix(nRow, 1);
-    miisinfo.construb = mxCreateLogicalMatrix(nRow, 1);
-    if (!miisinfo.constrlb || !miisinfo.construb)
-    {
-      retcode = COPT_RETCODE_MEMORY;
-      goto exit_cleanup;
-    }
+    fclose(fp);
   }
+  return retcode;
+}
 
-  if (nSos > 0)
+/* Copy parameter struct without logging parameters, for silent repeated solves */
+static mxArray* COPTMEX_getSilentParam(const mxArray* in_param)
+{
+  mxArray* param = mxDuplicateArray(in_param);
+
+  if (param == NULL)
   {
-    miisinfo.sos = mxCreateLogicalMatrix(nSos, 1);
-    if (!miisinfo.sos)
-    {
-      retcode = COPT_RETCODE_MEMORY;
-      goto exit_cleanup;
-    }
+    return NULL;
   }
 
-  if (nIndicator > 0)
+  for (int i = mxGetNumberOfFields(param) - 1; i >= 0; --i)
   {
-    miisinfo.indicator = mxCreateLogicalMatrix(nIndicator, 1);
-    if (!miisinfo.indicator)
+    const char* parname = mxGetFieldNameByNumber(param, i);
+    if (mystrcmp(parname, COPTMEX_PARAM_LOGFILE) == 0 || mystrcmp(parname, COPT_INTPARAM_LOGGING) == 0)
     {
-      retcode = COPT_RETCODE_MEMORY;
-      goto exit_cleanup;
+      mxRemoveField(param, i);
     }
   }
 
-  if (nCol > 0)
+  return param;
+}
+
+/* Tuned parameter set with its solving time and gap on each problem */
+typedef struct coptmex_tuneresult_s
+{
+  double totalTime;
+  mxArray* params;
+  mxArray* time;
+  mxArray* gap;
+} coptmex_tuneresult;
+
+/* Order tuned parameter sets by total solving time */
+static int COPTMEX_compareTune(const void* a, const void* b)
+{
+  double timeA = ((const coptmex_tuneresult*) a)->totalTime;
+  double timeB = ((const coptmex_tuneresult*) b)->totalTime;
+  return (timeA > timeB) - (timeA < timeB);
+}
+
+/* Tune problems, then evaluate each tuned parameter set on all of them */
+int COPTMEX_tuneModels(copt_env* env, const mxArray* in_models, const mxArray* in_param, mxArray** out_tune,
+                       int ifRetResult)
+{
+  int retcode = COPT_RETCODE_OK;
+  int nProb = mxIsChar(in_models) ? 1 : (int) mxGetNumberOfElements(in_models);
+  int nCand = 0, capCand = 0;
+  copt_prob** probs = NULL;
+  coptmex_tuneresult* cands = NULL;
+  mxArray* evalParam = NULL;
+  coptmex_memfile memfile;
+  coptmex_watchdog watchdog;
+
+  memfile.fd = -1;
+  memfile.isTemp = 0;
+  watchdog.started = 0;
+  watchdog.stopped = 0;
+
+  probs = (copt_prob**) mxCalloc(COPTMEX_MAX(nProb, 1), sizeof(copt_prob*));
+  if (!probs)
   {
-    ciisinfo.colLowerIIS = (int*)mxCalloc(nCol, sizeof(int));
-    ciisinfo.colUpperIIS = (int*)mxCalloc(nCol, sizeof(int));
-    if (!ciisinfo.colLowerIIS || !ciisinfo.colUpperIIS)
-    {
-      retcode = COPT_RETCODE_MEMORY;
-      goto exit_cleanup;
-    }
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
   }
 
-  if (nRow > 0)
+  for (int i = 0; i < nProb; ++i)
   {
-    ciisinfo.rowLowerIIS = (int*)mxCalloc(nRow, sizeof(int));
-    ciisinfo.rowUpperIIS = (int*)mxCalloc(nRow, sizeof(int));
-    if (!ciisinfo.rowLowerIIS || !ciisinfo.rowUpperIIS)
+    COPTMEX_CALL(COPT_CreateProb(env, &probs[i]));
+    if (in_param != NULL)
     {
-      retcode = COPT_RETCODE_MEMORY;
-      goto exit_cleanup;
+      COPTMEX_CALL(COPTMEX_setParam(probs[i], in_param));
     }
+    COPTMEX_CALL(COPTMEX_loadBatchModel(probs[i], in_models, i));
   }
 
-  if (nSos > 0)
+  // Interruption from MATLAB stops tuning and evaluation of all problems
+  COPTMEX_startWatchdog(&watchdog, probs, nProb, 0.0);
+
+  // Tune each problem and collect its tuned parameter sets
+  for (int i = 0; i < nProb && !watchdog.stopped; ++i)
   {
-    ciisinfo.sosIIS = (int*)mxCalloc(nSos, sizeof(int));
-    if (!ciisinfo.sosIIS)
+    int nResult = 0;
+
+    COPTMEX_CALL(COPT_Tune(probs[i]));
+    if (ifRetResult == 0)
     {
-      retcode = COPT_RETCODE_MEMORY;
-      goto exit_cleanup;
+      continue;
     }
-  }
 
-  if (nIndicator > 0)
-  {
-    ciisinfo.indicatorIIS = (int*)mxCalloc(nIndicator, sizeof(int));
-    if (!ciisinfo.indicatorIIS)
+    COPTMEX_CALL(COPT_GetIntAttr(probs[i], COPT_INTATTR_TUNERESULTS, &nResult));
+    if (nCand + nResult > capCand)
     {
-      retcode = COPT_RETCODE_MEMORY;
-      goto exit_cleanup;
+      capCand = COPTMEX_MAX(2 * capCand, nCand + nResult);
+      cands = (coptmex_tuneresult*) (cands ? mxRealloc(cands, capCand * sizeof(coptmex_tuneresult))
+                                           : mxCalloc(capCand, sizeof(coptmex_tuneresult)));
+      if (!cands)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
     }
-  }
 
-  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ISMINIIS, &isMinIIS));
+    // COPT only writes tuned parameter sets by path, so pass them through an anonymous file
+    for (int k = 0; k < nResult; ++k)
+    {
+      coptmex_tuneresult* cand = &cands[nCand++];
 
-  if (nCol > 0)
-  {
-    COPTMEX_CALL(COPT_GetColLowerIIS(prob, nCol, NULL, ciisinfo.colLowerIIS));
-    COPTMEX_CALL(COPT_GetColUpperIIS(prob, nCol, NULL, ciisinfo.colUpperIIS));
-  }
+      cand->totalTime = 0.0;
+      cand->params = NULL;
+      cand->time = mxCreateDoubleMatrix(nProb, 1, mxREAL);
+      cand->gap = mxCreateDoubleMatrix(nProb, 1, mxREAL);
+      if (!cand->time || !cand->gap)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
 
-  if (nRow > 0)
-  {
-    COPTMEX_CALL(COPT_GetRowLowerIIS(prob, nRow, NULL, ciisinfo.rowLowerIIS));
-    COPTMEX_CALL(COPT_GetRowUpperIIS(prob, nRow, NULL, ciisinfo.rowUpperIIS));
-  }
+      // Problems not evaluated before interruption are left NaN
+      for (int j = 0; j < nProb; ++j)
+      {
+        mxGetDoubles(cand->time)[j] = mxGetNaN();
+        mxGetDoubles(cand->gap)[j] = mxGetNaN();
+      }
 
-  if (nSos > 0)
-  {
-    COPTMEX_CALL(COPT_GetSOSIIS(prob, nSos, NULL, ciisinfo.sosIIS));
+      COPTMEX_CALL(COPTMEX_openMemFile("par", 0, &memfile));
+      COPTMEX_CALL(COPT_WriteTuneParam(probs[i], k, memfile.path));
+      COPTMEX_CALL(COPTMEX_readParamFile(memfile.path, &cand->params));
+      COPTMEX_closeMemFile(&memfile);
+    }
   }
 
-  if (nIndicator > 0)
+  if (ifRetResult == 0)
   {
-    COPTMEX_CALL(COPT_GetIndicatorIIS(prob, nIndicator, NULL, ciisinfo.indicatorIIS));
+    goto exit_cleanup;
   }
 
-  *mxGetDoubles(miisinfo.isminiis) = isMinIIS;
-
-  if (nCol > 0)
+  if (in_param != NULL)
   {
-    mxLogical* colLowerIIS_data = mxGetLogicals(miisinfo.varlb);
-    mxLogical* colUpperIIS_data = mxGetLogicals(miisinfo.varub);
-    for (int i = 0; i < nCol; ++i)
+    evalParam = COPTMEX_getSilentParam(in_param);
+    if (!evalParam)
     {
-      colLowerIIS_data[i] = ciisinfo.colLowerIIS[i];
-      colUpperIIS_data[i] = ciisinfo.colUpperIIS[i];
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
     }
-    mxFree(ciisinfo.colLowerIIS);
-    mxFree(ciisinfo.colUpperIIS);
   }
 
-  if (nRow > 0)
+  // Measure each parameter set on every problem from a cleared state
+  for (int k = 0; k < nCand && !watchdog.stopped; ++k)
   {
-    mxLogical* rowLowerIIS_data = mxGetLogicals(miisinfo.constrlb);
-    mxLogical* rowUpperIIS_data = mxGetLogicals(miisinfo.construb);
-    for (int i = 0; i < nRow; ++i)
+    for (int i = 0; i < nProb && !watchdog.stopped; ++i)
     {
-      rowLowerIIS_data[i] = ciisinfo.rowLowerIIS[i];
-      rowUpperIIS_data[i] = ciisinfo.rowUpperIIS[i];
-    }
-    mxFree(ciisinfo.rowLowerIIS);
-    mxFree(ciisinfo.rowUpperIIS);
-  }
+      int isMIP = 0;
+      double dTime = 0.0;
+      double dGap = 0.0;
 
-  if (nSos > 0)
-  {
-    mxLogical* sosIIS_data = mxGetLogicals(miisinfo.sos);
-    for (int i = 0; i < nSos; ++i)
-    {
-      sosIIS_data[i] = ciisinfo.sosIIS[i];
+      COPTMEX_CALL(COPT_ResetParam(probs[i]));
+      if (evalParam != NULL)
+      {
+        COPTMEX_CALL(COPTMEX_setParam(probs[i], evalParam));
+      }
+      COPTMEX_CALL(COPTMEX_setParam(probs[i], cands[k].params));
+      COPTMEX_CALL(COPT_SetIntParam(probs[i], COPT_INTPARAM_LOGGING, 0));
+      COPTMEX_CALL(COPT_Reset(probs[i], 1));
+
+      COPTMEX_CALL(COPT_Solve(probs[i]));
+      if (watchdog.stopped)
+      {
+        break;
+      }
+
+      COPTMEX_CALL(COPT_GetDblAttr(probs[i], COPT_DBLATTR_SOLVINGTIME, &dTime));
+      COPTMEX_CALL(COPT_GetIntAttr(probs[i], COPT_INTATTR_ISMIP, &isMIP));
+      if (isMIP)
+      {
+        COPTMEX_CALL(COPT_GetDblAttr(probs[i], COPT_DBLATTR_BESTGAP, &dGap));
+      }
+
+      mxGetDoubles(cands[k].time)[i] = dTime;
+      mxGetDoubles(cands[k].gap)[i] = dGap;
+      cands[k].totalTime += dTime;
     }
-    mxFree(ciisinfo.sosIIS);
   }
 
-  if (nIndicator > 0)
+  // Parameter sets not evaluated on all problems before interruption go last
+  for (int k = 0; k < nCand; ++k)
   {
-    mxLogical* indicatorIIS_data = mxGetLogicals(miisinfo.indicator);
-    for (int i = 0; i < nIndicator; ++i)
+    if (mxIsNaN(mxGetDoubles(cands[k].time)[nProb - 1]))
     {
-      indicatorIIS_data[i] = ciisinfo.indicatorIIS[i];
+      cands[k].totalTime = mxGetInf();
     }
-    mxFree(ciisinfo.indicatorIIS);
   }
 
-  iisInfo = mxCreateStructMatrix(1, 1, 0, NULL);
-  if (!iisInfo)
+  // Put the fastest parameter set across all problems first
+  qsort(cands, nCand, sizeof(coptmex_tuneresult), COPTMEX_compareTune);
+
+  *out_tune = mxCreateStructMatrix(nCand, 1, 0, NULL);
+  if (!(*out_tune))
   {
     retcode = COPT_RETCODE_MEMORY;
     goto exit_cleanup;
   }
 
-  // 'isminiis'
-  mxAddField(iisInfo, COPTMEX_IIS_ISMINIIS);
-  mxSetField(iisInfo, 0, COPTMEX_IIS_ISMINIIS, miisinfo.isminiis);
-
-  if (nCol > 0)
-  {
-    // 'varlb'
-    mxAddField(iisInfo, COPTMEX_IIS_VARLB);
-    mxSetField(iisInfo, 0, COPTMEX_IIS_VARLB, miisinfo.varlb);
-    // 'varub'
-    mxAddField(iisInfo, COPTMEX_IIS_VARUB);
-    mxSetField(iisInfo, 0, COPTMEX_IIS_VARUB, miisinfo.varub);
-  }
-
-  if (nRow > 0)
+  mxAddField(*out_tune, COPTMEX_TUNE_PARAMS);
+  mxAddField(*out_tune, COPTMEX_TUNE_TIME);
+  mxAddField(*out_tune, COPTMEX_TUNE_GAP);
+  for (int k = 0; k < nCand; ++k)
   {
-    // 'constrlb'
-    mxAddField(iisInfo, COPTMEX_IIS_CONSTRLB);
-    mxSetField(iisInfo, 0, COPTMEX_IIS_CONSTRLB, miisinfo.constrlb);
-    // 'construb'
-    mxAddField(iisInfo, COPTMEX_IIS_CONSTRUB);
-    mxSetField(iisInfo, 0, COPTMEX_IIS_CONSTRUB, miisinfo.construb);
+    mxSetField(*out_tune, k, COPTMEX_TUNE_PARAMS, cands[k].params);
+    mxSetField(*out_tune, k, COPTMEX_TUNE_TIME, cands[k].time);
+    mxSetField(*out_tune, k, COPTMEX_TUNE_GAP, cands[k].gap);
+    cands[k].params = NULL;
+    cands[k].time = NULL;
+    cands[k].gap = NULL;
   }
 
-  if (nSos > 0)
+exit_cleanup:
+  if (watchdog.started)
   {
-    // 'sos'
-    mxAddField(iisInfo, COPTMEX_IIS_SOS);
-    mxSetField(iisInfo, 0, COPTMEX_IIS_SOS, miisinfo.sos);
+    COPTMEX_stopWatchdog(&watchdog);
   }
-
-  if (nIndicator > 0)
+  COPTMEX_closeMemFile(&memfile);
+  if (probs != NULL)
   {
-    // 'indicator'
-    mxAddField(iisInfo, COPTMEX_IIS_INDICATOR);
-    mxSetField(iisInfo, 0, COPTMEX_IIS_INDICATOR, miisinfo.indicator);
+    for (int i = 0; i < nProb; ++i)
+    {
+      COPT_DeleteProb(&probs[i]);
+    }
+    mxFree(probs);
   }
-
-  // Write out IIS problem
-  COPTMEX_CALL(COPT_WriteIIS(prob, "copt.iis"));
-
-  *out_iis = iisInfo;
-
-exit_cleanup:
-  if (retcode != COPT_RETCODE_OK)
+  if (cands != NULL)
   {
-    *out_iis = NULL;
+    for (int k = 0; k < nCand; ++k)
+    {
+      if (cands[k].params != NULL)
+      {
+        mxDestroyArray(cands[k].params);
+      }
+      if (cands[k].time != NULL)
+      {
+        mxDestroyArray(cands[k].time);
+      }
+      if (cands[k].gap != NULL)
+      {
+        mxDestroyArray(cands[k].gap);
+      }
+    }
+    mxFree(cands);
   }
-
-  return retcode;
-}
-
-/* Compute IIS for infeasible problem */
-int COPTMEX_computeIIS(copt_prob* prob, mxArray** out_iis, int ifRetResult)
-{
-  int retcode = COPT_RETCODE_OK;
-  int modelStatus = 0;
-  int isMIP = 0;
-
-  // Try to find IIS for the given problem
-  COPTMEX_CALL(COPT_ComputeIIS(prob));
-
-  // Extract IIS information
-  if (ifRetResult == 1)
+  if (evalParam != NULL)
   {
-    COPTMEX_CALL(COPTMEX_getIIS(prob, out_iis));
+    mxDestroyArray(evalParam);
   }
 
-exit_cleanup:
   return retcode;
 }
 
-/* Extract feasibility relaxation information */
-static int COPTMEX_getFeasRelax(copt_prob* prob, mxArray** out_relax)
+/* Extract feasibility relaxation information into column iWeight of nWeight */
+static int COPTMEX_getFeasRelax(copt_prob* prob, int nWeight, int iWeight, mxArray** out_relax)
 {
   int retcode = COPT_RETCODE_OK;
   int nRow = 0, nCol = 0;
@@ -3500,7 +7965,7 @@ static int COPTMEX_getFeasRelax(copt_prob* prob, mxArray** out_relax)
   coptmex_mrelaxinfo mrelaxinfo;
 
   COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_HASFEASRELAXSOL, &hasFeasRelax));
-  if (hasFeasRelax == 0)
+  if (hasFeasRelax == 0 && nWeight == 1)
   {
     *out_relax = NULL;
     goto exit_cleanup;
@@ -3512,104 +7977,134 @@ static int COPTMEX_getFeasRelax(copt_prob* prob, mxArray** out_relax)
   COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ROWS, &nRow));
   COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &nCol));
 
-  mrelaxinfo.relaxobj = mxCreateDoubleMatrix(1, 1, mxREAL);
-  if (!mrelaxinfo.relaxobj)
-  {
-    retcode = COPT_RETCODE_MEMORY;
-    goto exit_cleanup;
-  }
-
-  if (nCol > 0)
+  if (iWeight == 0)
   {
-    mrelaxinfo.relaxvalue = mxCreateDoubleMatrix(nCol, 1, mxREAL);
-    mrelaxinfo.relaxlb = mxCreateDoubleMatrix(nCol, 1, mxREAL);
-    mrelaxinfo.relaxub = mxCreateDoubleMatrix(nCol, 1, mxREAL);
-    if (!mrelaxinfo.relaxvalue || !mrelaxinfo.relaxlb || !mrelaxinfo.relaxub)
+    mrelaxinfo.relaxobj = mxCreateDoubleMatrix(1, nWeight, mxREAL);
+    if (!mrelaxinfo.relaxobj)
     {
       retcode = COPT_RETCODE_MEMORY;
       goto exit_cleanup;
     }
-  }
 
-  if (nRow > 0)
-  {
-    mrelaxinfo.relaxlhs = mxCreateDoubleMatrix(nRow, 1, mxREAL);
-    mrelaxinfo.relaxrhs = mxCreateDoubleMatrix(nRow, 1, mxREAL);
-    if (!mrelaxinfo.relaxlhs || !mrelaxinfo.relaxrhs)
+    if (nCol > 0)
+    {
+      mrelaxinfo.relaxvalue = mxCreateDoubleMatrix(nCol, nWeight, mxREAL);
+      mrelaxinfo.relaxlb = mxCreateDoubleMatrix(nCol, nWeight, mxREAL);
+      mrelaxinfo.relaxub = mxCreateDoubleMatrix(nCol, nWeight, mxREAL);
+      if (!mrelaxinfo.relaxvalue || !mrelaxinfo.relaxlb || !mrelaxinfo.relaxub)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+    }
+
+    if (nRow > 0)
+    {
+      mrelaxinfo.relaxlhs = mxCreateDoubleMatrix(nRow, nWeight, mxREAL);
+      mrelaxinfo.relaxrhs = mxCreateDoubleMatrix(nRow, nWeight, mxREAL);
+      if (!mrelaxinfo.relaxlhs || !mrelaxinfo.relaxrhs)
+      {
+        retcode = COPT_RETCODE_MEMORY;
+        goto exit_cleanup;
+      }
+    }
+
+    // Weightings stopped before running, or without relaxation solution, are left as NaN
+    {
+      mxArray* relaxdata[6] = {mrelaxinfo.relaxobj, mrelaxinfo.relaxvalue, mrelaxinfo.relaxlb,
+                               mrelaxinfo.relaxub, mrelaxinfo.relaxlhs, mrelaxinfo.relaxrhs};
+      for (int k = 0; k < 6; ++k)
+      {
+        double* data = relaxdata[k] != NULL ? mxGetDoubles(relaxdata[k]) : NULL;
+        for (size_t i = 0; data != NULL && i < mxGetNumberOfElements(relaxdata[k]); ++i)
+        {
+          data[i] = mxGetNaN();
+        }
+      }
+    }
+
+    relaxInfo = mxCreateStructMatrix(1, 1, 0, NULL);
+    if (!relaxInfo)
     {
       retcode = COPT_RETCODE_MEMORY;
       goto exit_cleanup;
     }
-  }
 
-  if (nCol > 0)
-  {
-    crelaxinfo.colValue = mxGetDoubles(mrelaxinfo.relaxvalue);
-    crelaxinfo.colLowRlx = mxGetDoubles(mrelaxinfo.relaxlb);
-    crelaxinfo.colUppRlx = mxGetDoubles(mrelaxinfo.relaxub);
-  }
+    // 'relaxobj'
+    mxAddField(relaxInfo, COPTMEX_FEASRELAX_OBJ);
+    mxSetField(relaxInfo, 0, COPTMEX_FEASRELAX_OBJ, mrelaxinfo.relaxobj);
 
-  if (nRow > 0)
+    if (nCol > 0)
+    {
+      // 'relaxvalue'
+      mxAddField(relaxInfo, COPTMEX_FEASRELAX_VALUE);
+      mxSetField(relaxInfo, 0, COPTMEX_FEASRELAX_VALUE, mrelaxinfo.relaxvalue);
+      // 'relaxlb'
+      mxAddField(relaxInfo, COPTMEX_FEASRELAX_LB);
+      mxSetField(relaxInfo, 0, COPTMEX_FEASRELAX_LB, mrelaxinfo.relaxlb);
+      // 'relaxub'
+      mxAddField(relaxInfo, COPTMEX_FEASRELAX_UB);
+      mxSetField(relaxInfo, 0, COPTMEX_FEASRELAX_UB, mrelaxinfo.relaxub);
+    }
+
+    if (nRow > 0)
+    {
+      // 'relaxlhs'
+      mxAddField(relaxInfo, COPTMEX_FEASRELAX_LHS);
+      mxSetField(relaxInfo, 0, COPTMEX_FEASRELAX_LHS, mrelaxinfo.relaxlhs);
+      // 'relaxrhs'
+      mxAddField(relaxInfo, COPTMEX_FEASRELAX_RHS);
+      mxSetField(relaxInfo, 0, COPTMEX_FEASRELAX_RHS, mrelaxinfo.relaxrhs);
+    }
+
+    *out_relax = relaxInfo;
+  }
+  else
   {
-    crelaxinfo.rowLowRlx = mxGetDoubles(mrelaxinfo.relaxlhs);
-    crelaxinfo.rowUppRlx = mxGetDoubles(mrelaxinfo.relaxrhs);
+    relaxInfo = *out_relax;
+    mrelaxinfo.relaxobj = mxGetField(relaxInfo, 0, COPTMEX_FEASRELAX_OBJ);
+    mrelaxinfo.relaxvalue = mxGetField(relaxInfo, 0, COPTMEX_FEASRELAX_VALUE);
+    mrelaxinfo.relaxlb = mxGetField(relaxInfo, 0, COPTMEX_FEASRELAX_LB);
+    mrelaxinfo.relaxub = mxGetField(relaxInfo, 0, COPTMEX_FEASRELAX_UB);
+    mrelaxinfo.relaxlhs = mxGetField(relaxInfo, 0, COPTMEX_FEASRELAX_LHS);
+    mrelaxinfo.relaxrhs = mxGetField(relaxInfo, 0, COPTMEX_FEASRELAX_RHS);
   }
 
-  COPTMEX_CALL(COPT_GetDblAttr(prob, COPT_DBLATTR_FEASRELAXOBJ, &crelaxinfo.dObjVal));
-  *mxGetDoubles(mrelaxinfo.relaxobj) = crelaxinfo.dObjVal;
-
   if (nCol > 0)
   {
-    COPTMEX_CALL(COPT_GetColInfo(prob, COPT_DBLINFO_RELAXVALUE, nCol, NULL, crelaxinfo.colValue));
-    COPTMEX_CALL(COPT_GetColInfo(prob, COPT_DBLINFO_RELAXLB, nCol, NULL, crelaxinfo.colLowRlx));
-    COPTMEX_CALL(COPT_GetColInfo(prob, COPT_DBLINFO_RELAXUB, nCol, NULL, crelaxinfo.colUppRlx));
+    crelaxinfo.colValue = mxGetDoubles(mrelaxinfo.relaxvalue) + (size_t) iWeight * nCol;
+    crelaxinfo.colLowRlx = mxGetDoubles(mrelaxinfo.relaxlb) + (size_t) iWeight * nCol;
+    crelaxinfo.colUppRlx = mxGetDoubles(mrelaxinfo.relaxub) + (size_t) iWeight * nCol;
   }
 
   if (nRow > 0)
   {
-    COPTMEX_CALL(COPT_GetRowInfo(prob, COPT_DBLINFO_RELAXLB, nRow, NULL, crelaxinfo.rowLowRlx));
-    COPTMEX_CALL(COPT_GetRowInfo(prob, COPT_DBLINFO_RELAXUB, nRow, NULL, crelaxinfo.rowUppRlx));
+    crelaxinfo.rowLowRlx = mxGetDoubles(mrelaxinfo.relaxlhs) + (size_t) iWeight * nRow;
+    crelaxinfo.rowUppRlx = mxGetDoubles(mrelaxinfo.relaxrhs) + (size_t) iWeight * nRow;
   }
 
-  relaxInfo = mxCreateStructMatrix(1, 1, 0, NULL);
-  if (!relaxInfo)
+  // Weightings without relaxation solution stay marked by NaN in batch results
+  if (hasFeasRelax == 0)
   {
-    retcode = COPT_RETCODE_MEMORY;
     goto exit_cleanup;
   }
 
-  // 'relaxobj'
-  mxAddField(relaxInfo, COPTMEX_FEASRELAX_OBJ);
-  mxSetField(relaxInfo, 0, COPTMEX_FEASRELAX_OBJ, mrelaxinfo.relaxobj);
+  COPTMEX_CALL(COPT_GetDblAttr(prob, COPT_DBLATTR_FEASRELAXOBJ, &crelaxinfo.dObjVal));
+  mxGetDoubles(mrelaxinfo.relaxobj)[iWeight] = crelaxinfo.dObjVal;
 
   if (nCol > 0)
   {
-    // 'relaxvalue'
-    mxAddField(relaxInfo, COPTMEX_FEASRELAX_VALUE);
-    mxSetField(relaxInfo, 0, COPTMEX_FEASRELAX_VALUE, mrelaxinfo.relaxvalue);
-    // 'relaxlb'
-    mxAddField(relaxInfo, COPTMEX_FEASRELAX_LB);
-    mxSetField(relaxInfo, 0, COPTMEX_FEASRELAX_LB, mrelaxinfo.relaxlb);
-    // 'relaxub'
-    mxAddField(relaxInfo, COPTMEX_FEASRELAX_UB);
-    mxSetField(relaxInfo, 0, COPTMEX_FEASRELAX_UB, mrelaxinfo.relaxub);
+    COPTMEX_CALL(COPT_GetColInfo(prob, COPT_DBLINFO_RELAXVALUE, nCol, NULL, crelaxinfo.colValue));
+    COPTMEX_CALL(COPT_GetColInfo(prob, COPT_DBLINFO_RELAXLB, nCol, NULL, crelaxinfo.colLowRlx));
+    COPTMEX_CALL(COPT_GetColInfo(prob, COPT_DBLINFO_RELAXUB, nCol, NULL, crelaxinfo.colUppRlx));
   }
 
   if (nRow > 0)
   {
-    // 'relaxlhs'
-    mxAddField(relaxInfo, COPTMEX_FEASRELAX_LHS);
-    mxSetField(relaxInfo, 0, COPTMEX_FEASRELAX_LHS, mrelaxinfo.relaxlhs);
-    // 'relaxrhs'
-    mxAddField(relaxInfo, COPTMEX_FEASRELAX_RHS);
-    mxSetField(relaxInfo, 0, COPTMEX_FEASRELAX_RHS, mrelaxinfo.relaxrhs);
+    COPTMEX_CALL(COPT_GetRowInfo(prob, COPT_DBLINFO_RELAXLB, nRow, NULL, crelaxinfo.rowLowRlx));
+    COPTMEX_CALL(COPT_GetRowInfo(prob, COPT_DBLINFO_RELAXUB, nRow, NULL, crelaxinfo.rowUppRlx));
   }
 
-  // Write out feasibility relaxation problem
-  COPTMEX_CALL(COPT_WriteRelax(prob, "copt.relax"));
-
-  *out_relax = relaxInfo;
-
 exit_cleanup:
   if (retcode != COPT_RETCODE_OK)
   {
@@ -3619,546 +8114,304 @@ exit_cleanup:
   return retcode;
 }
 
-int COPTMEX_feasRelax(copt_prob* prob, const mxArray* penalty, mxArray** out_relax, int ifRetResult)
+/* Extract feasibility relaxation problem as model struct */
+int COPTMEX_getRelaxModel(copt_env* env, copt_prob* prob, mxArray** out_model)
 {
   int retcode = COPT_RETCODE_OK;
+  copt_prob* relaxprob = NULL;
+  coptmex_memfile memfile;
 
-  mxArray* lbpen = NULL;
-  mxArray* ubpen = NULL;
-  mxArray* rhspen = NULL;
-  mxArray* upppen = NULL;
-
-  double* colLowPen = NULL;
-  double* colUppPen = NULL;
-  double* rowBndPen = NULL;
-  double* rowUppPen = NULL;
-
-  if (COPTMEX_checkPenalty(prob, penalty) == 0)
-  {
-    goto exit_cleanup;
-  }
-
-  lbpen = mxGetField(penalty, 0, COPTMEX_PENALTY_LBPEN);
-  ubpen = mxGetField(penalty, 0, COPTMEX_PENALTY_UBPEN);
-  rhspen = mxGetField(penalty, 0, COPTMEX_PENALTY_RHSPEN);
-  upppen = mxGetField(penalty, 0, COPTMEX_PENALTY_UPPPEN);
+  memfile.fd = -1;
+  memfile.isTemp = 0;
 
-  if (lbpen != NULL)
-  {
-    colLowPen = mxGetDoubles(lbpen);
-  }
-  if (ubpen != NULL)
-  {
-    colUppPen = mxGetDoubles(ubpen);
-  }
-  if (rhspen != NULL)
-  {
-    rowBndPen = mxGetDoubles(rhspen);
-  }
-  if (upppen != NULL)
-  {
-    rowUppPen = mxGetDoubles(upppen);
-  }
+  // COPT only writes relaxed problem by path, so pass it through an anonymous file
+  COPTMEX_CALL(COPTMEX_openMemFile("mps", 0, &memfile));
+  COPTMEX_CALL(COPT_WriteRelax(prob, memfile.path));
 
-  // Compute the feasibility relaxation
-  COPTMEX_CALL(COPT_FeasRelax(prob, colLowPen, colUppPen, rowBndPen, rowUppPen));
+  COPTMEX_CALL(COPT_CreateProb(env, &relaxprob));
+  COPTMEX_CALL(COPT_SetIntParam(relaxprob, COPT_INTPARAM_LOGGING, 0));
+  COPTMEX_CALL(COPT_ReadMps(relaxprob, memfile.path));
 
-  // Extract feasibility relaxation information
-  if (ifRetResult == 1)
-  {
-    COPTMEX_CALL(COPTMEX_getFeasRelax(prob, out_relax));
-  }
+  COPTMEX_CALL(COPTMEX_getModel(relaxprob, 0, NULL, out_model));
 
 exit_cleanup:
+  COPTMEX_closeMemFile(&memfile);
+  COPT_DeleteProb(&relaxprob);
   return retcode;
 }
 
-/* Get default parameters */
-int COPTMEX_getDefaultParams(copt_prob* prob, mxArray** out_param)
+/* Extract penalty of one weighting, or NULL if absent */
+static double* COPTMEX_getPenalty(const mxArray* penalty, const char* name, int nelem, int iWeight)
 {
-  int retcode = COPT_RETCODE_OK;
-  mxArray* defParam = NULL;
-  int nDefVal = 0;
-  double dDefVal = 0.0;
-
-  defParam = mxCreateStructMatrix(1, 1, 0, NULL);
-  if (!defParam)
-  {
-    retcode = COPT_RETCODE_MEMORY;
-    goto exit_cleanup;
-  }
-
-  /*
-   * Double parameters
-   */
-  {
-    // 'timelimit'
-    COPTMEX_CALL(COPT_GetDblParamDef(prob, COPT_DBLPARAM_TIMELIMIT, &dDefVal));
-
-    mxArray* dblParam = mxCreateDoubleScalar(dDefVal);
-    mxAddField(defParam, COPT_DBLPARAM_TIMELIMIT);
-    mxSetField(defParam, 0, COPT_DBLPARAM_TIMELIMIT, dblParam);
-  }
-  {
-    // 'soltimelimit'
-    COPTMEX_CALL(COPT_GetDblParamDef(prob, COPT_DBLPARAM_SOLTIMELIMIT, &dDefVal));
-
-    mxArray* dblParam = mxCreateDoubleScalar(dDefVal);
-    mxAddField(defParam, COPT_DBLPARAM_SOLTIMELIMIT);
-    mxSetField(defParam, 0, COPT_DBLPARAM_SOLTIMELIMIT, dblParam);
-  }
-  {
-    // 'matrixtol'
-    COPTMEX_CALL(COPT_GetDblParamDef(prob, COPT_DBLPARAM_MATRIXTOL, &dDefVal));
-
-    mxArray* dblParam = mxCreateDoubleScalar(dDefVal);
-    mxAddField(defParam, COPT_DBLPARAM_MATRIXTOL);
-    mxSetField(defParam, 0, COPT_DBLPARAM_MATRIXTOL, dblParam);
-  }
-  {
-    // 'feastol'
-    COPTMEX_CALL(COPT_GetDblParamDef(prob, COPT_DBLPARAM_FEASTOL, &dDefVal));
-
-    mxArray* dblParam = mxCreateDoubleScalar(dDefVal);
-    mxAddField(defParam, COPT_DBLPARAM_FEASTOL);
-    mxSetField(defParam, 0, COPT_DBLPARAM_FEASTOL, dblParam);
-  }
-  {
-    // 'dualtol'
-    COPTMEX_CALL(COPT_GetDblParamDef(prob, COPT_DBLPARAM_DUALTOL, &dDefVal));
-
-    mxArray* dblParam = mxCreateDoubleScalar(dDefVal);
-    mxAddField(defParam, COPT_DBLPARAM_DUALTOL);
-    mxSetField(defParam, 0, COPT_DBLPARAM_DUALTOL, dblParam);
-  }
-  {
-    // 'inttol'
-    COPTMEX_CALL(COPT_GetDblParamDef(prob, COPT_DBLPARAM_INTTOL, &dDefVal));
-
-    mxArray* dblParam = mxCreateDoubleScalar(dDefVal);
-    mxAddField(defParam, COPT_DBLPARAM_INTTOL);
-    mxSetField(defParam, 0, COPT_DBLPARAM_INTTOL, dblParam);
-  }
-  {
-    // 'pdlptol'
-    COPTMEX_CALL(COPT_GetDblParamDef(prob, COPT_DBLPARAM_PDLPTOL, &dDefVal));
-
-    mxArray* dblParam = mxCreateDoubleScalar(dDefVal);
-    mxAddField(defParam, COPT_DBLPARAM_PDLPTOL);
-    mxSetField(defParam, 0, COPT_DBLPARAM_PDLPTOL, dblParam);
-  }
-  {
-    // 'relgap'
-    COPTMEX_CALL(COPT_GetDblParamDef(prob, COPT_DBLPARAM_RELGAP, &dDefVal));
-
-    mxArray* dblParam = mxCreateDoubleScalar(dDefVal);
-    mxAddField(defParam, COPT_DBLPARAM_RELGAP);
-    mxSetField(defParam, 0, COPT_DBLPARAM_RELGAP, dblParam);
-  }
-  {
-    // 'absgap'
-    COPTMEX_CALL(COPT_GetDblParamDef(prob, COPT_DBLPARAM_ABSGAP, &dDefVal));
-
-    mxArray* dblParam = mxCreateDoubleScalar(dDefVal);
-    mxAddField(defParam, COPT_DBLPARAM_ABSGAP);
-    mxSetField(defParam, 0, COPT_DBLPARAM_ABSGAP, dblParam);
-  }
-  {
-    // 'tunetimelimit'
-    COPTMEX_CALL(COPT_GetDblParamDef(prob, COPT_DBLPARAM_TUNETIMELIMIT, &dDefVal));
-
-    mxArray* dblParam = mxCreateDoubleScalar(dDefVal);
-    mxAddField(defParam, COPT_DBLPARAM_TUNETIMELIMIT);
-    mxSetField(defParam, 0, COPT_DBLPARAM_TUNETIMELIMIT, dblParam);
-  }
-  {
-    // 'tunetargettime'
-    COPTMEX_CALL(COPT_GetDblParamDef(prob, COPT_DBLPARAM_TUNETARGETTIME, &dDefVal));
-
-    mxArray* dblParam = mxCreateDoubleScalar(dDefVal);
-    mxAddField(defParam, COPT_DBLPARAM_TUNETARGETTIME);
-    mxSetField(defParam, 0, COPT_DBLPARAM_TUNETARGETTIME, dblParam);
-  }
-  {
-    // 'tunetargetrelgap'
-    COPTMEX_CALL(COPT_GetDblParamDef(prob, COPT_DBLPARAM_TUNETARGETRELGAP, &dDefVal));
-
-    mxArray* dblParam = mxCreateDoubleScalar(dDefVal);
-    mxAddField(defParam, COPT_DBLPARAM_TUNETARGETRELGAP);
-    mxSetField(defParam, 0, COPT_DBLPARAM_TUNETARGETRELGAP, dblParam);
-  }
-
-  /*
-   * Integer parameters
-   */
-#if 0
-  {
-    // 'logging'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_LOGGING, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_LOGGING);
-    mxSetField(defParam, 0, COPT_INTPARAM_LOGGING, intParam);
-  }
-  {
-    // 'logtoconsole'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_LOGTOCONSOLE, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_LOGTOCONSOLE);
-    mxSetField(defParam, 0, COPT_INTPARAM_LOGTOCONSOLE, intParam);
-  }
-#endif
-  {
-    // 'presolve'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_PRESOLVE, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_PRESOLVE);
-    mxSetField(defParam, 0, COPT_INTPARAM_PRESOLVE, intParam);
-  }
-  {
-    // 'scaling'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_SCALING, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_SCALING);
-    mxSetField(defParam, 0, COPT_INTPARAM_SCALING, intParam);
-  }
-  {
-    // 'dualize'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_DUALIZE, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_DUALIZE);
-    mxSetField(defParam, 0, COPT_INTPARAM_DUALIZE, intParam);
-  }
-  {
-    // 'lpmethod'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_LPMETHOD, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_LPMETHOD);
-    mxSetField(defParam, 0, COPT_INTPARAM_LPMETHOD, intParam);
-  }
-  {
-    // 'gpumode'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_GPUMODE, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_GPUMODE);
-    mxSetField(defParam, 0, COPT_INTPARAM_GPUMODE, intParam);
-  }
-  {
-    // 'gpudevice'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_GPUDEVICE, &nDefVal));
+  int isArray = (mxGetNumberOfElements(penalty) > 1);
+  mxArray* pen = mxGetField(penalty, isArray ? iWeight : 0, name);
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_GPUDEVICE);
-    mxSetField(defParam, 0, COPT_INTPARAM_GPUDEVICE, intParam);
-  }
-  {
-    // 'reqfarkasray'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_REQFARKASRAY, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_REQFARKASRAY);
-    mxSetField(defParam, 0, COPT_INTPARAM_REQFARKASRAY, intParam);
-  }
+  if (pen == NULL)
   {
-    // 'dualprice'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_DUALPRICE, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_DUALPRICE);
-    mxSetField(defParam, 0, COPT_INTPARAM_DUALPRICE, intParam);
+    return NULL;
   }
-  {
-    // 'dualperturb'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_DUALPERTURB, &nDefVal));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_DUALPERTURB);
-    mxSetField(defParam, 0, COPT_INTPARAM_DUALPERTURB, intParam);
-  }
+  // Vector penalties are shared by all weightings of a matrix-valued penalty struct
+  if (isArray || mxGetNumberOfElements(pen) == nelem)
   {
-    // 'cutlevel'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_CUTLEVEL, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_CUTLEVEL);
-    mxSetField(defParam, 0, COPT_INTPARAM_CUTLEVEL, intParam);
+    return mxGetDoubles(pen);
   }
-  {
-    // 'rootcutlevel'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_ROOTCUTLEVEL, &nDefVal));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_ROOTCUTLEVEL);
-    mxSetField(defParam, 0, COPT_INTPARAM_ROOTCUTLEVEL, intParam);
-  }
-  {
-    // 'treecutlevel'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_TREECUTLEVEL, &nDefVal));
+  return mxGetDoubles(pen) + (size_t) iWeight * nelem;
+}
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_TREECUTLEVEL);
-    mxSetField(defParam, 0, COPT_INTPARAM_TREECUTLEVEL, intParam);
-  }
-  {
-    // 'rootcutrounds'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_ROOTCUTROUNDS, &nDefVal));
+int COPTMEX_feasRelax(copt_prob* prob, const mxArray* penalty, const mxArray* in_param, mxArray** out_relax,
+                      int ifRetResult)
+{
+  int retcode = COPT_RETCODE_OK;
+  char msgbuf[COPT_BUFFSIZE];
+  char* relaxfilename = NULL;
+  mxArray* relaxfile = NULL;
+  int nRow = 0, nCol = 0;
+  int nWeight = 1;
+  coptmex_watchdog watchdog;
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_ROOTCUTROUNDS);
-    mxSetField(defParam, 0, COPT_INTPARAM_ROOTCUTROUNDS, intParam);
-  }
-  {
-    // 'nodecutrounds'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_NODECUTROUNDS, &nDefVal));
+  watchdog.started = 0;
+  watchdog.stopped = 0;
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_NODECUTROUNDS);
-    mxSetField(defParam, 0, COPT_INTPARAM_NODECUTROUNDS, intParam);
-  }
+  if (COPTMEX_checkPenalty(prob, penalty, &nWeight) == 0)
   {
-    // 'heurlevel'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_HEURLEVEL, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_HEURLEVEL);
-    mxSetField(defParam, 0, COPT_INTPARAM_HEURLEVEL, intParam);
+    goto exit_cleanup;
   }
-  {
-    // 'roundingheurlevel'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_ROUNDINGHEURLEVEL, &nDefVal));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_ROUNDINGHEURLEVEL);
-    mxSetField(defParam, 0, COPT_INTPARAM_ROUNDINGHEURLEVEL, intParam);
-  }
+  relaxfile = COPTMEX_getMexParam(in_param, COPTMEX_PARAM_RELAXFILE);
+  if (relaxfile != NULL && !mxIsChar(relaxfile))
   {
-    // 'divingheurlevel'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_DIVINGHEURLEVEL, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_DIVINGHEURLEVEL);
-    mxSetField(defParam, 0, COPT_INTPARAM_DIVINGHEURLEVEL, intParam);
+    snprintf(msgbuf, COPT_BUFFSIZE, "parameter.%s", COPTMEX_PARAM_RELAXFILE);
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, msgbuf);
+    goto exit_cleanup;
   }
-  {
-    // 'fapheurlevel'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_FAPHEURLEVEL, &nDefVal));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_FAPHEURLEVEL);
-    mxSetField(defParam, 0, COPT_INTPARAM_FAPHEURLEVEL, intParam);
-  }
-  {
-    // 'submipheurlevel'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_SUBMIPHEURLEVEL, &nDefVal));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_ROWS, &nRow));
+  COPTMEX_CALL(COPT_GetIntAttr(prob, COPT_INTATTR_COLS, &nCol));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_SUBMIPHEURLEVEL);
-    mxSetField(defParam, 0, COPT_INTPARAM_SUBMIPHEURLEVEL, intParam);
-  }
+  // Compute the feasibility relaxation for each weighting on the loaded problem, stopping on Ctrl-C
+  COPTMEX_startWatchdog(&watchdog, &prob, 1, 0.0);
+  for (int k = 0; k < nWeight && !watchdog.stopped; ++k)
   {
-    // 'strongbranching'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_STRONGBRANCHING, &nDefVal));
+    double* colLowPen = COPTMEX_getPenalty(penalty, COPTMEX_PENALTY_LBPEN, nCol, k);
+    double* colUppPen = COPTMEX_getPenalty(penalty, COPTMEX_PENALTY_UBPEN, nCol, k);
+    double* rowBndPen = COPTMEX_getPenalty(penalty, COPTMEX_PENALTY_RHSPEN, nRow, k);
+    double* rowUppPen = COPTMEX_getPenalty(penalty, COPTMEX_PENALTY_UPPPEN, nRow, k);
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_STRONGBRANCHING);
-    mxSetField(defParam, 0, COPT_INTPARAM_STRONGBRANCHING, intParam);
-  }
-  {
-    // 'conflictanalysis'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_CONFLICTANALYSIS, &nDefVal));
+    COPTMEX_CALL(COPT_FeasRelax(prob, colLowPen, colUppPen, rowBndPen, rowUppPen));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_CONFLICTANALYSIS);
-    mxSetField(defParam, 0, COPT_INTPARAM_CONFLICTANALYSIS, intParam);
+    // Extract feasibility relaxation information
+    if (ifRetResult == 1)
+    {
+      COPTMEX_CALL(COPTMEX_getFeasRelax(prob, nWeight, k, out_relax));
+    }
   }
-  {
-    // 'nodelimit'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_NODELIMIT, &nDefVal));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_NODELIMIT);
-    mxSetField(defParam, 0, COPT_INTPARAM_NODELIMIT, intParam);
-  }
-  {
-    // 'miptasks'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_MIPTASKS, &nDefVal));
+  COPTMEX_stopWatchdog(&watchdog);
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_MIPTASKS);
-    mxSetField(defParam, 0, COPT_INTPARAM_MIPTASKS, intParam);
-  }
+  // Write out feasibility relaxation problem only if requested
+  if (relaxfile != NULL)
   {
-    // 'barhomogeneous'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_BARHOMOGENEOUS, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_BARHOMOGENEOUS);
-    mxSetField(defParam, 0, COPT_INTPARAM_BARHOMOGENEOUS, intParam);
+    COPTMEX_CALL(COPTMEX_getString(relaxfile, &relaxfilename));
+    COPTMEX_CALL(COPT_WriteRelax(prob, relaxfilename));
   }
-  {
-    // 'barorder'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_BARORDER, &nDefVal));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_BARORDER);
-    mxSetField(defParam, 0, COPT_INTPARAM_BARORDER, intParam);
-  }
+exit_cleanup:
+  if (watchdog.started)
   {
-    // 'barstart'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_BARSTART, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_BARSTART);
-    mxSetField(defParam, 0, COPT_INTPARAM_BARSTART, intParam);
+    COPTMEX_stopWatchdog(&watchdog);
   }
-  {
-    // 'bariterlimit'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_BARITERLIMIT, &nDefVal));
+  COPTMEX_freeString(&relaxfilename);
+  return retcode;
+}
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_BARITERLIMIT);
-    mxSetField(defParam, 0, COPT_INTPARAM_BARITERLIMIT, intParam);
-  }
-  {
-    // 'threads'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_THREADS, &nDefVal));
+/* The parameters reported by copt_defaultparams */
+static const coptmex_paraminfo COPTMEX_paramTable[] = {
+  /* Double parameters */
+  {COPT_DBLPARAM_TIMELIMIT, 0},
+  {COPT_DBLPARAM_SOLTIMELIMIT, 0},
+  {COPT_DBLPARAM_MATRIXTOL, 0},
+  {COPT_DBLPARAM_FEASTOL, 0},
+  {COPT_DBLPARAM_DUALTOL, 0},
+  {COPT_DBLPARAM_INTTOL, 0},
+  {COPT_DBLPARAM_PDLPTOL, 0},
+  {COPT_DBLPARAM_RELGAP, 0},
+  {COPT_DBLPARAM_ABSGAP, 0},
+  {COPT_DBLPARAM_TUNETIMELIMIT, 0},
+  {COPT_DBLPARAM_TUNETARGETTIME, 0},
+  {COPT_DBLPARAM_TUNETARGETRELGAP, 0},
+  /* Integer parameters */
+  {COPT_INTPARAM_LOGGING, 1},
+  {COPT_INTPARAM_LOGTOCONSOLE, 1},
+  {COPT_INTPARAM_PRESOLVE, 1},
+  {COPT_INTPARAM_SCALING, 1},
+  {COPT_INTPARAM_DUALIZE, 1},
+  {COPT_INTPARAM_LPMETHOD, 1},
+  {COPT_INTPARAM_GPUMODE, 1},
+  {COPT_INTPARAM_GPUDEVICE, 1},
+  {COPT_INTPARAM_REQFARKASRAY, 1},
+  {COPT_INTPARAM_DUALPRICE, 1},
+  {COPT_INTPARAM_DUALPERTURB, 1},
+  {COPT_INTPARAM_CUTLEVEL, 1},
+  {COPT_INTPARAM_ROOTCUTLEVEL, 1},
+  {COPT_INTPARAM_TREECUTLEVEL, 1},
+  {COPT_INTPARAM_ROOTCUTROUNDS, 1},
+  {COPT_INTPARAM_NODECUTROUNDS, 1},
+  {COPT_INTPARAM_HEURLEVEL, 1},
+  {COPT_INTPARAM_ROUNDINGHEURLEVEL, 1},
+  {COPT_INTPARAM_DIVINGHEURLEVEL, 1},
+  {COPT_INTPARAM_FAPHEURLEVEL, 1},
+  {COPT_INTPARAM_SUBMIPHEURLEVEL, 1},
+  {COPT_INTPARAM_STRONGBRANCHING, 1},
+  {COPT_INTPARAM_CONFLICTANALYSIS, 1},
+  {COPT_INTPARAM_NODELIMIT, 1},
+  {COPT_INTPARAM_MIPTASKS, 1},
+  {COPT_INTPARAM_BARHOMOGENEOUS, 1},
+  {COPT_INTPARAM_BARORDER, 1},
+  {COPT_INTPARAM_BARSTART, 1},
+  {COPT_INTPARAM_BARITERLIMIT, 1},
+  {COPT_INTPARAM_THREADS, 1},
+  {COPT_INTPARAM_BARTHREADS, 1},
+  {COPT_INTPARAM_SIMPLEXTHREADS, 1},
+  {COPT_INTPARAM_CROSSOVERTHREADS, 1},
+  {COPT_INTPARAM_CROSSOVER, 1},
+  {COPT_INTPARAM_SDPMETHOD, 1},
+  {COPT_INTPARAM_IISMETHOD, 1},
+  {COPT_INTPARAM_FEASRELAXMODE, 1},
+  {COPT_INTPARAM_MIPSTARTMODE, 1},
+  {COPT_INTPARAM_MIPSTARTNODELIMIT, 1},
+  {COPT_INTPARAM_TUNEMETHOD, 1},
+  {COPT_INTPARAM_TUNEMODE, 1},
+  {COPT_INTPARAM_TUNEMEASURE, 1},
+  {COPT_INTPARAM_TUNEPERMUTES, 1},
+  {COPT_INTPARAM_TUNEOUTPUTLEVEL, 1},
+  {COPT_INTPARAM_LAZYCONSTRAINTS, 1},
+};
+
+/* Extract default value and range of parameter */
+static int COPTMEX_getParamRange(copt_prob* prob, const coptmex_paraminfo* info, double* p_def, double* p_min,
+                                 double* p_max)
+{
+  int retcode = COPT_RETCODE_OK;
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_THREADS);
-    mxSetField(defParam, 0, COPT_INTPARAM_THREADS, intParam);
-  }
+  if (info->type == 0)
   {
-    // 'barthreads'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_BARTHREADS, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_BARTHREADS);
-    mxSetField(defParam, 0, COPT_INTPARAM_BARTHREADS, intParam);
+    COPTMEX_CALL(COPT_GetDblParamDef(prob, info->name, p_def));
+    COPTMEX_CALL(COPT_GetDblParamMin(prob, info->name, p_min));
+    COPTMEX_CALL(COPT_GetDblParamMax(prob, info->name, p_max));
   }
+  else
   {
-    // 'simplexthreads'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_SIMPLEXTHREADS, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_SIMPLEXTHREADS);
-    mxSetField(defParam, 0, COPT_INTPARAM_SIMPLEXTHREADS, intParam);
+    int nDefVal = 0, nMinVal = 0, nMaxVal = 0;
+    COPTMEX_CALL(COPT_GetIntParamDef(prob, info->name, &nDefVal));
+    COPTMEX_CALL(COPT_GetIntParamMin(prob, info->name, &nMinVal));
+    COPTMEX_CALL(COPT_GetIntParamMax(prob, info->name, &nMaxVal));
+    *p_def = (double) nDefVal;
+    *p_min = (double) nMinVal;
+    *p_max = (double) nMaxVal;
   }
-  {
-    // 'crossoverthreads'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_CROSSOVERTHREADS, &nDefVal));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_CROSSOVERTHREADS);
-    mxSetField(defParam, 0, COPT_INTPARAM_CROSSOVERTHREADS, intParam);
-  }
-  {
-    // 'crossover'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_CROSSOVER, &nDefVal));
+exit_cleanup:
+  return retcode;
+}
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_CROSSOVER);
-    mxSetField(defParam, 0, COPT_INTPARAM_CROSSOVER, intParam);
-  }
-  {
-    // 'sdpmethod'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_SDPMETHOD, &nDefVal));
+/* Get default parameters */
+int COPTMEX_getDefaultParams(copt_prob* prob, mxArray** out_param, mxArray** out_info)
+{
+  int retcode = COPT_RETCODE_OK;
+  int nParam = (int) (sizeof(COPTMEX_paramTable) / sizeof(COPTMEX_paramTable[0]));
+  const char* parnames[sizeof(COPTMEX_paramTable) / sizeof(COPTMEX_paramTable[0])];
+  mxArray* defParam = NULL;
+  mxArray* parInfo = NULL;
+  mxArray* infoName = NULL;
+  mxArray* infoType = NULL;
+  double* infoMin = NULL;
+  double* infoMax = NULL;
+  double* infoDef = NULL;
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_SDPMETHOD);
-    mxSetField(defParam, 0, COPT_INTPARAM_SDPMETHOD, intParam);
-  }
+  for (int i = 0; i < nParam; ++i)
   {
-    // 'iismethod'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_IISMETHOD, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_IISMETHOD);
-    mxSetField(defParam, 0, COPT_INTPARAM_IISMETHOD, intParam);
+    parnames[i] = COPTMEX_paramTable[i].name;
   }
-  {
-    // 'feasrelaxmode'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_FEASRELAXMODE, &nDefVal));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_FEASRELAXMODE);
-    mxSetField(defParam, 0, COPT_INTPARAM_FEASRELAXMODE, intParam);
-  }
+  // Create all fields at once instead of growing struct per parameter
+  defParam = mxCreateStructMatrix(1, 1, nParam, parnames);
+  if (!defParam)
   {
-    // 'mipstartmode'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_MIPSTARTMODE, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_MIPSTARTMODE);
-    mxSetField(defParam, 0, COPT_INTPARAM_MIPSTARTMODE, intParam);
+    retcode = COPT_RETCODE_MEMORY;
+    goto exit_cleanup;
   }
-  {
-    // 'mipstartnodelimit'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_MIPSTARTNODELIMIT, &nDefVal));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_MIPSTARTNODELIMIT);
-    mxSetField(defParam, 0, COPT_INTPARAM_MIPSTARTNODELIMIT, intParam);
-  }
+  if (out_info != NULL)
   {
-    // 'tunemethod'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_TUNEMETHOD, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_TUNEMETHOD);
-    mxSetField(defParam, 0, COPT_INTPARAM_TUNEMETHOD, intParam);
+    const char* infonames[] = {COPTMEX_PARAMINFO_NAME, COPTMEX_PARAMINFO_TYPE, COPTMEX_PARAMINFO_MIN,
+                               COPTMEX_PARAMINFO_MAX, COPTMEX_PARAMINFO_DEFAULT};
+    parInfo = mxCreateStructMatrix(1, 1, 5, infonames);
+    infoName = mxCreateCellMatrix(nParam, 1);
+    infoType = mxCreateCellMatrix(nParam, 1);
+    if (!parInfo || !infoName || !infoType)
+    {
+      retcode = COPT_RETCODE_MEMORY;
+      goto exit_cleanup;
+    }
+    mxSetField(parInfo, 0, COPTMEX_PARAMINFO_NAME, infoName);
+    mxSetField(parInfo, 0, COPTMEX_PARAMINFO_TYPE, infoType);
+    mxSetField(parInfo, 0, COPTMEX_PARAMINFO_MIN, mxCreateDoubleMatrix(nParam, 1, mxREAL));
+    mxSetField(parInfo, 0, COPTMEX_PARAMINFO_MAX, mxCreateDoubleMatrix(nParam, 1, mxREAL));
+    mxSetField(parInfo, 0, COPTMEX_PARAMINFO_DEFAULT, mxCreateDoubleMatrix(nParam, 1, mxREAL));
+    infoMin = mxGetDoubles(mxGetField(parInfo, 0, COPTMEX_PARAMINFO_MIN));
+    infoMax = mxGetDoubles(mxGetField(parInfo, 0, COPTMEX_PARAMINFO_MAX));
+    infoDef = mxGetDoubles(mxGetField(parInfo, 0, COPTMEX_PARAMINFO_DEFAULT));
   }
-  {
-    // 'tunemode'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_TUNEMODE, &nDefVal));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_TUNEMODE);
-    mxSetField(defParam, 0, COPT_INTPARAM_TUNEMODE, intParam);
-  }
+  for (int i = 0; i < nParam; ++i)
   {
-    // 'tunemeasure'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_TUNEMEASURE, &nDefVal));
+    const coptmex_paraminfo* info = &COPTMEX_paramTable[i];
+    double dDefVal = 0.0, dMinVal = 0.0, dMaxVal = 0.0;
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_TUNEMEASURE);
-    mxSetField(defParam, 0, COPT_INTPARAM_TUNEMEASURE, intParam);
-  }
-  {
-    // 'tunepermutes'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_TUNEPERMUTES, &nDefVal));
+    COPTMEX_CALL(COPTMEX_getParamRange(prob, info, &dDefVal, &dMinVal, &dMaxVal));
+    mxSetFieldByNumber(defParam, 0, i, mxCreateDoubleScalar(dDefVal));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_TUNEPERMUTES);
-    mxSetField(defParam, 0, COPT_INTPARAM_TUNEPERMUTES, intParam);
+    if (parInfo != NULL)
+    {
+      mxSetCell(infoName, i, mxCreateString(info->name));
+      mxSetCell(infoType, i, mxCreateString(info->type == 0 ? COPTMEX_PARAMINFO_DOUBLE : COPTMEX_PARAMINFO_INTEGER));
+      infoMin[i] = dMinVal;
+      infoMax[i] = dMaxVal;
+      infoDef[i] = dDefVal;
+    }
   }
-  {
-    // 'tuneoutputlevel'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_TUNEOUTPUTLEVEL, &nDefVal));
 
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_TUNEOUTPUTLEVEL);
-    mxSetField(defParam, 0, COPT_INTPARAM_TUNEOUTPUTLEVEL, intParam);
-  }
+  *out_param = defParam;
+  if (out_info != NULL)
   {
-    // 'lazyconstraints'
-    COPTMEX_CALL(COPT_GetIntParamDef(prob, COPT_INTPARAM_LAZYCONSTRAINTS, &nDefVal));
-
-    mxArray* intParam = mxCreateDoubleScalar((double)nDefVal);
-    mxAddField(defParam, COPT_INTPARAM_LAZYCONSTRAINTS);
-    mxSetField(defParam, 0, COPT_INTPARAM_LAZYCONSTRAINTS, intParam);
+    *out_info = parInfo;
   }
 
-  *out_param = defParam;
-
 exit_cleanup:
   if (retcode != COPT_RETCODE_OK)
   {
+    if (defParam != NULL)
+    {
+      mxDestroyArray(defParam);
+    }
+    if (parInfo != NULL)
+    {
+      mxDestroyArray(parInfo);
+    }
+    else
+    {
+      if (infoName != NULL)
+      {
+        mxDestroyArray(infoName);
+      }
+      if (infoType != NULL)
+      {
+        mxDestroyArray(infoType);
+      }
+    }
+
     *out_param = NULL;
   }
   return retcode;
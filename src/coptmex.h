@@ -34,9 +34,25 @@
   } while (0)
 #endif
 
+/* Call COPT to load problem data, timed as load phase of solving */
+#define COPTMEX_LOAD(func)                                                                                             \
+  do                                                                                                                   \
+  {                                                                                                                    \
+    COPTMEX_switchPhase(COPTMEX_PHASE_LOAD);                                                                           \
+    COPTMEX_CALL(func);                                                                                                \
+    COPTMEX_switchPhase(COPTMEX_PHASE_CONVERT);                                                                        \
+  } while (0)
+
 #define COPTMEX_MAX(a, b) (((a) > (b)) ? (a) : (b))
 #define COPTMEX_MIN(a, b) (((a) < (b)) ? (a) : (b))
 
+/* The return code of errors raised by user functions, rethrown by commands after cleanup */
+#define COPTMEX_RETCODE_USERFUNC -1
+
+/* The reasons for watchdog to stop problems */
+#define COPTMEX_WATCHDOG_TIMEOUT   1
+#define COPTMEX_WATCHDOG_INTERRUPT 2
+
 /* The solution status in string format */
 #define COPTMEX_STATUS_UNSTARTED   "unstarted"
 #define COPTMEX_STATUS_OPTIMAL     "optimal"
@@ -121,6 +137,79 @@
 #define COPTMEX_MODEL_CONEK_ED "ed"
 #define COPTMEX_MODEL_CONEK_S  "s"
 
+/* The linprog/quadprog/intlinprog struct fields */
+#define COPTMEX_PROG_F      "f"
+#define COPTMEX_PROG_H      "H"
+#define COPTMEX_PROG_INTCON "intcon"
+#define COPTMEX_PROG_AINEQ  "Aineq"
+#define COPTMEX_PROG_BINEQ  "bineq"
+#define COPTMEX_PROG_AEQ    "Aeq"
+#define COPTMEX_PROG_BEQ    "beq"
+#define COPTMEX_PROG_LB     "lb"
+#define COPTMEX_PROG_UB     "ub"
+#define COPTMEX_PROG_X0     "x0"
+
+/* The interface parameters handled outside COPT */
+#define COPTMEX_PARAM_LOGFILE   "LogFile"
+#define COPTMEX_PARAM_RELAXFILE "RelaxFile"
+#define COPTMEX_PARAM_BATCHTHREADS "BatchThreads"
+#define COPTMEX_PARAM_TIMING       "Timing"
+#define COPTMEX_PARAM_PROGRESSFCN      "ProgressFcn"
+#define COPTMEX_PARAM_PROGRESSINTERVAL "ProgressInterval"
+#define COPTMEX_PARAM_LAZYCONSTRFCN    "LazyConstraintFcn"
+#define COPTMEX_PARAM_USERCUTFCN       "UserCutFcn"
+#define COPTMEX_PARAM_WRITESOL      "WriteSolution"
+#define COPTMEX_PARAM_WRITEBASIS    "WriteBasis"
+#define COPTMEX_PARAM_WRITEMIPSTART "WriteMipStart"
+#define COPTMEX_PARAM_RESULTFIELDS  "ResultFields"
+#define COPTMEX_PARAM_RESIDUALS     "Residuals"
+
+/* The precompiled parameter handle settings */
+#define COPTMEX_PARAM_MAGIC   "COPTPAR1"
+#define COPTMEX_PARAM_NAMELEN 64
+
+/* The parameter description fields */
+#define COPTMEX_PARAMINFO_NAME    "name"
+#define COPTMEX_PARAMINFO_TYPE    "type"
+#define COPTMEX_PARAMINFO_MIN     "min"
+#define COPTMEX_PARAMINFO_MAX     "max"
+#define COPTMEX_PARAMINFO_DEFAULT "default"
+
+#define COPTMEX_PARAMINFO_DOUBLE  "double"
+#define COPTMEX_PARAMINFO_INTEGER "integer"
+
+/* The progress info fields passed to ProgressFcn */
+#define COPTMEX_PROGRESS_TIME    "time"
+#define COPTMEX_PROGRESS_OBJVAL  "objval"
+#define COPTMEX_PROGRESS_BESTBND "bestbnd"
+#define COPTMEX_PROGRESS_NODECNT "nodecnt"
+#define COPTMEX_PROGRESS_X       "x"
+
+/* The progress reporting settings, interval in seconds */
+#define COPTMEX_PROGRESS_INTERVAL 1.0
+#define COPTMEX_PROGRESS_INITEVENT 256
+
+/* The phases of solving measured by timing info */
+#define COPTMEX_PHASE_PARAM   0
+#define COPTMEX_PHASE_READ    1
+#define COPTMEX_PHASE_CHECK   2
+#define COPTMEX_PHASE_CONVERT 3
+#define COPTMEX_PHASE_LOAD    4
+#define COPTMEX_PHASE_SOLVE   5
+#define COPTMEX_PHASE_EXTRACT 6
+#define COPTMEX_NPHASE        7
+
+/* The model cache settings and info struct fields */
+#define COPTMEX_CACHE_DIRENV  "COPTMEX_CACHEDIR"
+#define COPTMEX_CACHE_SIZEENV "COPTMEX_CACHESIZE"
+#define COPTMEX_CACHE_PREFIX  "coptmex_"
+#define COPTMEX_CACHE_DEFSIZE 4096
+
+#define COPTMEX_CACHE_DIR     "dir"
+#define COPTMEX_CACHE_NFILES  "nfiles"
+#define COPTMEX_CACHE_SIZE    "size"
+#define COPTMEX_CACHE_MAXSIZE "maxsize"
+
 /* The penalty struct fields */
 #define COPTMEX_PENALTY_LBPEN  "lbpen"
 #define COPTMEX_PENALTY_UBPEN  "ubpen"
@@ -156,6 +245,28 @@
 #define COPTMEX_RESULT_PSDSLACK "psdslack"
 #define COPTMEX_RESULT_PSDPI    "psdpi"
 
+#define COPTMEX_RESULT_TIMING "timing"
+#define COPTMEX_TIMING_TOTAL  "total"
+#define COPTMEX_TIMING_BYTES  "bytes"
+
+#define COPTMEX_RESULT_TIMELINE  "timeline"
+#define COPTMEX_RESULT_PRIMALINT "primalintegral"
+#define COPTMEX_RESULT_DUALINT   "dualintegral"
+
+#define COPTMEX_RESULT_PRIMALVIOL "primalviol"
+#define COPTMEX_RESULT_DUALVIOL   "dualviol"
+#define COPTMEX_RESULT_COMPL      "compl"
+
+/* The solution fields that ResultFields parameter can leave out of result */
+#define COPTMEX_FIELD_VALUE    0x01
+#define COPTMEX_FIELD_REDCOST  0x02
+#define COPTMEX_FIELD_SLACK    0x04
+#define COPTMEX_FIELD_DUAL     0x08
+#define COPTMEX_FIELD_VARBASIS 0x10
+#define COPTMEX_FIELD_CONBASIS 0x20
+#define COPTMEX_FIELD_POOL     0x40
+#define COPTMEX_FIELD_ALL      0x7f
+
 /* The advanced information */
 #define COPTMEX_ADVINFO_MIPSTART "start"
 
@@ -167,6 +278,13 @@
 #define COPTMEX_IIS_CONSTRUB  "construb"
 #define COPTMEX_IIS_SOS       "sos"
 #define COPTMEX_IIS_INDICATOR "indicator"
+#define COPTMEX_IIS_TIME      "iistime"
+#define COPTMEX_IIS_ISCOMPLETE "iscomplete"
+
+/* The main part of tuning result fields */
+#define COPTMEX_TUNE_PARAMS "params"
+#define COPTMEX_TUNE_TIME   "time"
+#define COPTMEX_TUNE_GAP    "gap"
 
 /* The feasibility relaxation result fields */
 #define COPTMEX_FEASRELAX_OBJ   "relaxobj"
@@ -314,6 +432,20 @@ typedef struct coptmex_mprob_s
   mxArray* mipstart;
 } coptmex_mprob;
 
+typedef struct coptmex_mprog_s
+{
+  mxArray* f;
+  mxArray* H;
+  mxArray* intcon;
+  mxArray* Aineq;
+  mxArray* bineq;
+  mxArray* Aeq;
+  mxArray* beq;
+  mxArray* lb;
+  mxArray* ub;
+  mxArray* x0;
+} coptmex_mprog;
+
 typedef struct coptmex_cconeprob_s
 {
   int nCol;
@@ -488,6 +620,7 @@ typedef struct coptmex_mmipsol_s
 typedef struct coptmex_miisinfo_s
 {
   mxArray* isminiis;
+  mxArray* iscomplete;
   mxArray* varlb;
   mxArray* varub;
   mxArray* constrlb;
@@ -506,8 +639,154 @@ typedef struct coptmex_mrelaxinfo_s
   mxArray* relaxrhs;
 } coptmex_mrelaxinfo;
 
+typedef struct coptmex_handle_s
+{
+  unsigned long long id;
+  copt_prob* prob;
+} coptmex_handle;
+
+typedef struct coptmex_registry_s
+{
+  copt_env* env;
+  coptmex_handle* handles;
+  int nHandle;
+  unsigned long long nLastId;
+} coptmex_registry;
+
+typedef void (*coptmex_cmdfunc)(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+
+typedef struct coptmex_command_s
+{
+  const char* name;
+  coptmex_cmdfunc func;
+} coptmex_command;
+
+typedef struct coptmex_paraminfo_s
+{
+  const char* name;
+  int type;
+} coptmex_paraminfo;
+
+typedef struct coptmex_paramhead_s
+{
+  char magic[8];
+  int nParam;
+  int nLogging;
+  int nLogFileLen;
+  int nTiming;
+} coptmex_paramhead;
+
+typedef struct coptmex_paramrec_s
+{
+  char name[COPTMEX_PARAM_NAMELEN];
+  int type;
+  int intval;
+  double dblval;
+} coptmex_paramrec;
+
+typedef struct coptmex_timing_s
+{
+  int isEnabled;
+  int iPhase;
+  double dStart;
+  double dPhaseStart;
+  size_t nPhaseBytes;
+  double phaseTime[COPTMEX_NPHASE];
+  double phaseBytes[COPTMEX_NPHASE];
+} coptmex_timing;
+
+typedef struct coptmex_progress_s
+{
+  const mxArray* func;
+  mxArray* except;
+  double dInterval;
+  double dStart;
+  double dEnd;
+  double dLastCall;
+  double dBestObj;
+  double dBestBnd;
+  int isMIP;
+  int nNode;
+  int nEvent;
+  int nEventCap;
+  int nEventSent;
+  int nCol;
+  int hasNewSol;
+  double* colValue;
+  double* eventTime;
+  double* eventObj;
+  double* eventBnd;
+  double* eventNode;
+} coptmex_progress;
+
+typedef struct coptmex_usercb_s
+{
+  const mxArray* lazyFunc;
+  const mxArray* cutFunc;
+  mxArray* except;
+  const char* badFunc;
+  int nCol;
+  int nRowCap;
+  int nElemCap;
+  int* rowBeg;
+  int* rowCnt;
+  int* rowIdx;
+  double* rowElem;
+  char* rowSense;
+  double* rowRhs;
+} coptmex_usercb;
+
+typedef struct coptmex_output_s
+{
+  int nFieldMask;
+  int ifResidual;
+  char* solFile;
+  char* basFile;
+  char* mstFile;
+} coptmex_output;
+
+typedef struct coptmex_memfile_s
+{
+  int fd;
+  int isTemp;
+  char path[COPT_BUFFSIZE];
+} coptmex_memfile;
+
+typedef struct coptmex_cacheentry_s
+{
+  char path[COPT_BUFFSIZE];
+  double size;
+  double mtime;
+} coptmex_cacheentry;
+
+/* Commands dispatched by coptmex */
+void COPTMEX_cmdRead(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdSolve(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdWrite(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdComputeIIS(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdFeasRelax(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdTune(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdDefaultParams(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdSolveProg(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdCache(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdParams(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdAddCols(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdAddRows(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdDelRows(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+void COPTMEX_cmdFree(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+
 /* Display error message */
 void COPTMEX_errorMsg(int errcode, const char* errinfo);
+/* Raise error of user functions kept by command, if any */
+void COPTMEX_rethrow(mxArray* except);
+/* Get the shared COPT environment */
+int COPTMEX_getEnv(copt_env** p_env);
+/* Keep problem alive across calls and return its handle */
+int COPTMEX_addHandle(copt_prob* prob, mxArray** out_handle);
+/* Get problem kept by handle */
+int COPTMEX_getHandle(const mxArray* in_handle, copt_prob** p_prob);
+/* Delete problem kept by handle */
+int COPTMEX_freeHandle(const mxArray* in_handle);
 /* Display banner */
 int COPTMEX_dispBanner(void);
 
@@ -522,31 +801,82 @@ int COPTMEX_getModel(copt_prob* prob, int nfiles, const mxArray** in_files, mxAr
 
 /* Load parameters to problem */
 int COPTMEX_setParam(copt_prob* prob, const mxArray* in_param);
-/* Read optional information from file */
+/* Validate and resolve parameters into a precompiled handle */
+int COPTMEX_compileParam(copt_prob* prob, const mxArray* in_param, mxArray** out_handle);
+/* Start timing phases of solving if enabled by parameter */
+int COPTMEX_startTiming(const mxArray* in_param);
+/* Switch timing to the given phase of solving */
+void COPTMEX_switchPhase(int iPhase);
+/* Stop timing and add timing info to result */
+int COPTMEX_stopTiming(mxArray* out_result);
+/* Start recording progress of MIP solving, reported to ProgressFcn if given by parameter */
+int COPTMEX_startProgress(const mxArray* in_param);
+/* Report remaining progress and add timeline to result, handing any error of ProgressFcn over to caller */
+int COPTMEX_stopProgress(mxArray* out_result, mxArray** p_except);
+/* Start passing solutions to LazyConstraintFcn and UserCutFcn if given by parameter */
+int COPTMEX_startUserCallback(const mxArray* in_param);
+/* Stop user callbacks, handing any error of LazyConstraintFcn or UserCutFcn over to caller */
+int COPTMEX_stopUserCallback(mxArray** p_except);
+/* Read optional information from file, or from each file in a cell array */
 int COPTMEX_readInfo(copt_prob* prob, const mxArray* in_info);
 /* Read model from file */
 int COPTMEX_readModel(copt_prob* prob, const mxArray* in_model);
 /* Write model to file */
 int COPTMEX_writeModel(copt_prob* prob, const mxArray* out_file);
+/* Read model from uint8 buffer in the specified format */
+int COPTMEX_readModelBuffer(copt_prob* prob, const mxArray* in_buffer, const mxArray* in_format);
+/* Write model to uint8 buffer in the specified format */
+int COPTMEX_writeModelBuffer(copt_prob* prob, const mxArray* in_format, mxArray** out_buffer);
+/* Extract model cache information */
+int COPTMEX_getCacheInfo(mxArray** out_info);
+/* Remove all entries in model cache */
+int COPTMEX_clearCache(int* p_nremoved);
 /* Extract and load data to model */
 int COPTMEX_loadModel(copt_prob* prob, const mxArray* in_model);
+/* Extract and load data to model, handing converted data over to caller if asked */
+int COPTMEX_loadModelData(copt_prob* prob, const mxArray* in_model, coptmex_cprob* out_cprob);
+/* Free converted model data */
+void COPTMEX_freeModelData(coptmex_cprob* cprob, const mxArray* in_model);
 /* Solve problem */
-int COPTMEX_solveModel(copt_prob* prob, const mxArray* in_model, int ifRead, mxArray** out_result, int ifRetResult);
+int COPTMEX_solveModel(copt_prob* prob, const mxArray* in_model, int ifRead, const mxArray* in_info,
+                       const mxArray* in_param, mxArray** out_result, int ifRetResult);
 
 /* Check if solve problem via cone data */
 int COPTMEX_isConeModel(const mxArray* in_model);
 /* Load problem with cone data */
 int COPTMEX_loadConeModel(copt_prob* prob, const mxArray* in_model, int* p_nRow, int** p_outMap);
 /* Solve cone problem with cone data */
-int COPTMEX_solveConeModel(copt_prob* prob, const mxArray* in_model, mxArray** out_result, int ifRetResult);
+int COPTMEX_solveConeModel(copt_prob* prob, const mxArray* in_model, const mxArray* in_info,
+                           const mxArray* in_param, mxArray** out_result, int ifRetResult);
+
+/* Solve linprog/quadprog/intlinprog problem with separate blocks */
+int COPTMEX_solveProg(copt_prob* prob, const mxArray* in_prog, mxArray** out_result, int ifRetResult);
+
+/* Append columns to kept problem and re-solve it from the current basis */
+int COPTMEX_addCols(copt_prob* prob, const mxArray* in_obj, const mxArray* in_A, const mxArray* in_lb,
+                    const mxArray* in_ub, mxArray** out_result, int ifRetResult);
+/* Append rows to kept problem and re-solve it from the current basis */
+int COPTMEX_addRows(copt_prob* prob, const mxArray* in_A, const mxArray* in_sense, const mxArray* in_rhs,
+                    mxArray** out_result, int ifRetResult);
+/* Delete rows of kept problem */
+int COPTMEX_delRows(copt_prob* prob, const mxArray* in_rows);
 
 /* Compute IIS for infeasible problem */
 int COPTMEX_computeIIS(copt_prob* prob, mxArray** out_iis, int ifRetResult);
+/* Compute IIS for a batch of infeasible problems in parallel */
+int COPTMEX_computeIISBatch(copt_env* env, const mxArray* in_models, const mxArray* in_param, mxArray** out_iis,
+                            int ifRetResult);
+/* Tune one or more problems and evaluate the tuned parameter sets */
+int COPTMEX_tuneModels(copt_env* env, const mxArray* in_models, const mxArray* in_param, mxArray** out_tune,
+                       int ifRetResult);
 
 /* Feasibility relaxation for infeasible problem */
-int COPTMEX_feasRelax(copt_prob* prob, const mxArray* penalty, mxArray** out_relax, int ifRetResult);
+int COPTMEX_feasRelax(copt_prob* prob, const mxArray* penalty, const mxArray* in_param, mxArray** out_relax,
+                      int ifRetResult);
+/* Extract feasibility relaxation problem as model struct */
+int COPTMEX_getRelaxModel(copt_env* env, copt_prob* prob, mxArray** out_model);
 
-/* Get default parameters */
-int COPTMEX_getDefaultParams(copt_prob* prob, mxArray** out_param);
+/* Get default parameters, and optionally their types and ranges */
+int COPTMEX_getDefaultParams(copt_prob* prob, mxArray** out_param, mxArray** out_info);
 
 #endif
@@ -0,0 +1,50 @@
+#include "coptmex.h"
+
+/* The commands of coptmex, called by the functions in lib */
+static const coptmex_command COPTMEX_commands[] = {
+  {"read", COPTMEX_cmdRead},
+  {"solve", COPTMEX_cmdSolve},
+  {"write", COPTMEX_cmdWrite},
+  {"computeiis", COPTMEX_cmdComputeIIS},
+  {"feasrelax", COPTMEX_cmdFeasRelax},
+  {"tune", COPTMEX_cmdTune},
+  {"defaultparams", COPTMEX_cmdDefaultParams},
+  {"solveprog", COPTMEX_cmdSolveProg},
+  {"cache", COPTMEX_cmdCache},
+  {"params", COPTMEX_cmdParams},
+  {"addcols", COPTMEX_cmdAddCols},
+  {"addrows", COPTMEX_cmdAddRows},
+  {"delrows", COPTMEX_cmdDelRows},
+  {"free", COPTMEX_cmdFree},
+};
+
+void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
+{
+  char cmd[COPT_BUFFSIZE];
+  int ncmd = (int) (sizeof(COPTMEX_commands) / sizeof(COPTMEX_commands[0]));
+
+  // Check if command is valid
+  if (nrhs == 0)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NUM, "inputs");
+    return;
+  }
+  if (!mxIsChar(prhs[0]) || mxGetString(prhs[0], cmd, COPT_BUFFSIZE) != 0)
+  {
+    COPTMEX_errorMsg(COPTMEX_ERROR_BAD_TYPE, "cmd");
+    return;
+  }
+
+  // Dispatch remaining arguments to command
+  for (int i = 0; i < ncmd; ++i)
+  {
+    if (strcmp(cmd, COPTMEX_commands[i].name) == 0)
+    {
+      COPTMEX_commands[i].func(nlhs, plhs, nrhs - 1, prhs + 1);
+      return;
+    }
+  }
+
+  COPTMEX_errorMsg(COPTMEX_ERROR_BAD_NAME, cmd);
+  return;
+}